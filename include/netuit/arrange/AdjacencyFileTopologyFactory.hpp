@@ -4,6 +4,8 @@
 
 #include <fstream>
 
+#include "../topology/CsrTopology.hpp"
+#include "../topology/parse_adjacency_file.hpp"
 #include "../topology/TopoEdge.hpp"
 #include "../topology/Topology.hpp"
 #include "../topology/TopoNode.hpp"
@@ -18,6 +20,13 @@ inline Topology make_adjacency_file_topology(const std::string& filename) {
   return dynamic_cast<std::istream&>(file);
 }
 
+/// Parse with multiple threads straight into a compact topology.
+inline CsrTopology make_adjacency_file_csr_topology(
+  const std::string& filename
+) {
+  return netuit::parse_adjacency_file(filename);
+}
+
 struct AdjacencyFileTopologyFactory {
 
   Topology operator()(const std::string& filename) const {
@@ -0,0 +1,45 @@
+#pragma once
+#ifndef NETUIT_ARRANGE_IMPLICITLOOPTOPOLOGY_HPP_INCLUDE
+#define NETUIT_ARRANGE_IMPLICITLOOPTOPOLOGY_HPP_INCLUDE
+
+#include <stddef.h>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+#include "../topology/ImplicitTopology.hpp"
+
+namespace netuit {
+
+/// Same layout and edge IDs as `netuit::make_loop_topology`, computed on
+/// demand.
+class ImplicitLoopTopology
+: public netuit::ImplicitTopology<ImplicitLoopTopology> {
+
+  size_t cardinality;
+
+public:
+
+  explicit ImplicitLoopTopology(const size_t cardinality_)
+  : cardinality(cardinality_)
+  { ; }
+
+  size_t GetSize() const { return cardinality; }
+
+  size_t GetNumOutputs(const node_id_t) const { return 1; }
+
+  size_t GetNumInputs(const node_id_t) const { return 1; }
+
+  Edge GetOutput(const node_id_t node_id, const size_t i) const {
+    emp_assert( node_id < cardinality && i == 0 );
+    return Edge{ node_id, node_id, node_id };
+  }
+
+  Edge GetInput(const node_id_t node_id, const size_t i) const {
+    return GetOutput( node_id, i );
+  }
+
+};
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_ARRANGE_IMPLICITLOOPTOPOLOGY_HPP_INCLUDE
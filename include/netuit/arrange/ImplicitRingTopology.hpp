@@ -0,0 +1,47 @@
+#pragma once
+#ifndef NETUIT_ARRANGE_IMPLICITRINGTOPOLOGY_HPP_INCLUDE
+#define NETUIT_ARRANGE_IMPLICITRINGTOPOLOGY_HPP_INCLUDE
+
+#include <stddef.h>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+#include "../topology/ImplicitTopology.hpp"
+
+namespace netuit {
+
+/// Same layout and edge IDs as `netuit::make_ring_topology`, computed on
+/// demand.
+class ImplicitRingTopology
+: public netuit::ImplicitTopology<ImplicitRingTopology> {
+
+  size_t cardinality;
+
+public:
+
+  explicit ImplicitRingTopology(const size_t cardinality_)
+  : cardinality(cardinality_)
+  { ; }
+
+  size_t GetSize() const { return cardinality; }
+
+  size_t GetNumOutputs(const node_id_t) const { return 1; }
+
+  size_t GetNumInputs(const node_id_t) const { return 1; }
+
+  Edge GetOutput(const node_id_t node_id, const size_t i) const {
+    emp_assert( node_id < cardinality && i == 0 );
+    // edge ids count up from one
+    return Edge{ node_id + 1, node_id, (node_id + 1) % cardinality };
+  }
+
+  Edge GetInput(const node_id_t node_id, const size_t i) const {
+    emp_assert( node_id < cardinality && i == 0 );
+    return GetOutput( (node_id + cardinality - 1) % cardinality, 0 );
+  }
+
+};
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_ARRANGE_IMPLICITRINGTOPOLOGY_HPP_INCLUDE
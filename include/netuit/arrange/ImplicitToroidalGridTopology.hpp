@@ -0,0 +1,88 @@
+#pragma once
+#ifndef NETUIT_ARRANGE_IMPLICITTOROIDALGRIDTOPOLOGY_HPP_INCLUDE
+#define NETUIT_ARRANGE_IMPLICITTOROIDALGRIDTOPOLOGY_HPP_INCLUDE
+
+#include <cmath>
+#include <set>
+#include <stddef.h>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+#include "../../uitsl/math/is_perfect_hypercube.hpp"
+#include "../../uitsl/math/mapping_utils.hpp"
+
+#include "../topology/ImplicitTopology.hpp"
+
+namespace netuit {
+
+/// Same layout and edge IDs as `netuit::make_toroidal_grid_topology`,
+/// computed on demand.
+class ImplicitToroidalGridTopology
+: public netuit::ImplicitTopology<ImplicitToroidalGridTopology> {
+
+  size_t dimension;
+  size_t cardinality;
+
+  // outputs and inputs are both listed north, west, east, south
+  static constexpr size_t num_directions{ 4 };
+
+  node_id_t GetNeighbor(const node_id_t node_id, const size_t direction) const {
+
+    const size_t first_idx_in_row = (node_id / dimension) * dimension;
+    const size_t idx_in_row = node_id % dimension;
+
+    switch ( direction ) {
+      case 0: return (node_id + cardinality - dimension) % cardinality;
+      case 1: return first_idx_in_row + (idx_in_row + dimension - 1) % dimension;
+      case 2: return first_idx_in_row + (idx_in_row + 1) % dimension;
+      case 3: return (node_id + dimension) % cardinality;
+      default: emp_assert( false, direction ); return {};
+    }
+
+  }
+
+public:
+
+  explicit ImplicitToroidalGridTopology(const uitsl::Dims& dim_cardinality)
+  : dimension( dim_cardinality.front() )
+  , cardinality( dimension * dimension ) {
+    emp_assert( dim_cardinality.size() == 2 ); // two-dimensional
+    emp_assert( std::set<size_t>(
+      std::begin( dim_cardinality ), std::end( dim_cardinality )
+    ).size() == 1 ); // square
+  }
+
+  explicit ImplicitToroidalGridTopology(const size_t cardinality_)
+  : ImplicitToroidalGridTopology( uitsl::Dims(
+    2, static_cast<size_t>( std::sqrt(cardinality_) )
+  ) ) {
+    emp_assert( uitsl::is_perfect_hypercube( cardinality_, 2 ) );
+  }
+
+  size_t GetSize() const { return cardinality; }
+
+  size_t GetNumOutputs(const node_id_t) const { return num_directions; }
+
+  size_t GetNumInputs(const node_id_t) const { return num_directions; }
+
+  Edge GetOutput(const node_id_t node_id, const size_t direction) const {
+    emp_assert( node_id < cardinality );
+    return Edge{
+      direction * cardinality + node_id,
+      node_id,
+      GetNeighbor( node_id, direction )
+    };
+  }
+
+  Edge GetInput(const node_id_t node_id, const size_t direction) const {
+    // e.g., the northern input is the northern neighbor's southern output
+    return GetOutput(
+      GetNeighbor( node_id, direction ), num_directions - 1 - direction
+    );
+  }
+
+};
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_ARRANGE_IMPLICITTOROIDALGRIDTOPOLOGY_HPP_INCLUDE
@@ -0,0 +1,96 @@
+#pragma once
+#ifndef NETUIT_ARRANGE_IMPLICITTOROIDALTOPOLOGY_HPP_INCLUDE
+#define NETUIT_ARRANGE_IMPLICITTOROIDALTOPOLOGY_HPP_INCLUDE
+
+#include <stddef.h>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../uitsl/math/mapping_utils.hpp"
+#include "../../uitsl/math/math_utils.hpp"
+
+#include "../topology/ImplicitTopology.hpp"
+
+namespace netuit {
+
+/**
+ * Toroidal layout of any number of dimensions, including hypercubes,
+ * computed on demand.
+ *
+ * Neighbors are listed as in `netuit::make_toroidal_topology`: one step up
+ * each dimension in order, then one step down each dimension in reverse
+ * order. The edge into a node from a neighbor is the neighbor's output in the
+ * opposite direction. Edge IDs match `netuit::make_toroidal_topology`
+ * wherever every dimension is longer than two and the layout is not a
+ * two-dimensional square, which that function hands off to
+ * `netuit::make_toroidal_grid_topology` (see
+ * `netuit::ImplicitToroidalGridTopology`).
+ */
+class ImplicitToroidalTopology
+: public netuit::ImplicitTopology<ImplicitToroidalTopology> {
+
+  uitsl::Dims dim_cardinality;
+
+  // distance between node ids one step apart in each dimension
+  emp::vector<size_t> strides;
+
+  size_t cardinality{ 1 };
+
+  size_t GetNumDirections() const { return 2 * dim_cardinality.size(); }
+
+  node_id_t GetNeighbor(const node_id_t node_id, const size_t direction) const {
+
+    const size_t num_dims = dim_cardinality.size();
+    const bool is_up = direction < num_dims;
+    const size_t dim = is_up ? direction : GetNumDirections() - 1 - direction;
+
+    const size_t coord = node_id / strides[dim] % dim_cardinality[dim];
+    const size_t neighbor_coord = uitsl::circular_index(
+      coord, dim_cardinality[dim], is_up ? +1 : -1
+    );
+
+    return node_id - coord * strides[dim] + neighbor_coord * strides[dim];
+
+  }
+
+public:
+
+  explicit ImplicitToroidalTopology(const uitsl::Dims& dim_cardinality_)
+  : dim_cardinality(dim_cardinality_) {
+    for (const size_t dim : dim_cardinality) {
+      strides.push_back( cardinality );
+      cardinality *= dim;
+    }
+  }
+
+  explicit ImplicitToroidalTopology(const size_t cardinality_)
+  : ImplicitToroidalTopology( uitsl::Dims{ cardinality_ } )
+  { ; }
+
+  size_t GetSize() const { return cardinality; }
+
+  size_t GetNumOutputs(const node_id_t) const { return GetNumDirections(); }
+
+  size_t GetNumInputs(const node_id_t) const { return GetNumDirections(); }
+
+  Edge GetOutput(const node_id_t node_id, const size_t direction) const {
+    emp_assert( node_id < cardinality && direction < GetNumDirections() );
+    return Edge{
+      direction * cardinality + node_id,
+      node_id,
+      GetNeighbor( node_id, direction )
+    };
+  }
+
+  Edge GetInput(const node_id_t node_id, const size_t direction) const {
+    return GetOutput(
+      GetNeighbor( node_id, direction ), GetNumDirections() - 1 - direction
+    );
+  }
+
+};
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_ARRANGE_IMPLICITTOROIDALTOPOLOGY_HPP_INCLUDE
@@ -2,26 +2,296 @@
 #ifndef NETUIT_ARRANGE_NAVIGABLESMALLWORLDTOPOLOGYFACTORY_HPP_INCLUDE
 #define NETUIT_ARRANGE_NAVIGABLESMALLWORLDTOPOLOGYFACTORY_HPP_INCLUDE
 
-#include <cstdlib>
-#include <fstream>
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <numeric>
 #include <ratio>
 #include <set>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <thread>
+#include <utility>
 
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
 #include "../../../third-party/Empirical/include/emp/base/vector.hpp"
-#include "../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
 
-#include "../../uitsl/debug/err_verify.hpp"
-#include "../../uitsl/fetch/make_temp_filepath.hpp"
-#include "../../uitsl/utility/unindent_raw_string_literal.hpp"
+#include "../../uitsl/math/SplitMix64.hpp"
+#include "../../uitsl/parallel/for_each_chunk.hpp"
 
-#include "../topology/TopoEdge.hpp"
+#include "../topology/CsrTopology.hpp"
 #include "../topology/Topology.hpp"
-#include "../topology/TopoNode.hpp"
-
-#include "AdjacencyFileTopologyFactory.hpp"
 
 namespace netuit {
 
+namespace internal {
+
+/**
+ * Navigable small world graph as generated by networkx: nodes sit on an
+ * n^dim lattice, each node links to every node within lattice (Manhattan)
+ * distance p, and makes q more links to nodes picked with probability
+ * proportional to distance^-r.
+ *
+ * Instead of weighing every other node, a long-range link draws a distance
+ * from the number of lattice points at each distance times distance^-r, then
+ * a point uniformly at that distance, and retries if the point falls off the
+ * lattice. That picks each node on the lattice with exactly the right
+ * probability without visiting the others.
+ *
+ * Each node draws from its own stream keyed by its ID, so the graph only
+ * depends on the seed and not on the number of threads.
+ */
+class NavigableSmallWorldGenerator {
+
+  size_t side;
+  size_t p;
+  size_t q;
+  double r;
+  size_t dim;
+  uint64_t seed;
+
+  size_t num_nodes{ 1 };
+
+  // every lattice offset within distance p, except zero
+  emp::vector<emp::vector<long>> short_offsets;
+
+  // cumulative weight of drawing each distance, starting from one
+  emp::vector<double> distance_cdf;
+
+  // log of choose(n, k)
+  static double LogChoose(const double n, const double k) {
+    return std::lgamma(n + 1) - std::lgamma(k + 1) - std::lgamma(n - k + 1);
+  }
+
+  // log of the number of lattice points at distance d with k nonzero coords
+  double LogShellSize(const size_t d, const size_t k) const {
+    return k * std::log(2.0) + LogChoose(dim, k) + LogChoose(d - 1, k - 1);
+  }
+
+  // turn log weights into an unnormalized cumulative distribution
+  static void ToCDF(emp::vector<double>& log_weights) {
+    if ( log_weights.empty() ) return;
+    const double top = *std::max_element(
+      std::begin(log_weights), std::end(log_weights)
+    );
+    double total{};
+    for (auto& weight : log_weights) {
+      total += std::exp( weight - top );
+      weight = total;
+    }
+  }
+
+  static size_t DrawIndex(
+    const emp::vector<double>& cdf, uitsl::SplitMix64& rng
+  ) {
+    const auto it = std::upper_bound(
+      std::begin(cdf), std::end(cdf), rng.GetDouble() * cdf.back()
+    );
+    // rounding can land exactly on the total
+    return std::min<size_t>(
+      std::distance( std::begin(cdf), it ), cdf.size() - 1
+    );
+  }
+
+  emp::vector<long> Decode(size_t node) const {
+    emp::vector<long> res( dim );
+    for (auto& coord : res) {
+      coord = node % side;
+      node /= side;
+    }
+    return res;
+  }
+
+  /// Node at coords, or num_nodes if off the lattice.
+  size_t Encode(const emp::vector<long>& coords) const {
+    size_t res{};
+    for (size_t d = dim; d--; ) {
+      if ( coords[d] < 0 || coords[d] >= static_cast<long>( side ) ) {
+        return num_nodes;
+      }
+      res = res * side + coords[d];
+    }
+    return res;
+  }
+
+  size_t DrawLongRange(
+    const emp::vector<long>& coords, uitsl::SplitMix64& rng
+  ) const {
+
+    emp::vector<size_t> axes( dim );
+    emp::vector<long> target( dim );
+    emp::vector<size_t> cuts;
+
+    while ( true ) {
+
+      // draw distance
+      const size_t distance = 1 + DrawIndex( distance_cdf, rng );
+
+      // draw how many coordinates change
+      emp::vector<double> k_cdf;
+      for (size_t k = 1; k <= std::min( dim, distance ); ++k) {
+        k_cdf.push_back( LogShellSize(distance, k) );
+      }
+      ToCDF( k_cdf );
+      const size_t k = 1 + DrawIndex( k_cdf, rng );
+
+      // draw which coordinates change
+      std::iota( std::begin(axes), std::end(axes), size_t{} );
+      for (size_t i{}; i < k; ++i) {
+        std::swap( axes[i], axes[i + rng.GetUInt(dim - i)] );
+      }
+
+      // draw how far each changes, splitting distance into k positive parts
+      cuts.clear();
+      while ( cuts.size() + 1 < k ) {
+        const size_t cut = 1 + rng.GetUInt( distance - 1 );
+        if (
+          std::find( std::begin(cuts), std::end(cuts), cut ) == std::end(cuts)
+        ) cuts.push_back( cut );
+      }
+      cuts.push_back( 0 );
+      cuts.push_back( distance );
+      std::sort( std::begin(cuts), std::end(cuts) );
+
+      target = coords;
+      for (size_t i{}; i < k; ++i) {
+        const long step = cuts[i + 1] - cuts[i];
+        target[ axes[i] ] += ( rng() & 1 ) ? step : -step;
+      }
+
+      const size_t res = Encode( target );
+      if ( res != num_nodes ) return res;
+
+    }
+
+  }
+
+public:
+
+  NavigableSmallWorldGenerator(
+    const size_t side_,
+    const size_t p_,
+    const size_t q_,
+    const double r_,
+    const size_t dim_,
+    const uint64_t seed_
+  ) : side(side_)
+  , p(p_)
+  , q(q_)
+  , r(r_)
+  , dim(dim_)
+  , seed(seed_) {
+
+    emp_assert( dim > 0 );
+    for (size_t d{}; d < dim; ++d) num_nodes *= side;
+
+    // grow offsets one dimension at a time, then drop zero
+    short_offsets.emplace_back();
+    for (size_t d{}; d < dim; ++d) {
+      emp::vector<emp::vector<long>> extended;
+      for (const auto& offset : short_offsets) {
+        const long used = std::accumulate(
+          std::begin(offset), std::end(offset), 0l,
+          [](const long a, const long b){ return a + std::abs(b); }
+        );
+        const long left = static_cast<long>( p ) - used;
+        for (long step = -left; step <= left; ++step) {
+          extended.push_back( offset );
+          extended.back().push_back( step );
+        }
+      }
+      short_offsets = std::move( extended );
+    }
+    short_offsets.erase( std::remove_if(
+      std::begin(short_offsets), std::end(short_offsets),
+      [](const auto& offset){
+        return std::all_of(
+          std::begin(offset), std::end(offset),
+          [](const long step){ return step == 0; }
+        );
+      }
+    ), std::end(short_offsets) );
+
+    // farthest any two lattice points can be
+    const size_t max_distance = side ? dim * (side - 1) : 0;
+    for (size_t d = 1; d <= max_distance; ++d) {
+      emp::vector<double> shell_cdf;
+      for (size_t k = 1; k <= std::min(dim, d); ++k) {
+        shell_cdf.push_back( LogShellSize(d, k) );
+      }
+      const double top = *std::max_element(
+        std::begin(shell_cdf), std::end(shell_cdf)
+      );
+      ToCDF( shell_cdf );
+      distance_cdf.push_back(
+        top + std::log( shell_cdf.back() ) - r * std::log(d)
+      );
+    }
+    ToCDF( distance_cdf );
+
+  }
+
+  size_t GetNumNodes() const { return num_nodes; }
+
+  /// Sorted, unique nodes that node links to.
+  emp::vector<size_t> GetNeighbors(const size_t node) const {
+
+    const auto coords = Decode( node );
+    emp::vector<size_t> res;
+
+    emp::vector<long> target( dim );
+    for (const auto& offset : short_offsets) {
+      for (size_t d{}; d < dim; ++d) target[d] = coords[d] + offset[d];
+      const size_t neighbor = Encode( target );
+      if ( neighbor != num_nodes ) res.push_back( neighbor );
+    }
+
+    // nowhere to link to on a single-node lattice
+    if ( num_nodes > 1 ) {
+      uitsl::SplitMix64 rng( seed, node );
+      for (size_t i{}; i < q; ++i) {
+        res.push_back( DrawLongRange( coords, rng ) );
+      }
+    }
+
+    std::sort( std::begin(res), std::end(res) );
+    res.erase( std::unique( std::begin(res), std::end(res) ), std::end(res) );
+    return res;
+
+  }
+
+  emp::vector<std::pair<size_t, size_t>> GetEdges(
+    const size_t num_threads
+  ) const {
+
+    emp::vector<emp::vector<std::pair<size_t, size_t>>> chunks( num_threads );
+
+    uitsl::for_each_chunk(
+      num_nodes, num_threads,
+      [this, &chunks](
+        const size_t begin, const size_t end, const size_t chunk
+      ){
+        for (size_t node = begin; node < end; ++node) {
+          for (const size_t neighbor : GetNeighbors( node )) {
+            chunks[chunk].emplace_back( node, neighbor );
+          }
+        }
+      }
+    );
+
+    emp::vector<std::pair<size_t, size_t>> res;
+    for (auto& chunk : chunks) res.insert(
+      std::end(res), std::begin(chunk), std::end(chunk)
+    );
+    return res;
+
+  }
+
+};
+
+} // namespace internal
+
 /*
  * @param n The length of one side of the lattice; the number of nodes in the graph is therefore $n^2$.
  * @param p The diameter of short range connections.
@@ -30,44 +300,52 @@ namespace netuit {
  * @param r Exponent for decaying probability of connections.
  *   The probability of connecting to a node at lattice distance $d$ is $d^{-r}$.
  * @param dim Dimension of grid
+ * @param seed Seed for long-range connections
+ * @param num_threads Number of threads to use, doesn't affect result
  */
-inline Topology make_navigable_small_world_topology(
+inline CsrTopology make_navigable_small_world_csr_topology(
   const size_t n,
   const size_t p=1,
   const size_t q=1,
   const double r=2,
-  const size_t dim=1
+  const size_t dim=1,
+  const uint64_t seed=1,
+  const size_t num_threads=std::max(std::thread::hardware_concurrency(), 1u)
 ) {
 
-  const auto tmpfile = uitsl::make_temp_filepath();
-
-  const std::string command_template = std::string{"python3 -c \""}
-    + uitsl::unindent_raw_string_literal( R"(
-      import networkx as nx
-
-      G = nx.generators.geometric.navigable_small_world_graph(
-        %u, p=%u, q=%u, r=%f, dim=%u, seed=1
-      )
-
-      # relabel nodes to numeric indices from previous coordinate labels
-      H = nx.relabel_nodes(
-        G,
-        { label : idx for idx, label in enumerate(G.nodes()) },
-      )
-
-      with open('%s', 'w') as file:
-          for line in nx.generate_adjlist(H):
-              file.write(line + '\n')
-      )" ) + "\"";
-
-  const std::string command = emp::format_string(
-    command_template, n, p, q, r, dim, tmpfile.c_str()
+  const internal::NavigableSmallWorldGenerator generator(
+    n, p, q, r, dim, seed
   );
 
-  uitsl::err_verify( std::system( command.c_str() ) );
+  return netuit::CsrTopology::FromEdgeList(
+    generator.GetNumNodes(), generator.GetEdges( num_threads )
+  );
 
-  return netuit::make_adjacency_file_topology( tmpfile );
+}
 
+/*
+ * @param n The length of one side of the lattice; the number of nodes in the graph is therefore $n^2$.
+ * @param p The diameter of short range connections.
+ *  Each node is joined with every other node within this lattice distance.
+ * @param q The number of long-range connections for each node.
+ * @param r Exponent for decaying probability of connections.
+ *   The probability of connecting to a node at lattice distance $d$ is $d^{-r}$.
+ * @param dim Dimension of grid
+ * @param seed Seed for long-range connections
+ * @param num_threads Number of threads to use, doesn't affect result
+ */
+inline Topology make_navigable_small_world_topology(
+  const size_t n,
+  const size_t p=1,
+  const size_t q=1,
+  const double r=2,
+  const size_t dim=1,
+  const uint64_t seed=1,
+  const size_t num_threads=std::max(std::thread::hardware_concurrency(), 1u)
+) {
+  return make_navigable_small_world_csr_topology(
+    n, p, q, r, dim, seed, num_threads
+  ).ToTopology();
 }
 
 template<size_t P=1, size_t Q=1, typename R=std::ratio<2>>
@@ -2,63 +2,272 @@
 #ifndef NETUIT_ARRANGE_SOFTRANDOMGEOMETRICTOPOLOGYFACTORY_HPP_INCLUDE
 #define NETUIT_ARRANGE_SOFTRANDOMGEOMETRICTOPOLOGYFACTORY_HPP_INCLUDE
 
-#include <cstdlib>
-#include <fstream>
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <numeric>
 #include <ratio>
-#include <set>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <thread>
+#include <utility>
 
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
 #include "../../../third-party/Empirical/include/emp/base/vector.hpp"
-#include "../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
 
-#include "../../uitsl/debug/err_verify.hpp"
-#include "../../uitsl/fetch/make_temp_filepath.hpp"
-#include "../../uitsl/utility/unindent_raw_string_literal.hpp"
+#include "../../uitsl/math/SplitMix64.hpp"
+#include "../../uitsl/parallel/for_each_chunk.hpp"
 
-#include "../topology/TopoEdge.hpp"
+#include "../topology/CsrTopology.hpp"
 #include "../topology/Topology.hpp"
-#include "../topology/TopoNode.hpp"
-
-#include "AdjacencyFileTopologyFactory.hpp"
 
 namespace netuit {
 
+namespace internal {
+
+/**
+ * Soft random geometric graph as generated by networkx: nodes are placed
+ * uniformly at random in the unit cube and each pair closer than radius is
+ * joined with probability exp(-distance).
+ *
+ * Positions and coin flips are drawn from streams keyed by node IDs, so the
+ * graph only depends on the seed and not on the number of threads.
+ * Candidate pairs come from a grid of cells at least radius wide, so each
+ * node only looks at nodes in its own and adjacent cells.
+ */
+class SoftRandomGeometricGenerator {
+
+  size_t num_nodes;
+  double radius;
+  size_t dim;
+  uint64_t seed;
+
+  // num_nodes * dim coordinates, node-major
+  emp::vector<double> positions;
+
+  size_t cells_per_side;
+  // nodes sorted by cell, with each cell's range given by cell_offsets
+  emp::vector<size_t> cell_offsets;
+  emp::vector<size_t> cell_nodes;
+
+  // every combination of -1, 0, +1 across dimensions
+  emp::vector<emp::vector<int>> cell_neighborhood;
+
+  size_t GetCellCoord(const size_t node, const size_t d) const {
+    return std::min(
+      static_cast<size_t>( positions[node * dim + d] * cells_per_side ),
+      cells_per_side - 1
+    );
+  }
+
+  size_t GetCell(const size_t node) const {
+    size_t res{};
+    for (size_t d = dim; d--; ) {
+      res = res * cells_per_side + GetCellCoord(node, d);
+    }
+    return res;
+  }
+
+public:
+
+  SoftRandomGeometricGenerator(
+    const size_t num_nodes_,
+    const double radius_,
+    const size_t dim_,
+    const uint64_t seed_,
+    const size_t num_threads
+  ) : num_nodes(num_nodes_)
+  , radius(radius_)
+  , dim(dim_)
+  , seed(seed_)
+  , positions(num_nodes * dim) {
+
+    emp_assert( dim > 0 );
+    emp_assert( radius >= 0.0 );
+    emp_assert( num_threads > 0 );
+
+    uitsl::for_each_chunk(
+      num_nodes, num_threads,
+      [this](const size_t begin, const size_t end, size_t){
+        for (size_t node = begin; node < end; ++node) {
+          uitsl::SplitMix64 rng( seed, node );
+          for (size_t d{}; d < dim; ++d) {
+            positions[node * dim + d] = rng.GetDouble();
+          }
+        }
+      }
+    );
+
+    // cells must be at least radius wide, but no more numerous than nodes
+    const double max_per_side = std::min(
+      radius > 0.0 ? 1.0 / radius : 1.0,
+      std::pow( static_cast<double>( num_nodes ), 1.0 / dim )
+    );
+    cells_per_side = std::max(
+      static_cast<size_t>( max_per_side ), size_t{ 1 }
+    );
+    size_t num_cells{ 1 };
+    for (size_t d{}; d < dim; ++d) num_cells *= cells_per_side;
+
+    // counting sort nodes into cells
+    cell_offsets.resize( num_cells + 1 );
+    for (size_t node{}; node < num_nodes; ++node) {
+      ++cell_offsets[ GetCell(node) + 1 ];
+    }
+    std::partial_sum(
+      std::begin(cell_offsets), std::end(cell_offsets), std::begin(cell_offsets)
+    );
+    cell_nodes.resize( num_nodes );
+    emp::vector<size_t> cursors(
+      std::begin(cell_offsets), std::prev( std::end(cell_offsets) )
+    );
+    for (size_t node{}; node < num_nodes; ++node) {
+      cell_nodes[ cursors[GetCell(node)]++ ] = node;
+    }
+
+    cell_neighborhood.emplace_back();
+    for (size_t d{}; d < dim; ++d) {
+      emp::vector<emp::vector<int>> extended;
+      for (const auto& offset : cell_neighborhood) {
+        for (const int step : { -1, 0, 1 }) {
+          extended.push_back( offset );
+          extended.back().push_back( step );
+        }
+      }
+      cell_neighborhood = std::move( extended );
+    }
+
+  }
+
+  size_t GetNumNodes() const { return num_nodes; }
+
+  double GetCoordinate(const size_t node, const size_t d) const {
+    return positions[node * dim + d];
+  }
+
+  double GetDistance(const size_t a, const size_t b) const {
+    double res{};
+    for (size_t d{}; d < dim; ++d) {
+      const double diff = GetCoordinate(a, d) - GetCoordinate(b, d);
+      res += diff * diff;
+    }
+    return std::sqrt( res );
+  }
+
+  /// Are a and b joined, for a less than b?
+  bool IsLinked(const size_t a, const size_t b) const {
+    emp_assert( a < b );
+    const double distance = GetDistance( a, b );
+    return distance <= radius
+      && uitsl::SplitMix64( seed, a, b ).GetDouble() < std::exp( -distance );
+  }
+
+  /**
+   * Edges from each node to every higher-numbered node it is joined to,
+   * sorted, matching how networkx writes an undirected adjacency list.
+   */
+  emp::vector<std::pair<size_t, size_t>> GetEdges(
+    const size_t num_threads
+  ) const {
+
+    emp::vector<emp::vector<std::pair<size_t, size_t>>> chunks( num_threads );
+
+    uitsl::for_each_chunk(
+      num_nodes, num_threads,
+      [this, &chunks](
+        const size_t begin, const size_t end, const size_t chunk
+      ){
+        emp::vector<size_t> neighbors;
+        for (size_t node = begin; node < end; ++node) {
+
+          neighbors.clear();
+          for (const auto& offset : cell_neighborhood) {
+
+            size_t cell{};
+            bool in_bounds{ true };
+            for (size_t d = dim; d--; ) {
+              const size_t coord = GetCellCoord(node, d) + offset[d];
+              // wraps around to a huge value below zero
+              in_bounds &= coord < cells_per_side;
+              cell = cell * cells_per_side + coord;
+            }
+            if ( !in_bounds ) continue;
+
+            for (
+              size_t i = cell_offsets[cell]; i < cell_offsets[cell + 1]; ++i
+            ) {
+              const size_t candidate = cell_nodes[i];
+              if ( candidate > node && IsLinked( node, candidate ) ) {
+                neighbors.push_back( candidate );
+              }
+            }
+
+          }
+
+          std::sort( std::begin(neighbors), std::end(neighbors) );
+          for (const size_t neighbor : neighbors) {
+            chunks[chunk].emplace_back( node, neighbor );
+          }
+
+        }
+      }
+    );
+
+    emp::vector<std::pair<size_t, size_t>> res;
+    for (auto& chunk : chunks) res.insert(
+      std::end(res), std::begin(chunk), std::end(chunk)
+    );
+    return res;
+
+  }
+
+};
+
+} // namespace internal
+
 /*
 * @param n Number of nodes
 * @param radius Distance threshold value
 * @param dim Dimension of graph
+* @param seed Seed for node positions and edge probabilities
+* @param num_threads Number of threads to use, doesn't affect result
  */
-inline Topology make_soft_random_geometric_topology(
+inline CsrTopology make_soft_random_geometric_csr_topology(
   const size_t n,
   const double radius=0.1,
-  const size_t dim=2
+  const size_t dim=2,
+  const uint64_t seed=1,
+  const size_t num_threads=std::max(std::thread::hardware_concurrency(), 1u)
 ) {
 
-  const auto tmpfile = uitsl::make_temp_filepath();
-
-  const std::string command_template = std::string{"python3 -c \""}
-    + uitsl::unindent_raw_string_literal( R"(
-      import networkx as nx
-      import numpy as np
-
-      G = nx.generators.geometric.soft_random_geometric_graph(
-        %u, %f, dim=%u, seed=1
-      )
-
-      print('mean degree', np.mean([val for (node, val) in G.degree()]))
-
-      with open('%s', 'w') as file:
-          for line in nx.generate_adjlist(G):
-              file.write(line + '\n')
-      )" ) + "\"";
-
-  const std::string command = emp::format_string(
-    command_template, n, radius, dim, tmpfile.c_str()
+  const internal::SoftRandomGeometricGenerator generator(
+    n, radius, dim, seed, num_threads
   );
 
-  uitsl::err_verify( std::system( command.c_str() ) );
+  return netuit::CsrTopology::FromEdgeList(
+    n, generator.GetEdges( num_threads )
+  );
 
-  return netuit::make_adjacency_file_topology( tmpfile );
+}
 
+/*
+* @param n Number of nodes
+* @param radius Distance threshold value
+* @param dim Dimension of graph
+* @param seed Seed for node positions and edge probabilities
+* @param num_threads Number of threads to use, doesn't affect result
+ */
+inline Topology make_soft_random_geometric_topology(
+  const size_t n,
+  const double radius=0.1,
+  const size_t dim=2,
+  const uint64_t seed=1,
+  const size_t num_threads=std::max(std::thread::hardware_concurrency(), 1u)
+) {
+  return make_soft_random_geometric_csr_topology(
+    n, radius, dim, seed, num_threads
+  ).ToTopology();
 }
 
 template<typename Radius=std::deci, size_t Dim=2>
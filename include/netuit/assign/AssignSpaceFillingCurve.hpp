@@ -0,0 +1,120 @@
+#pragma once
+#ifndef NETUIT_ASSIGN_ASSIGNSPACEFILLINGCURVE_HPP_INCLUDE
+#define NETUIT_ASSIGN_ASSIGNSPACEFILLINGCURVE_HPP_INCLUDE
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <stddef.h>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../uitsl/math/mapping_utils.hpp"
+
+namespace netuit {
+
+/**
+ * Assign nodes of a grid, laid out as by `uitsl::linear_decode` (e.g.,
+ * `netuit::make_toroidal_grid_topology` or `netuit::make_toroidal_topology`),
+ * to contiguous stretches of a space-filling curve through the grid.
+ *
+ * Stretches of the curve are compact, so partitions have less surface for
+ * their volume than the long thin slabs of `AssignContiguously`. Grids need
+ * not be square or sized by powers of two: the curve runs through the
+ * smallest enclosing power-of-two cube and skips points outside the grid.
+ *
+ * The curve is cut into `n_groups * n_partitions` stretches, and stretch s
+ * goes to partition `s % n_partitions`. So, for procs, set `n_groups` to 1;
+ * for threads, set `n_partitions` to threads per proc and `n_groups` to the
+ * number of procs, and each proc's stretch splits into one per thread.
+ */
+template<
+  typename RETURN_TYPE,
+  size_t (*ENCODE)(const uitsl::Point&, size_t)
+>
+class AssignSpaceFillingCurve {
+
+  size_t n_partitions;
+  size_t n_stretches;
+
+  // position of each node along the curve, shared among copies
+  std::shared_ptr<const emp::vector<size_t>> ranks;
+
+  static std::shared_ptr<const emp::vector<size_t>> MakeRanks(
+    const uitsl::Dims& item_dims
+  ) {
+
+    const size_t n_items = std::accumulate(
+      std::begin(item_dims), std::end(item_dims),
+      size_t{1}, std::multiplies<size_t>{}
+    );
+
+    // bits per coordinate of the enclosing power-of-two cube
+    size_t bits{};
+    for (const size_t dim : item_dims) {
+      while ( (size_t{1} << bits) < dim ) ++bits;
+    }
+    emp_assert( item_dims.size() * bits <= 64, item_dims.size(), bits );
+
+    emp::vector<size_t> codes( n_items );
+    for (size_t node_id{}; node_id < n_items; ++node_id) {
+      codes[node_id] = ENCODE(
+        uitsl::linear_decode( node_id, item_dims ), bits
+      );
+    }
+
+    emp::vector<size_t> order( n_items );
+    std::iota( std::begin(order), std::end(order), size_t{} );
+    std::sort(
+      std::begin(order), std::end(order),
+      [&codes](const size_t a, const size_t b){ return codes[a] < codes[b]; }
+    );
+
+    emp::vector<size_t> res( n_items );
+    for (size_t rank{}; rank < n_items; ++rank) res[ order[rank] ] = rank;
+    return std::make_shared<const emp::vector<size_t>>( std::move(res) );
+
+  }
+
+public:
+
+  /// @param item_dims extent of the grid in each dimension.
+  /// @param n_partitions_ number of partitions to assign to.
+  /// @param n_groups number of times to cycle through the partitions.
+  AssignSpaceFillingCurve(
+    const uitsl::Dims& item_dims,
+    const size_t n_partitions_,
+    const size_t n_groups=1
+  ) : n_partitions(n_partitions_)
+  , n_stretches(n_partitions_ * n_groups)
+  , ranks( MakeRanks(item_dims) ) {
+    emp_assert( n_stretches );
+    emp_assert( n_stretches <= ranks->size(), n_stretches, ranks->size() );
+  }
+
+  RETURN_TYPE operator()(const size_t& node_id) const {
+    emp_assert( node_id < ranks->size(), node_id, ranks->size() );
+    return ( (*ranks)[node_id] * n_stretches / ranks->size() ) % n_partitions;
+  }
+
+};
+
+/// Assign grid nodes along a Hilbert curve, whose stretches are compact.
+template<typename RETURN_TYPE>
+using AssignHilbertCurve = netuit::AssignSpaceFillingCurve<
+  RETURN_TYPE, uitsl::hilbert_encode
+>;
+
+/// Assign grid nodes along a Morton (Z-order) curve, which is cheaper to
+/// compute but has jumps that Hilbert curves don't.
+template<typename RETURN_TYPE>
+using AssignMortonCurve = netuit::AssignSpaceFillingCurve<
+  RETURN_TYPE, uitsl::morton_encode
+>;
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_ASSIGN_ASSIGNSPACEFILLINGCURVE_HPP_INCLUDE
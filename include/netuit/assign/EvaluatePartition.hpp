@@ -0,0 +1,126 @@
+#pragma once
+#ifndef NETUIT_ASSIGN_EVALUATEPARTITION_HPP_INCLUDE
+#define NETUIT_ASSIGN_EVALUATEPARTITION_HPP_INCLUDE
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <stddef.h>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "PartitionWeights.hpp"
+
+namespace netuit {
+
+struct PartitionReport {
+
+  /// How many edges run between different parts?
+  size_t num_cut_edges{};
+
+  /// Summed weight of edges that run between different parts.
+  double edge_cut{};
+
+  /// Summed over nodes, how many other parts does each node send to?
+  size_t comm_volume{};
+
+  /// For each constraint, heaviest part's load over mean part load.
+  emp::vector<double> imbalance;
+
+};
+
+/// Measure edge cut and load imbalance of a partition of topology.
+/// @param topology a `netuit::Topology` or `netuit::CsrTopology`
+/// @param assignment part of each node
+/// @param num_parts number of parts
+/// @param weights node and edge weights to measure load and cut by
+template<typename TopologyType>
+PartitionReport EvaluatePartition(
+  const TopologyType& topology,
+  const std::function<size_t(size_t)>& assignment,
+  const size_t num_parts,
+  const netuit::PartitionWeights& weights
+) {
+
+  emp_assert( num_parts );
+
+  PartitionReport res;
+
+  const auto [x_adj, adjacency] = topology.AsCSR();
+  const auto edge_weights = weights.GetCsrEdgeWeights( topology );
+  emp_assert( edge_weights.size() == adjacency.size() );
+
+  emp::vector<size_t> parts;
+  for (size_t node{}; node < topology.GetSize(); ++node) {
+    parts.push_back( assignment( node ) );
+    emp_assert( parts.back() < num_parts, parts.back(), num_parts );
+  }
+
+  emp::vector<size_t> destinations;
+  for (size_t node{}; node < topology.GetSize(); ++node) {
+    destinations.clear();
+    for (int32_t i = x_adj[node]; i < x_adj[node + 1]; ++i) {
+      if ( parts[node] != parts[ adjacency[i] ] ) {
+        ++res.num_cut_edges;
+        res.edge_cut += edge_weights[i];
+        destinations.push_back( parts[ adjacency[i] ] );
+      }
+    }
+    std::sort( std::begin(destinations), std::end(destinations) );
+    res.comm_volume += std::distance(
+      std::begin(destinations),
+      std::unique( std::begin(destinations), std::end(destinations) )
+    );
+  }
+
+  for (
+    size_t constraint{}; constraint < weights.GetNumConstraints(); ++constraint
+  ) {
+    emp::vector<double> loads( num_parts );
+    for (size_t node{}; node < topology.GetSize(); ++node) {
+      loads[ parts[node] ] += weights.GetNodeWeight(
+        topology.GetCanonicalNodeID( node ), constraint
+      );
+    }
+    const double total = std::accumulate(
+      std::begin(loads), std::end(loads), 0.0
+    );
+    res.imbalance.push_back(
+      total > 0.0
+      ? *std::max_element( std::begin(loads), std::end(loads) )
+        * num_parts / total
+      : 1.0
+    );
+  }
+
+  return res;
+
+}
+
+/// Measure edge cut and node count imbalance of a partition of topology.
+template<typename TopologyType>
+PartitionReport EvaluatePartition(
+  const TopologyType& topology,
+  const std::function<size_t(size_t)>& assignment,
+  const size_t num_parts
+) {
+  // weights are looked up by canonical id, which can exceed a subtopology's
+  // size
+  size_t num_canonical_ids{};
+  for (size_t node{}; node < topology.GetSize(); ++node) {
+    num_canonical_ids = std::max(
+      num_canonical_ids, topology.GetCanonicalNodeID( node ) + 1
+    );
+  }
+
+  return netuit::EvaluatePartition(
+    topology, assignment, num_parts,
+    netuit::PartitionWeights{ num_canonical_ids }
+  );
+}
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_ASSIGN_EVALUATEPARTITION_HPP_INCLUDE
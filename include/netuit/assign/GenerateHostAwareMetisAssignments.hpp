@@ -0,0 +1,177 @@
+#pragma once
+#ifndef NETUIT_ASSIGN_GENERATEHOSTAWAREMETISASSIGNMENTS_HPP_INCLUDE
+#define NETUIT_ASSIGN_GENERATEHOSTAWAREMETISASSIGNMENTS_HPP_INCLUDE
+
+#include <functional>
+#include <map>
+#include <stddef.h>
+#include <unordered_map>
+#include <utility>
+
+#include <mpi.h>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../uitsl/debug/EnumeratedFunctor.hpp"
+#include "../../uitsl/mpi/comm_utils.hpp"
+#include "../../uitsl/mpi/proc_id_t.hpp"
+#include "../../uitsl/parallel/thread_utils.hpp"
+
+#include "../topology/Topology.hpp"
+
+#include "GenerateMetisAssignments.hpp"
+
+namespace netuit {
+
+/// This function returns a pair of functors determining thread and process
+/// assignments, from METIS partitionings at three levels: first across hosts,
+/// then across the ranks on each host, then across the threads of each rank.
+/// Each level minimizes its own edge cut, so edges between hosts (e.g.,
+/// over the network) are minimized before edges between ranks on a host
+/// (e.g., over shared memory).
+/// @param[in] proc_hosts Host of each process, e.g., from
+/// `uitsl::get_host_ids`, which can also simulate host groupings.
+/// @param[in] threads_per_proc Number of threads per process.
+/// @param[in] topology Topology to partition.
+/// @return std::pair of process and thread assignments.
+template<typename TopologyType>
+std::pair<
+  uitsl::EnumeratedFunctor<netuit::Topology::node_id_t, uitsl::proc_id_t>,
+  uitsl::EnumeratedFunctor<netuit::Topology::node_id_t, uitsl::thread_id_t>
+> GenerateHostAwareMetisAssignments (
+  const emp::vector<size_t>& proc_hosts,
+  const size_t threads_per_proc,
+  const TopologyType& topology
+) {
+  // make sure topology isn't empty
+  if (topology.GetSize() == 0) return {};
+
+  emp_assert( proc_hosts.size() );
+
+  // procs on each host, with hosts in order
+  std::map<size_t, emp::vector<uitsl::proc_id_t>> procs_by_host;
+  for (size_t proc = 0; proc < proc_hosts.size(); ++proc) {
+    procs_by_host[ proc_hosts[proc] ].push_back( proc );
+  }
+  emp::vector<emp::vector<uitsl::proc_id_t>> host_procs;
+  emp::vector<size_t> host_sizes;
+  for (const auto& [host, procs] : procs_by_host) {
+    host_procs.push_back( procs );
+    host_sizes.push_back( procs.size() );
+  }
+
+  // hosts get nodes in proportion to their number of procs
+  uitsl::EnumeratedFunctor<netuit::Topology::node_id_t, uitsl::proc_id_t>
+    host_assigner{ PartitionMetis(host_sizes, topology) };
+
+  // then each host's nodes go to its procs
+  std::unordered_map<size_t, uitsl::proc_id_t> proc_map;
+  for (
+    const auto& [host, subtopo] : GetSubTopologies(topology, host_assigner)
+  ) {
+    const auto& procs = host_procs[host];
+    // too few nodes to split among all of the host's procs, so give each
+    // node its own proc rather than asking METIS for empty parts
+    if ( subtopo.GetSize() < procs.size() ) {
+      for (size_t i = 0; i < subtopo.GetSize(); ++i) {
+        proc_map[subtopo.GetCanonicalNodeID(i)] = procs[i];
+      }
+      continue;
+    }
+    const auto proc_assign = PartitionMetis( procs.size(), subtopo );
+    for (size_t i = 0; i < subtopo.GetSize(); ++i) {
+      proc_map[subtopo.GetCanonicalNodeID(i)] = procs[ proc_assign[i] ];
+    }
+  }
+  uitsl::EnumeratedFunctor<netuit::Topology::node_id_t, uitsl::proc_id_t>
+    proc_assigner{ proc_map };
+
+  // then each proc's nodes go to its threads
+  uitsl::EnumeratedFunctor<netuit::Topology::node_id_t, uitsl::thread_id_t>
+    thread_assigner{ Shim(
+      GetSubTopologies(topology, proc_assigner),
+      threads_per_proc
+    ) };
+
+  return std::pair{
+    proc_assigner,
+    thread_assigner
+  };
+}
+
+/// This function returns a pair of functors determining thread and process
+/// assignments, partitioning first across the hosts that ranks of comm run
+/// on, then across ranks, then across threads.
+/// Collective over comm.
+/// @param[in] threads_per_proc Number of threads per process.
+/// @param[in] topology Topology to partition.
+/// @param[in] comm Communicator whose ranks to assign to.
+/// @return std::pair of process and thread assignments.
+template<typename TopologyType>
+std::pair<
+  uitsl::EnumeratedFunctor<netuit::Topology::node_id_t, uitsl::proc_id_t>,
+  uitsl::EnumeratedFunctor<netuit::Topology::node_id_t, uitsl::thread_id_t>
+> GenerateHostAwareMetisAssignments (
+  const size_t threads_per_proc,
+  const TopologyType& topology,
+  const MPI_Comm& comm=MPI_COMM_WORLD
+) {
+  return netuit::GenerateHostAwareMetisAssignments(
+    uitsl::get_host_ids(comm), threads_per_proc, topology
+  );
+}
+
+/// This function returns a pair of functors determining thread and process
+/// assignments, from METIS partitionings across hosts, then ranks, then
+/// threads.
+/// @param[in] proc_hosts Host of each process.
+/// @param[in] threads_per_proc Number of threads per process.
+/// @param[in] topology Topology to partition.
+/// @return std::pair of process and thread assignments.
+template<typename TopologyType>
+std::pair<
+  std::function<uitsl::proc_id_t(size_t)>,
+  std::function<uitsl::thread_id_t(size_t)>
+> GenerateHostAwareMetisAssignmentFunctors (
+  const emp::vector<size_t>& proc_hosts,
+  const size_t threads_per_proc,
+  const TopologyType& topology
+) {
+
+  const auto enumerated = netuit::GenerateHostAwareMetisAssignments(
+    proc_hosts, threads_per_proc, topology
+  );
+
+  return std::pair{
+    enumerated.first,
+    enumerated.second
+  };
+
+}
+
+/// This function returns a pair of functors determining thread and process
+/// assignments, from METIS partitionings across the hosts that ranks of comm
+/// run on, then ranks, then threads.
+/// Collective over comm.
+/// @param[in] threads_per_proc Number of threads per process.
+/// @param[in] topology Topology to partition.
+/// @param[in] comm Communicator whose ranks to assign to.
+/// @return std::pair of process and thread assignments.
+template<typename TopologyType>
+std::pair<
+  std::function<uitsl::proc_id_t(size_t)>,
+  std::function<uitsl::thread_id_t(size_t)>
+> GenerateHostAwareMetisAssignmentFunctors (
+  const size_t threads_per_proc,
+  const TopologyType& topology,
+  const MPI_Comm& comm=MPI_COMM_WORLD
+) {
+  return netuit::GenerateHostAwareMetisAssignmentFunctors(
+    uitsl::get_host_ids(comm), threads_per_proc, topology
+  );
+}
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_ASSIGN_GENERATEHOSTAWAREMETISASSIGNMENTS_HPP_INCLUDE
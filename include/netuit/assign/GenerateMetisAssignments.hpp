@@ -2,8 +2,13 @@
 #ifndef NETUIT_ASSIGN_GENERATEMETISASSIGNMENTS_HPP_INCLUDE
 #define NETUIT_ASSIGN_GENERATEMETISASSIGNMENTS_HPP_INCLUDE
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
+#include <iterator>
+#include <numeric>
 #include <stddef.h>
+#include <tuple>
 #include <utility>
 
 #ifndef __EMSCRIPTEN__
@@ -17,16 +22,146 @@
 #include "../../uitsl/mpi/mpi_utils.hpp"
 #include "../../uitsl/parallel/thread_utils.hpp"
 
+#include "../topology/CsrTopology.hpp"
 #include "../topology/Topology.hpp"
 
+#include "PartitionWeights.hpp"
+
 namespace netuit {
 
+namespace internal {
+
+/// Undirected graph with integer node and edge weights, as METIS takes it.
+struct WeightedCSR {
+
+  emp::vector<int32_t> x_adj;
+  emp::vector<int32_t> adjacency;
+  // node-major, one weight per constraint
+  emp::vector<int32_t> node_weights;
+  emp::vector<int32_t> edge_weights;
+
+};
+
+// scale weights to integers summing to about target, keeping proportions
+inline emp::vector<int32_t> QuantizeWeights(
+  const emp::vector<double>& weights, const int32_t min_weight
+) {
+
+  const double total = std::accumulate(
+    std::begin(weights), std::end(weights), 0.0
+  );
+  // fine enough to resolve small weights, coarse enough that METIS' sums
+  // stay well within int32_t
+  const double target = std::clamp(
+    64.0 * weights.size(), double{ 1 << 24 }, double{ 1 << 28 }
+  );
+
+  emp::vector<int32_t> res;
+  for (const double weight : weights) res.push_back( std::max(
+    total > 0.0
+      ? static_cast<int32_t>( std::lround( weight / total * target ) )
+      : 1,
+    min_weight
+  ) );
+  return res;
+
+}
+
+/// Symmetrize topology for METIS, summing the weights of edges in both
+/// directions between a pair of nodes and dropping self loops.
+template<typename TopologyType>
+WeightedCSR MakeWeightedCSR(
+  const TopologyType& topology, const netuit::PartitionWeights& weights
+) {
+
+  const auto [x_adj, adjacency] = topology.AsCSR();
+  const auto csr_edge_weights = weights.GetCsrEdgeWeights( topology );
+
+  // (lower node, higher node, weight)
+  emp::vector<std::tuple<int32_t, int32_t, double>> pairs;
+  for (size_t node{}; node < topology.GetSize(); ++node) {
+    for (int32_t i = x_adj[node]; i < x_adj[node + 1]; ++i) {
+      const int32_t from = static_cast<int32_t>( node );
+      const int32_t to = adjacency[i];
+      if ( from == to ) continue;
+      pairs.emplace_back(
+        std::min(from, to), std::max(from, to), csr_edge_weights[i]
+      );
+    }
+  }
+  std::sort( std::begin(pairs), std::end(pairs) );
+
+  // merge repeats of the same pair
+  emp::vector<std::tuple<int32_t, int32_t, double>> merged;
+  for (const auto& [a, b, weight] : pairs) {
+    if (
+      merged.size()
+      && std::get<0>( merged.back() ) == a && std::get<1>( merged.back() ) == b
+    ) std::get<2>( merged.back() ) += weight;
+    else merged.emplace_back( a, b, weight );
+  }
+
+  emp::vector<double> pair_weights;
+  std::transform(
+    std::begin(merged), std::end(merged), std::back_inserter(pair_weights),
+    [](const auto& pair){ return std::get<2>( pair ); }
+  );
+  // METIS wants every edge to weigh something
+  const auto quantized_pair_weights = QuantizeWeights( pair_weights, 1 );
+
+  WeightedCSR res;
+
+  // list each pair from both ends
+  emp::vector<int32_t> degrees( topology.GetSize() );
+  for (const auto& [a, b, weight] : merged) ++degrees[a], ++degrees[b];
+  res.x_adj.push_back( 0 );
+  std::partial_sum(
+    std::begin(degrees), std::end(degrees), std::back_inserter(res.x_adj)
+  );
+  res.adjacency.resize( res.x_adj.back() );
+  res.edge_weights.resize( res.x_adj.back() );
+  emp::vector<int32_t> cursors(
+    std::begin(res.x_adj), std::prev( std::end(res.x_adj) )
+  );
+  for (size_t i{}; i < merged.size(); ++i) {
+    const auto& [a, b, weight] = merged[i];
+    res.adjacency[ cursors[a] ] = b;
+    res.edge_weights[ cursors[a]++ ] = quantized_pair_weights[i];
+    res.adjacency[ cursors[b] ] = a;
+    res.edge_weights[ cursors[b]++ ] = quantized_pair_weights[i];
+  }
+
+  // quantize each constraint separately, then interleave
+  const size_t num_constraints = weights.GetNumConstraints();
+  res.node_weights.resize( topology.GetSize() * num_constraints );
+  for (size_t constraint{}; constraint < num_constraints; ++constraint) {
+    emp::vector<double> node_weights;
+    for (size_t node{}; node < topology.GetSize(); ++node) {
+      node_weights.push_back( weights.GetNodeWeight(
+        topology.GetCanonicalNodeID( node ), constraint
+      ) );
+    }
+    const auto quantized = QuantizeWeights( node_weights, 0 );
+    for (size_t node{}; node < topology.GetSize(); ++node) {
+      res.node_weights[ node * num_constraints + constraint ]
+        = quantized[node];
+    }
+  }
+
+  return res;
+
+}
+
+} // namespace internal
+
 /// Apply METIS' K-way partitioning algorithm to subdivide topology
 /// @param parts number of parts to subdivide topology into
-/// @param topology topology to subdivide
+/// @param topology topology to subdivide, a `netuit::Topology` or
+/// `netuit::CsrTopology`
 /// @return vector indicating what partition each vertex should go into
+template<typename TopologyType>
 emp::vector<int32_t> PartitionMetis(
-  const size_t num_parts, const netuit::Topology& topology
+  const size_t num_parts, const TopologyType& topology
 ) {
 
   emp_assert( num_parts <= topology.GetSize() );
@@ -74,16 +209,139 @@ emp::vector<int32_t> PartitionMetis(
   return result;
 }
 
+/// Apply METIS' K-way partitioning algorithm to subdivide topology into parts
+/// of unequal size, e.g., hosts with different numbers of ranks
+/// @param part_sizes relative size of each part
+/// @param topology topology to subdivide, a `netuit::Topology` or
+/// `netuit::CsrTopology`
+/// @return vector indicating what partition each vertex should go into
+template<typename TopologyType>
+emp::vector<int32_t> PartitionMetis(
+  const emp::vector<size_t>& part_sizes, const TopologyType& topology
+) {
+
+  emp_assert( part_sizes.size() );
+  emp_assert( part_sizes.size() <= topology.GetSize() );
+
+  // set up result vector
+  emp::vector<int32_t> result( topology.GetSize(), {} );
+
+  // the trivial no-split partition crashes METIS, so return before METIS call
+  if ( part_sizes.size() == 1 ) return result;
+
+  #ifndef __EMSCRIPTEN__
+  // set up variables
+  int32_t nodes = topology.GetSize();
+  int32_t n_cons = 1;
+  int32_t parts = uitsl::audit_cast<int32_t>( part_sizes.size() );
+  int32_t objval;
+
+  // get topology as CSR
+  auto [xadj, adjacency] = topology.AsCSR();
+
+  // fraction of nodes each part should get
+  const double total = std::accumulate(
+    std::begin(part_sizes), std::end(part_sizes), 0.0
+  );
+  emp::vector<real_t> target_fractions;
+  for (const size_t size : part_sizes) {
+    target_fractions.push_back( size / total );
+  }
+
+  // call partitioning algorithm
+  const int status = METIS_PartGraphKway(
+    &nodes, // idx_t *nvtxs: number of vertices in the graph
+    &n_cons, // idx_t *ncon: number of balancing constraints.
+    xadj.data(), // idx_t *xadj: array of node indexes into adjacency[]
+    adjacency.data(), // idx_t *adjncy:  array of adjacenct nodes for every node
+    nullptr, // idx_t *vwgt: weights of nodes
+    nullptr, // idx_t *vsize: size of nodes for total comunication value
+    nullptr, // idx_t *adjwgt: weights of edges
+    &parts, // idx_t *nparts: number of parts to partition the graph into
+    target_fractions.data(), // real_t *tpwgts: weight for each partition
+    nullptr, // real_t ubvec: allowed load imbalance tolerance for each constrnt
+    nullptr, // idx_t *options: array of options
+    &objval, // idx_t *objvalL edge-cut or total comm volume of the solution
+    result.data() // idx_t *part: partition vector of the graph
+  );
+
+  uitsl::metis::verify(status);
+  #endif
+
+  return result;
+}
+
+/// Apply METIS' K-way partitioning algorithm to subdivide topology, balancing
+/// measured node weights and minimizing the weight of cut edges
+/// @param parts number of parts to subdivide topology into
+/// @param topology topology to subdivide, a `netuit::Topology` or
+/// `netuit::CsrTopology`
+/// @param weights node weights for one or more balancing constraints (e.g.,
+/// compute and memory) and edge weights (e.g., bytes sent), looked up by
+/// canonical node ID and by edge ID
+/// @param imbalance_tolerance allowed ratio of heaviest part to mean part,
+/// for every constraint
+/// @return vector indicating what partition each vertex should go into
+template<typename TopologyType>
+emp::vector<int32_t> PartitionMetis(
+  const size_t num_parts,
+  const TopologyType& topology,
+  const netuit::PartitionWeights& weights,
+  const double imbalance_tolerance=1.03
+) {
+
+  emp_assert( num_parts <= topology.GetSize() );
+
+  // set up result vector
+  emp::vector<int32_t> result( topology.GetSize(), {} );
+
+  // the trivial no-split partition crashes METIS, so return before METIS call
+  if ( num_parts == 1 ) return result;
+
+  #ifndef __EMSCRIPTEN__
+  // set up variables
+  int32_t nodes = topology.GetSize();
+  int32_t n_cons = uitsl::audit_cast<int32_t>( weights.GetNumConstraints() );
+  int32_t parts = uitsl::audit_cast<int32_t>( num_parts );
+  int32_t objval;
+  emp::vector<real_t> tolerances( n_cons, imbalance_tolerance );
+
+  auto csr = internal::MakeWeightedCSR( topology, weights );
+
+  // call partitioning algorithm
+  const int status = METIS_PartGraphKway(
+    &nodes, // idx_t *nvtxs: number of vertices in the graph
+    &n_cons, // idx_t *ncon: number of balancing constraints.
+    csr.x_adj.data(), // idx_t *xadj: array of node indexes into adjacency[]
+    csr.adjacency.data(), // idx_t *adjncy: array of adjacent nodes
+    csr.node_weights.data(), // idx_t *vwgt: weights of nodes
+    nullptr, // idx_t *vsize: size of nodes for total comunication value
+    csr.edge_weights.data(), // idx_t *adjwgt: weights of edges
+    &parts, // idx_t *nparts: number of parts to partition the graph into
+    nullptr, // real_t *tpwgts: weight for each partition and constraint
+    tolerances.data(), // real_t ubvec: allowed load imbalance per constraint
+    nullptr, // idx_t *options: array of options
+    &objval, // idx_t *objvalL edge-cut or total comm volume of the solution
+    result.data() // idx_t *part: partition vector of the graph
+  );
+
+  uitsl::metis::verify(status);
+  #endif
+
+  return result;
+}
+
 /// This function is used to get subtopologies made up of all
 /// the neighbors of a node in a given topology, for all nodes.
 /// @param[in] topo Topology to get subtopologies of.
 /// @param[in] assigner Functor of node ids to proc ids.
 /// @return Unordered map of proc ids to subtopologies.
-std::unordered_map<uitsl::proc_id_t, netuit::Topology> GetSubTopologies(
-  const netuit::Topology& topo,
+template<typename TopologyType>
+std::unordered_map<uitsl::proc_id_t, TopologyType> GetSubTopologies(
+  const TopologyType& topo,
   const uitsl::EnumeratedFunctor<netuit::Topology::node_id_t, uitsl::proc_id_t>& assigner
 ) {
-  std::unordered_map<uitsl::proc_id_t, netuit::Topology> subtopos;
+  std::unordered_map<uitsl::proc_id_t, TopologyType> subtopos;
 
   std::unordered_map<
     uitsl::proc_id_t,
@@ -103,8 +361,9 @@ std::unordered_map<uitsl::proc_id_t, netuit::Topology> GetSubTopologies(
 }
 
 // todo: rename
+template<typename TopologyType>
 std::unordered_map<size_t, uitsl::thread_id_t> Shim(
-  const std::unordered_map<uitsl::proc_id_t, netuit::Topology>& proc_map,
+  const std::unordered_map<uitsl::proc_id_t, TopologyType>& proc_map,
   const size_t threads_per_proc
 ) {
   std::unordered_map<size_t, uitsl::thread_id_t> ret;
@@ -119,6 +378,26 @@ std::unordered_map<size_t, uitsl::thread_id_t> Shim(
   return ret;
 }
 
+template<typename TopologyType>
+std::unordered_map<size_t, uitsl::thread_id_t> Shim(
+  const std::unordered_map<uitsl::proc_id_t, TopologyType>& proc_map,
+  const size_t threads_per_proc,
+  const netuit::PartitionWeights& weights,
+  const double imbalance_tolerance
+) {
+  std::unordered_map<size_t, uitsl::thread_id_t> ret;
+
+  for (const auto& [proc_id, subtopo] : proc_map) {
+    const auto thread_assign = PartitionMetis(
+      threads_per_proc, subtopo, weights, imbalance_tolerance
+    );
+    for (size_t i = 0; i < subtopo.GetSize(); ++i) {
+      ret[subtopo.GetCanonicalNodeID(i)] = thread_assign[i];
+    }
+  }
+
+  return ret;
+}
 
 /// This function returns a pair of functors determining thread and process
 /// assignments, from a (hopefully optimal) k-way partitioning as returned by METIS.
@@ -126,13 +405,14 @@ std::unordered_map<size_t, uitsl::thread_id_t> Shim(
 /// @param[in] threads_per_proc Number of threads per process.
 /// @param[in] topology Topology to partition.
 /// @return std::pair of process and thread assignments. *
+template<typename TopologyType>
 std::pair<
   uitsl::EnumeratedFunctor<netuit::Topology::node_id_t, uitsl::proc_id_t>,
   uitsl::EnumeratedFunctor<netuit::Topology::node_id_t, uitsl::thread_id_t>
 > GenerateMetisAssignments (
   const size_t num_procs,
   const size_t threads_per_proc,
-  const netuit::Topology& topology
+  const TopologyType& topology
 ) {
   // make sure topology isn't empty
   if (topology.GetSize() == 0) return {};
@@ -158,13 +438,14 @@ std::pair<
 /// @param[in] threads_per_proc Number of threads per process.
 /// @param[in] topology Topology to partition.
 /// @return std::pair of process and thread assignments. *
+template<typename TopologyType>
 std::pair<
   std::function<uitsl::proc_id_t(size_t)>,
   std::function<uitsl::thread_id_t(size_t)>
 > GenerateMetisAssignmentFunctors (
   const size_t num_procs,
   const size_t threads_per_proc,
-  const netuit::Topology& topology
+  const TopologyType& topology
 ) {
 
   const auto enumerated = netuit::GenerateMetisAssignments(
@@ -178,6 +459,81 @@ std::pair<
 
 }
 
+/// This function returns a pair of functors determining thread and process
+/// assignments, from a k-way partitioning by METIS that balances measured node
+/// weights and minimizes the weight of cut edges.
+/// @param[in] num_procs Number of processes.
+/// @param[in] threads_per_proc Number of threads per process.
+/// @param[in] topology Topology to partition.
+/// @param[in] weights Measured node and edge weights, e.g., per-node update
+/// time and memory and per-edge bytes sent.
+/// @param[in] imbalance_tolerance Allowed ratio of heaviest part to mean part.
+/// @return std::pair of process and thread assignments.
+template<typename TopologyType>
+std::pair<
+  uitsl::EnumeratedFunctor<netuit::Topology::node_id_t, uitsl::proc_id_t>,
+  uitsl::EnumeratedFunctor<netuit::Topology::node_id_t, uitsl::thread_id_t>
+> GenerateMetisAssignments (
+  const size_t num_procs,
+  const size_t threads_per_proc,
+  const TopologyType& topology,
+  const netuit::PartitionWeights& weights,
+  const double imbalance_tolerance=1.03
+) {
+  // make sure topology isn't empty
+  if (topology.GetSize() == 0) return {};
+
+  uitsl::EnumeratedFunctor<netuit::Topology::node_id_t, uitsl::proc_id_t>
+    proc_assigner{ PartitionMetis(
+      num_procs, topology, weights, imbalance_tolerance
+    ) };
+
+  uitsl::EnumeratedFunctor<netuit::Topology::node_id_t, uitsl::thread_id_t>
+    thread_assigner{ Shim(
+      GetSubTopologies(topology, proc_assigner),
+      threads_per_proc,
+      weights,
+      imbalance_tolerance
+    ) };
+
+  return std::pair{
+    proc_assigner,
+    thread_assigner
+  };
+}
+
+/// This function returns a pair of functors determining thread and process
+/// assignments, from a k-way partitioning by METIS that balances measured node
+/// weights and minimizes the weight of cut edges.
+/// @param[in] num_procs Number of processes.
+/// @param[in] threads_per_proc Number of threads per process.
+/// @param[in] topology Topology to partition.
+/// @param[in] weights Measured node and edge weights.
+/// @param[in] imbalance_tolerance Allowed ratio of heaviest part to mean part.
+/// @return std::pair of process and thread assignments.
+template<typename TopologyType>
+std::pair<
+  std::function<uitsl::proc_id_t(size_t)>,
+  std::function<uitsl::thread_id_t(size_t)>
+> GenerateMetisAssignmentFunctors (
+  const size_t num_procs,
+  const size_t threads_per_proc,
+  const TopologyType& topology,
+  const netuit::PartitionWeights& weights,
+  const double imbalance_tolerance=1.03
+) {
+
+  const auto enumerated = netuit::GenerateMetisAssignments(
+    num_procs, threads_per_proc, topology, weights, imbalance_tolerance
+  );
+
+  return std::pair{
+    enumerated.first,
+    enumerated.second
+  };
+
+}
+
 } // namespace netuit
 
 #endif // #ifndef NETUIT_ASSIGN_GENERATEMETISASSIGNMENTS_HPP_INCLUDE
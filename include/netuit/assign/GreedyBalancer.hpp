@@ -0,0 +1,121 @@
+#pragma once
+#ifndef NETUIT_ASSIGN_GREEDYBALANCER_HPP_INCLUDE
+#define NETUIT_ASSIGN_GREEDYBALANCER_HPP_INCLUDE
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <stddef.h>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../uitsl/debug/safe_cast.hpp"
+#include "../../uitsl/mpi/proc_id_t.hpp"
+
+#include "NodeLoad.hpp"
+
+namespace netuit {
+
+/**
+ * Rebalance by repeatedly moving a node from the most loaded (proc, thread)
+ * slot to the least loaded one, until the most loaded slot is within
+ * tolerance of the mean or no single move helps.
+ *
+ * Each move takes the heaviest node that lowers the busier slot without
+ * making the other one busier than it was, so nodes only move when they
+ * have to and the result is deterministic, as every proc must compute the
+ * same placement.
+ *
+ * Balancers for `Mesh::Rebalance` are called as `balancer(loads, num_procs,
+ * threads_per_proc)` with every node's current placement and load, and
+ * return the same nodes with new placements.
+ */
+class GreedyBalancer {
+
+  double tolerance;
+
+public:
+
+  /// @param tolerance_ allowed ratio of busiest slot load to mean slot load.
+  explicit GreedyBalancer(const double tolerance_=1.05)
+  : tolerance(tolerance_)
+  { emp_assert( tolerance >= 1.0, tolerance ); }
+
+  emp::vector<NodeLoad> operator()(
+    emp::vector<NodeLoad> loads,
+    const size_t num_procs,
+    const size_t threads_per_proc
+  ) const {
+
+    const size_t num_slots = num_procs * threads_per_proc;
+    emp_assert( num_slots );
+
+    const auto slot_of = [threads_per_proc](const NodeLoad& node){
+      return node.proc * threads_per_proc + node.thread;
+    };
+
+    // node indices by slot, and total load of each slot
+    emp::vector<emp::vector<size_t>> members( num_slots );
+    emp::vector<double> slot_loads( num_slots );
+    for (size_t i{}; i < loads.size(); ++i) {
+      emp_assert( uitsl::safe_cast<size_t>( loads[i].proc ) < num_procs );
+      emp_assert( loads[i].thread < threads_per_proc );
+      members[ slot_of( loads[i] ) ].push_back( i );
+      slot_loads[ slot_of( loads[i] ) ] += loads[i].load;
+    }
+
+    const double mean = std::accumulate(
+      std::begin(slot_loads), std::end(slot_loads), 0.0
+    ) / num_slots;
+
+    // every move lowers the busiest slot, so this bounds the loop loosely
+    for (size_t move{}; move < loads.size(); ++move) {
+
+      const size_t busiest = std::distance(
+        std::begin(slot_loads),
+        std::max_element( std::begin(slot_loads), std::end(slot_loads) )
+      );
+      const size_t idlest = std::distance(
+        std::begin(slot_loads),
+        std::min_element( std::begin(slot_loads), std::end(slot_loads) )
+      );
+      const double gap = slot_loads[busiest] - slot_loads[idlest];
+      if ( slot_loads[busiest] <= tolerance * mean ) break;
+
+      // heaviest node that fits in the gap
+      auto& from = members[busiest];
+      const auto pick = std::max_element(
+        std::begin(from), std::end(from),
+        [&loads, gap](const size_t a, const size_t b){
+          const bool a_fits = loads[a].load > 0.0 && loads[a].load < gap;
+          const bool b_fits = loads[b].load > 0.0 && loads[b].load < gap;
+          return a_fits != b_fits ? b_fits : loads[a].load < loads[b].load;
+        }
+      );
+      if (
+        pick == std::end(from)
+        || loads[*pick].load <= 0.0 || loads[*pick].load >= gap
+      ) break;
+
+      const size_t node = *pick;
+      from.erase( pick );
+      members[idlest].push_back( node );
+      slot_loads[busiest] -= loads[node].load;
+      slot_loads[idlest] += loads[node].load;
+      loads[node].proc = uitsl::safe_cast<uitsl::proc_id_t>(
+        idlest / threads_per_proc
+      );
+      loads[node].thread = idlest % threads_per_proc;
+
+    }
+
+    return loads;
+
+  }
+
+};
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_ASSIGN_GREEDYBALANCER_HPP_INCLUDE
@@ -0,0 +1,82 @@
+#pragma once
+#ifndef NETUIT_ASSIGN_NODELOAD_HPP_INCLUDE
+#define NETUIT_ASSIGN_NODELOAD_HPP_INCLUDE
+
+#include <iterator>
+#include <numeric>
+#include <stddef.h>
+
+#include <mpi.h>
+
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../uitsl/debug/safe_cast.hpp"
+#include "../../uitsl/mpi/audited_routines.hpp"
+#include "../../uitsl/mpi/comm_utils.hpp"
+#include "../../uitsl/mpi/proc_id_t.hpp"
+#include "../../uitsl/parallel/thread_utils.hpp"
+
+namespace netuit {
+
+/// Where a node runs and how long its last update took.
+struct NodeLoad {
+
+  size_t node_id;
+  uitsl::proc_id_t proc;
+  uitsl::thread_id_t thread;
+  double load;
+
+};
+
+/**
+ * Gather every proc's node loads, in the same order on every proc.
+ * Collective over comm.
+ */
+inline emp::vector<NodeLoad> GatherNodeLoads(
+  const emp::vector<NodeLoad>& local, const MPI_Comm comm=MPI_COMM_WORLD
+) {
+
+  const int send_bytes = uitsl::safe_cast<int>(
+    local.size() * sizeof(NodeLoad)
+  );
+
+  emp::vector<int> recv_counts( uitsl::get_nprocs( comm ) );
+  UITSL_Allgather(
+    &send_bytes, // const void *sendbuf
+    1, // int sendcount
+    MPI_INT, // MPI_Datatype sendtype
+    recv_counts.data(), // void *recvbuf
+    1, // int recvcount
+    MPI_INT, // MPI_Datatype recvtype
+    comm // MPI_Comm comm
+  );
+
+  emp::vector<int> displs{ 0 };
+  std::partial_sum(
+    std::begin(recv_counts),
+    std::prev( std::end(recv_counts) ),
+    std::back_inserter( displs )
+  );
+
+  emp::vector<NodeLoad> res(
+    std::accumulate( std::begin(recv_counts), std::end(recv_counts), 0 )
+    / sizeof(NodeLoad)
+  );
+  UITSL_Allgatherv(
+    local.data(), // const void *sendbuf
+    send_bytes, // int sendcount
+    MPI_BYTE, // MPI_Datatype sendtype
+    res.data(), // void *recvbuf
+    recv_counts.data(), // const int recvcounts[]
+    displs.data(), // const int displs[]
+    MPI_BYTE, // MPI_Datatype recvtype
+    comm // MPI_Comm comm
+  );
+
+  return res;
+
+}
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_ASSIGN_NODELOAD_HPP_INCLUDE
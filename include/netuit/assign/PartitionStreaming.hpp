@@ -0,0 +1,593 @@
+#pragma once
+#ifndef NETUIT_ASSIGN_PARTITIONSTREAMING_HPP_INCLUDE
+#define NETUIT_ASSIGN_PARTITIONSTREAMING_HPP_INCLUDE
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <set>
+#include <stddef.h>
+#include <stdint.h>
+#include <utility>
+
+#include <mpi.h>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../uitsl/debug/safe_cast.hpp"
+#include "../../uitsl/mpi/audited_routines.hpp"
+#include "../../uitsl/mpi/comm_utils.hpp"
+#include "../../uitsl/mpi/proc_id_t.hpp"
+#include "../../uitsl/parallel/thread_utils.hpp"
+
+#include "../topology/CsrTopology.hpp"
+#include "../topology/ImplicitTopology.hpp"
+
+#include "EvaluatePartition.hpp"
+
+namespace netuit {
+
+/// How a streaming partitioner scores placing a node in a part.
+enum class StreamingObjective {
+  /// Linear deterministic greedy: neighbors already in the part, scaled by
+  /// how much room the part has left.
+  ldg,
+  /// Fennel: neighbors already in the part, less a penalty that grows with
+  /// the part's size.
+  fennel
+};
+
+namespace internal {
+
+template<typename F>
+void ForEachOutletNode(
+  const netuit::CsrTopology& topology, const size_t node_id, F&& f
+) {
+  for (const size_t edge_id : topology.GetOutputEdgeIDs( node_id )) {
+    f( topology.GetOutletNode( edge_id ) );
+  }
+}
+
+template<typename F>
+void ForEachInletNode(
+  const netuit::CsrTopology& topology, const size_t node_id, F&& f
+) {
+  for (const size_t edge_id : topology.GetInputEdgeIDs( node_id )) {
+    f( topology.GetInletNode( edge_id ) );
+  }
+}
+
+template<typename Derived, typename F>
+void ForEachOutletNode(
+  const netuit::ImplicitTopology<Derived>& topology,
+  const size_t node_id,
+  F&& f
+) {
+  const auto& self = static_cast<const Derived&>( topology );
+  for (size_t i{}; i < self.GetNumOutputs( node_id ); ++i) {
+    f( self.GetOutput( node_id, i ).outlet_node );
+  }
+}
+
+template<typename Derived, typename F>
+void ForEachInletNode(
+  const netuit::ImplicitTopology<Derived>& topology,
+  const size_t node_id,
+  F&& f
+) {
+  const auto& self = static_cast<const Derived&>( topology );
+  for (size_t i{}; i < self.GetNumInputs( node_id ); ++i) {
+    f( self.GetInput( node_id, i ).inlet_node );
+  }
+}
+
+/// Contiguous block of nodes each proc streams through.
+inline std::pair<size_t, size_t> GetStreamingBlock(
+  const size_t num_nodes, const MPI_Comm comm
+) {
+  const size_t num_procs = uitsl::get_nprocs( comm );
+  const size_t rank = uitsl::get_rank( comm );
+  return {
+    num_nodes * rank / num_procs, num_nodes * (rank + 1) / num_procs
+  };
+}
+
+/**
+ * One streaming pass that places every node in a part, with parts split
+ * into equal-sized groups and each node restricted to one group.
+ *
+ * Each proc streams through its own contiguous block of nodes, batch by
+ * batch. After each batch, procs swap the placements they just made, so
+ * each proc sees every other proc's placements up to the last batch. Every
+ * proc holds a part per node. Adjacency is read through the topology, so
+ * with a `netuit::ImplicitTopology` a proc only ever builds adjacency for the
+ * node it is placing, while a `netuit::CsrTopology` already holds the whole
+ * graph on every proc.
+ */
+class StreamingPass {
+
+  using part_t = uint32_t;
+
+  static constexpr part_t unplaced{ std::numeric_limits<part_t>::max() };
+
+  size_t num_groups;
+  size_t parts_per_group;
+  netuit::StreamingObjective objective;
+  MPI_Comm comm;
+
+  // where this proc's block falls within each group
+  size_t rank_offset;
+
+  emp::vector<part_t> parts;
+  emp::vector<double> sizes;
+  emp::vector<double> capacities;
+
+  // fennel's size penalty per group
+  emp::vector<double> alphas;
+  static constexpr double gamma{ 1.5 };
+
+  // (size, part) per group, to find the emptiest part of a group quickly
+  emp::vector<std::set<std::pair<double, part_t>>> by_size;
+
+  // neighbor count per part for the node being placed, and parts touched
+  emp::vector<double> counts;
+  emp::vector<part_t> touched;
+
+  void Grow(const part_t part) {
+    auto& group = by_size[ part / parts_per_group ];
+    group.erase( { sizes[part], part } );
+    ++sizes[part];
+    group.emplace( sizes[part], part );
+  }
+
+  void Shrink(const part_t part) {
+    auto& group = by_size[ part / parts_per_group ];
+    group.erase( { sizes[part], part } );
+    --sizes[part];
+    group.emplace( sizes[part], part );
+  }
+
+  double Score(const part_t part) const {
+    const double neighbors = counts[part];
+    switch ( objective ) {
+      case netuit::StreamingObjective::ldg:
+        return neighbors * ( 1.0 - sizes[part] / capacities[part] );
+      case netuit::StreamingObjective::fennel:
+        return neighbors - alphas[ part / parts_per_group ] * gamma
+          * std::pow( sizes[part], gamma - 1.0 );
+      default:
+        emp_assert( false );
+        return 0.0;
+    }
+  }
+
+  // is a a better pick than b?
+  bool IsBetter(const part_t a, const part_t b) const {
+    const bool a_fits = sizes[a] < capacities[a];
+    const bool b_fits = sizes[b] < capacities[b];
+    if ( a_fits != b_fits ) return a_fits;
+    if ( Score(a) != Score(b) ) return Score(a) > Score(b);
+    if ( sizes[a] != sizes[b] ) return sizes[a] < sizes[b];
+    return a < b;
+  }
+
+  template<typename TopologyType>
+  part_t Place(
+    const TopologyType& topology, const size_t node_id, const size_t group
+  ) {
+
+    const part_t first = uitsl::safe_cast<part_t>( group * parts_per_group );
+    const part_t last = uitsl::safe_cast<part_t>( first + parts_per_group );
+
+    const auto tally = [this, first, last](const size_t neighbor){
+      const part_t part = parts[neighbor];
+      if ( part < first || part >= last ) return;
+      if ( counts[part] == 0.0 ) touched.push_back( part );
+      ++counts[part];
+    };
+    ForEachOutletNode( topology, node_id, tally );
+    ForEachInletNode( topology, node_id, tally );
+
+    // untouched parts only differ by size, so the emptiest stands for them;
+    // among equally empty parts, procs start from different ones so they
+    // don't all pile into the same part before their first sync
+    const auto& candidates = by_size[group];
+    const double least = candidates.begin()->first;
+    const auto preferred = candidates.lower_bound( {
+      least, first + uitsl::safe_cast<part_t>( rank_offset )
+    } );
+    part_t res = (
+      preferred != std::end(candidates) && preferred->first == least
+    ) ? preferred->second : candidates.begin()->second;
+    for (const part_t part : touched) if ( IsBetter(part, res) ) res = part;
+
+    for (const part_t part : touched) counts[part] = 0.0;
+    touched.clear();
+
+    return res;
+
+  }
+
+  // share placements made this batch with every proc
+  void Sync(const emp::vector<std::pair<size_t, part_t>>& placed) {
+
+    using record_t = std::pair<size_t, part_t>;
+    const int send_bytes = uitsl::safe_cast<int>(
+      placed.size() * sizeof(record_t)
+    );
+    emp::vector<int> recv_counts( uitsl::get_nprocs( comm ) );
+    UITSL_Allgather(
+      &send_bytes, // const void *sendbuf
+      1, // int sendcount
+      MPI_INT, // MPI_Datatype sendtype
+      recv_counts.data(), // void *recvbuf
+      1, // int recvcount
+      MPI_INT, // MPI_Datatype recvtype
+      comm // MPI_Comm comm
+    );
+
+    emp::vector<int> displs{ 0 };
+    std::partial_sum(
+      std::begin(recv_counts),
+      std::prev( std::end(recv_counts) ),
+      std::back_inserter( displs )
+    );
+
+    emp::vector<record_t> all(
+      std::accumulate( std::begin(recv_counts), std::end(recv_counts), 0 )
+      / sizeof(record_t)
+    );
+    UITSL_Allgatherv(
+      placed.data(), // const void *sendbuf
+      send_bytes, // int sendcount
+      MPI_BYTE, // MPI_Datatype sendtype
+      all.data(), // void *recvbuf
+      recv_counts.data(), // const int recvcounts[]
+      displs.data(), // const int displs[]
+      MPI_BYTE, // MPI_Datatype recvtype
+      comm // MPI_Comm comm
+    );
+
+    // this proc's placements were applied as they were made
+    for (const auto& [node_id, part] : all) {
+      if ( parts[node_id] == unplaced ) {
+        parts[node_id] = part;
+        Grow( part );
+      }
+    }
+
+    // procs may have filled the same part at once, so every proc moves the
+    // same latest arrivals out of overfull parts
+    for (auto it = std::rbegin(all); it != std::rend(all); ++it) {
+      const auto& [node_id, part] = *it;
+      if ( sizes[part] <= capacities[part] ) continue;
+      const part_t emptiest = by_size[ part / parts_per_group ].begin()->second;
+      if ( sizes[emptiest] + 1 > capacities[emptiest] ) continue;
+      Shrink( part );
+      parts[node_id] = emptiest;
+      Grow( emptiest );
+    }
+
+  }
+
+public:
+
+  /**
+   * @param num_nodes number of nodes in the graph.
+   * @param group_sizes number of nodes that will be placed in each group.
+   * @param parts_per_group_ number of parts in each group.
+   * @param num_edges number of edges in the graph, for fennel.
+   * @param slack how far over an even share a part may grow.
+   */
+  StreamingPass(
+    const size_t num_nodes,
+    const emp::vector<size_t>& group_sizes,
+    const size_t parts_per_group_,
+    const size_t num_edges,
+    const netuit::StreamingObjective objective_,
+    const double slack,
+    const MPI_Comm comm_
+  ) : num_groups(group_sizes.size())
+  , parts_per_group(parts_per_group_)
+  , objective(objective_)
+  , comm(comm_)
+  , rank_offset(
+    parts_per_group * uitsl::get_rank( comm ) / uitsl::get_nprocs( comm )
+  )
+  , parts(num_nodes, unplaced)
+  , sizes(num_groups * parts_per_group)
+  , by_size(num_groups)
+  , counts(num_groups * parts_per_group) {
+
+    emp_assert( parts_per_group );
+    emp_assert( num_groups * parts_per_group < unplaced );
+
+    const double group_edges = static_cast<double>( num_edges ) / num_groups;
+    for (size_t group{}; group < num_groups; ++group) {
+      const double group_nodes = std::max<double>( group_sizes[group], 1.0 );
+      for (size_t i{}; i < parts_per_group; ++i) {
+        // at least an even share, so every node has somewhere to go
+        capacities.push_back( std::max(
+          std::floor( slack * group_nodes / parts_per_group ),
+          std::ceil( group_nodes / parts_per_group )
+        ) );
+        by_size[group].emplace(
+          0.0, uitsl::safe_cast<part_t>( group * parts_per_group + i )
+        );
+      }
+      // fennel's alpha = m * k^(gamma - 1) / n^gamma, per group
+      alphas.push_back( std::max( group_edges, 1.0 )
+        * std::pow( static_cast<double>( parts_per_group ), gamma - 1.0 )
+        / std::pow( group_nodes, gamma )
+      );
+    }
+
+  }
+
+  /**
+   * Place every node. Collective over comm.
+   *
+   * @param group_of which group each node must be placed in.
+   * @param batch_size nodes each proc places between syncs.
+   */
+  template<typename TopologyType>
+  const emp::vector<part_t>& Run(
+    const TopologyType& topology,
+    const std::function<size_t(size_t)>& group_of,
+    const size_t batch_size
+  ) {
+
+    emp_assert( batch_size );
+
+    const auto [begin, end] = GetStreamingBlock( parts.size(), comm );
+
+    // every proc must join every sync, even once out of nodes
+    const size_t max_block = parts.size() / uitsl::get_nprocs( comm ) + 1;
+    const size_t num_batches = ( max_block + batch_size - 1 ) / batch_size;
+
+    emp::vector<std::pair<size_t, part_t>> placed;
+    for (size_t batch{}; batch < num_batches; ++batch) {
+
+      placed.clear();
+      const size_t batch_begin = std::min( begin + batch * batch_size, end );
+      const size_t batch_end = std::min( batch_begin + batch_size, end );
+      for (size_t node_id = batch_begin; node_id < batch_end; ++node_id) {
+        const part_t part = Place( topology, node_id, group_of(node_id) );
+        parts[node_id] = part;
+        Grow( part );
+        placed.emplace_back( node_id, part );
+      }
+
+      Sync( placed );
+
+    }
+
+    return parts;
+
+  }
+
+};
+
+template<typename TopologyType>
+size_t CountEdges(const TopologyType& topology, const MPI_Comm comm) {
+
+  const auto [begin, end] = GetStreamingBlock( topology.GetSize(), comm );
+  uint64_t local{};
+  for (size_t node_id = begin; node_id < end; ++node_id) {
+    ForEachOutletNode( topology, node_id, [&local](size_t){ ++local; } );
+  }
+
+  uint64_t res;
+  UITSL_Allreduce(
+    &local, // const void *sendbuf
+    &res, // void *recvbuf
+    1, // int count
+    MPI_UINT64_T, // MPI_Datatype datatype
+    MPI_SUM, // MPI_Op op
+    comm // MPI_Comm comm
+  );
+  return res;
+
+}
+
+} // namespace internal
+
+/**
+ * Partition topology in one streaming pass, spread over every proc in
+ * comm. Collective over comm.
+ *
+ * Each proc streams a contiguous block of nodes, so numbering nodes with
+ * neighbors close together (as the generators in `netuit/arrange` do) gives
+ * better cuts. Every proc returns the same result.
+ *
+ * Adjacency is never gathered, but placements are: every proc holds a part
+ * for every node, O(nodes) memory, and receives every other proc's
+ * placements through one `MPI_Allgatherv` per batch, O(nodes) traffic per
+ * proc over the pass. Only a `netuit::ImplicitTopology` keeps the graph off
+ * every proc; a `netuit::CsrTopology` is already materialized in full on
+ * each proc that constructs it.
+ *
+ * @param num_parts number of parts to subdivide topology into.
+ * @param topology a `netuit::CsrTopology` or `netuit::ImplicitTopology`.
+ * @param objective how to score candidate parts.
+ * @param slack how far over an even share a part may grow.
+ * @param batch_size nodes each proc places between syncs; smaller batches
+ * see more recent placements from other procs but sync more often.
+ * @return part of every node.
+ */
+template<typename TopologyType>
+emp::vector<uint32_t> PartitionStreaming(
+  const size_t num_parts,
+  const TopologyType& topology,
+  const netuit::StreamingObjective objective=netuit::StreamingObjective::fennel,
+  const double slack=1.05,
+  const size_t batch_size=4096,
+  const MPI_Comm comm=MPI_COMM_WORLD
+) {
+
+  internal::StreamingPass pass(
+    topology.GetSize(),
+    { topology.GetSize() },
+    num_parts,
+    internal::CountEdges( topology, comm ),
+    objective,
+    slack,
+    comm
+  );
+  return pass.Run( topology, [](size_t){ return 0; }, batch_size );
+
+}
+
+/**
+ * Assign nodes to procs, then to threads within each proc, with two
+ * streaming passes spread over every proc in comm. Collective over comm.
+ *
+ * The second pass keeps each node on the proc the first pass gave it and
+ * only counts neighbors on that proc, so threads are cut along the proc's
+ * own internal edges. Each pass costs the memory and traffic of
+ * `PartitionStreaming`, and the returned functors share the O(nodes)
+ * placements.
+ *
+ * @return std::pair of process and thread assignments, the same on every
+ * proc.
+ */
+template<typename TopologyType>
+std::pair<
+  std::function<uitsl::proc_id_t(size_t)>,
+  std::function<uitsl::thread_id_t(size_t)>
+> GenerateStreamingAssignmentFunctors(
+  const size_t num_procs,
+  const size_t threads_per_proc,
+  const TopologyType& topology,
+  const netuit::StreamingObjective objective=netuit::StreamingObjective::fennel,
+  const double slack=1.05,
+  const size_t batch_size=4096,
+  const MPI_Comm comm=MPI_COMM_WORLD
+) {
+
+  const size_t num_edges = internal::CountEdges( topology, comm );
+
+  internal::StreamingPass proc_pass(
+    topology.GetSize(),
+    { topology.GetSize() },
+    num_procs,
+    num_edges,
+    objective,
+    slack,
+    comm
+  );
+  const auto procs = std::make_shared<const emp::vector<uint32_t>>(
+    proc_pass.Run( topology, [](size_t){ return 0; }, batch_size )
+  );
+
+  emp::vector<size_t> proc_sizes( num_procs );
+  for (const uint32_t proc : *procs) ++proc_sizes[proc];
+
+  internal::StreamingPass thread_pass(
+    topology.GetSize(),
+    proc_sizes,
+    threads_per_proc,
+    num_edges,
+    objective,
+    slack,
+    comm
+  );
+  const auto threads = std::make_shared<const emp::vector<uint32_t>>(
+    thread_pass.Run(
+      topology,
+      [&procs](const size_t node){ return (*procs)[node]; },
+      batch_size
+    )
+  );
+
+  return std::pair{
+    [procs](const size_t node){
+      return uitsl::safe_cast<uitsl::proc_id_t>( (*procs)[node] );
+    },
+    [threads, threads_per_proc](const size_t node){
+      return uitsl::thread_id_t{ (*threads)[node] % threads_per_proc };
+    }
+  };
+
+}
+
+/**
+ * Measure edge cut, communication volume, and node count imbalance of a
+ * partition, with each proc in comm scanning only its block of nodes.
+ * Collective over comm.
+ *
+ * @param topology a `netuit::CsrTopology` or `netuit::ImplicitTopology`.
+ * @param assignment part of each node, called for every node on every proc.
+ */
+template<typename TopologyType>
+netuit::PartitionReport EvaluatePartitionDistributed(
+  const TopologyType& topology,
+  const std::function<size_t(size_t)>& assignment,
+  const size_t num_parts,
+  const MPI_Comm comm=MPI_COMM_WORLD
+) {
+
+  const auto [begin, end] = internal::GetStreamingBlock(
+    topology.GetSize(), comm
+  );
+
+  // cut edges, comm volume, then node count of each part
+  emp::vector<uint64_t> local( 2 + num_parts );
+  emp::vector<size_t> destinations;
+  for (size_t node_id = begin; node_id < end; ++node_id) {
+
+    const size_t part = assignment( node_id );
+    emp_assert( part < num_parts, part, num_parts );
+    ++local[2 + part];
+
+    destinations.clear();
+    internal::ForEachOutletNode(
+      topology, node_id,
+      [&assignment, &destinations, part](const size_t neighbor){
+        const size_t neighbor_part = assignment( neighbor );
+        if ( neighbor_part != part ) destinations.push_back( neighbor_part );
+      }
+    );
+    local[0] += destinations.size();
+    std::sort( std::begin(destinations), std::end(destinations) );
+    local[1] += std::distance(
+      std::begin(destinations),
+      std::unique( std::begin(destinations), std::end(destinations) )
+    );
+
+  }
+
+  emp::vector<uint64_t> global( local.size() );
+  UITSL_Allreduce(
+    local.data(), // const void *sendbuf
+    global.data(), // void *recvbuf
+    uitsl::safe_cast<int>( local.size() ), // int count
+    MPI_UINT64_T, // MPI_Datatype datatype
+    MPI_SUM, // MPI_Op op
+    comm // MPI_Comm comm
+  );
+
+  netuit::PartitionReport res;
+  res.num_cut_edges = global[0];
+  res.edge_cut = global[0];
+  res.comm_volume = global[1];
+  const uint64_t heaviest = *std::max_element(
+    std::next( std::begin(global), 2 ), std::end(global)
+  );
+  res.imbalance.push_back(
+    topology.GetSize()
+    ? static_cast<double>( heaviest ) * num_parts / topology.GetSize()
+    : 1.0
+  );
+  return res;
+
+}
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_ASSIGN_PARTITIONSTREAMING_HPP_INCLUDE
@@ -0,0 +1,242 @@
+#pragma once
+#ifndef NETUIT_ASSIGN_PARTITIONWEIGHTS_HPP_INCLUDE
+#define NETUIT_ASSIGN_PARTITIONWEIGHTS_HPP_INCLUDE
+
+#include <fstream>
+#include <iomanip>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <stddef.h>
+#include <string>
+#include <unordered_map>
+
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../mesh/MeshNode.hpp"
+#include "../topology/CsrTopology.hpp"
+#include "../topology/Topology.hpp"
+
+namespace netuit {
+
+/**
+ * Measured load for a partitioner to balance: one or more weights per node
+ * (e.g., update time and memory) and a weight per edge (e.g., bytes sent).
+ *
+ * Weights can be set directly, accumulated from a mesh's put counters, or
+ * read from profiling files written by `Write`, one per proc. Measurements
+ * accumulate, so every proc's file can be read into the same object. Nodes
+ * and edges start at a default weight, which their first measurement
+ * replaces.
+ *
+ * Profiling files hold one record per line, `node <node_id> <weight>...`
+ * with one weight per constraint or `edge <edge_id> <weight>`. Lines starting
+ * with `#` are ignored.
+ */
+class PartitionWeights {
+
+  size_t num_nodes;
+  size_t num_constraints;
+
+  // node-major, num_nodes * num_constraints
+  emp::vector<double> node_weights;
+
+  // has node been measured yet, for any constraint?
+  emp::vector<char> node_measured;
+
+  std::unordered_map<size_t, double> edge_weights;
+
+  double default_edge_weight;
+
+  // edge id -> output's put count as of the previous AddTraffic
+  std::unordered_map<size_t, size_t> counted_puts;
+
+public:
+
+  /**
+   * @param num_nodes_ number of nodes in the topology.
+   * @param num_constraints_ number of weights per node, all starting at one.
+   * @param default_edge_weight_ weight of edges with no measurement.
+   */
+  explicit PartitionWeights(
+    const size_t num_nodes_,
+    const size_t num_constraints_=1,
+    const double default_edge_weight_=1.0
+  ) : num_nodes(num_nodes_)
+  , num_constraints(num_constraints_)
+  , node_weights(num_nodes * num_constraints, 1.0)
+  , node_measured(num_nodes)
+  , default_edge_weight(default_edge_weight_) {
+    emp_assert( num_constraints );
+  }
+
+  size_t GetNumNodes() const { return num_nodes; }
+
+  size_t GetNumConstraints() const { return num_constraints; }
+
+  double GetNodeWeight(
+    const size_t node_id, const size_t constraint=0
+  ) const {
+    emp_assert( node_id < num_nodes && constraint < num_constraints );
+    return node_weights[node_id * num_constraints + constraint];
+  }
+
+  void SetNodeWeight(
+    const size_t node_id, const double weight, const size_t constraint=0
+  ) {
+    emp_assert( node_id < num_nodes && constraint < num_constraints );
+    emp_assert( weight >= 0.0, weight );
+    if ( !node_measured[node_id] ) {
+      node_measured[node_id] = true;
+      for (size_t i{}; i < num_constraints; ++i) {
+        node_weights[node_id * num_constraints + i] = 0.0;
+      }
+    }
+    node_weights[node_id * num_constraints + constraint] = weight;
+  }
+
+  /// Accumulate weight onto a node, starting from zero the first time.
+  void AddNodeWeight(
+    const size_t node_id, const double weight, const size_t constraint=0
+  ) {
+    SetNodeWeight(
+      node_id,
+      ( node_measured[node_id] ? GetNodeWeight(node_id, constraint) : 0.0 )
+        + weight,
+      constraint
+    );
+  }
+
+  double GetEdgeWeight(const size_t edge_id) const {
+    const auto it = edge_weights.find( edge_id );
+    return it == std::end( edge_weights ) ? default_edge_weight : it->second;
+  }
+
+  /// Accumulate weight onto an edge, starting from zero the first time.
+  void AddEdgeWeight(const size_t edge_id, const double weight) {
+    emp_assert( weight >= 0.0, weight );
+    edge_weights[edge_id] += weight;
+  }
+
+  /// Weight of each edge of topology, in the order `topology.AsCSR()` lists
+  /// them.
+  emp::vector<double> GetCsrEdgeWeights(
+    const netuit::Topology& topology
+  ) const {
+    emp::vector<double> res;
+    for (const auto& node : topology) {
+      for (const auto& output : node.GetOutputs()) {
+        res.push_back( GetEdgeWeight( output.GetEdgeID() ) );
+      }
+    }
+    return res;
+  }
+
+  /// Weight of each edge of topology, in the order `topology.AsCSR()` lists
+  /// them.
+  emp::vector<double> GetCsrEdgeWeights(
+    const netuit::CsrTopology& topology
+  ) const {
+    emp::vector<double> res;
+    for (size_t node_id{}; node_id < topology.GetSize(); ++node_id) {
+      for (const size_t edge_id : topology.GetOutputEdgeIDs( node_id )) {
+        res.push_back( GetEdgeWeight( edge_id ) );
+      }
+    }
+    return res;
+  }
+
+  /**
+   * Accumulate bytes put into each output of a submesh since the previous
+   * call as edge weights, so it can be called once per step or epoch.
+   *
+   * @param submesh this proc's nodes.
+   * @param bytes_per_put payload bytes of each put. For fixed-size types
+   * this is `sizeof(T)`, but for span and vector types `sizeof(T)` is only
+   * the handle, so pass the message size, e.g., a back end's `GetSize()`
+   * times the element size.
+   */
+  template<typename ImplSpec>
+  void AddTraffic(
+    const emp::vector<netuit::MeshNode<ImplSpec>>& submesh,
+    const double bytes_per_put
+  ) {
+    for (const auto& node : submesh) {
+      for (const auto& output : node.GetOutputs()) {
+        const size_t num_puts = output.GetSuccessfulPutCount();
+        auto& num_counted = counted_puts[ output.GetEdgeID() ];
+        emp_assert( num_puts >= num_counted, num_puts, num_counted );
+        AddEdgeWeight(
+          output.GetEdgeID(), (num_puts - num_counted) * bytes_per_put
+        );
+        num_counted = num_puts;
+      }
+    }
+  }
+
+  /// Add records from a profiling file.
+  void Read(std::istream& is) {
+
+    std::string line;
+    while ( std::getline( is, line ) ) {
+
+      std::istringstream iss( line );
+      std::string kind;
+      if ( !(iss >> kind) || kind.front() == '#' ) continue;
+
+      size_t id;
+      emp_always_assert( iss >> id, line );
+
+      if ( kind == "node" ) {
+        emp_always_assert( id < num_nodes, line, num_nodes );
+        for (size_t constraint{}; constraint < num_constraints; ++constraint) {
+          double weight;
+          emp_always_assert( iss >> weight, line, num_constraints );
+          AddNodeWeight( id, weight, constraint );
+        }
+      } else if ( kind == "edge" ) {
+        double weight;
+        emp_always_assert( iss >> weight, line );
+        AddEdgeWeight( id, weight );
+      } else emp_always_assert( false, line );
+
+    }
+
+  }
+
+  void Read(const std::string& filename) {
+    std::ifstream file( filename );
+    emp_always_assert( file, filename );
+    Read( file );
+  }
+
+  /// Write records for every measured node and edge.
+  void Write(std::ostream& os) const {
+    os << std::setprecision( std::numeric_limits<double>::max_digits10 );
+    for (size_t node_id{}; node_id < num_nodes; ++node_id) {
+      if ( !node_measured[node_id] ) continue;
+      os << "node " << node_id;
+      for (size_t constraint{}; constraint < num_constraints; ++constraint) {
+        os << " " << GetNodeWeight( node_id, constraint );
+      }
+      os << '\n';
+    }
+    for (const auto& [edge_id, weight] : edge_weights) {
+      os << "edge " << edge_id << " " << weight << '\n';
+    }
+  }
+
+  void Write(const std::string& filename) const {
+    std::ofstream file( filename );
+    emp_always_assert( file, filename );
+    Write( file );
+  }
+
+};
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_ASSIGN_PARTITIONWEIGHTS_HPP_INCLUDE
@@ -0,0 +1,142 @@
+#pragma once
+#ifndef NETUIT_ASSIGN_REORDERPROCS_HPP_INCLUDE
+#define NETUIT_ASSIGN_REORDERPROCS_HPP_INCLUDE
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <map>
+#include <stddef.h>
+
+#include <mpi.h>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../uitsl/mpi/audited_routines.hpp"
+#include "../../uitsl/mpi/comm_utils.hpp"
+#include "../../uitsl/mpi/proc_id_t.hpp"
+
+#include "../topology/CsrTopology.hpp"
+#include "../topology/Topology.hpp"
+
+namespace netuit {
+
+/// Result of `netuit::ReorderProcs`.
+struct ReorderedProcs {
+
+  /// Reordered communicator, to be passed into `Mesh` and freed by caller.
+  MPI_Comm comm;
+
+  /// Node id -> rank in reordered comm.
+  std::function<uitsl::proc_id_t(size_t)> proc_assignment;
+
+  /// Node id -> rank in the original comm of the proc that now hosts node.
+  /// Lets a `Mesh` on the original comm get the same placement.
+  std::function<uitsl::proc_id_t(size_t)> base_proc_assignment;
+
+  /// Rank in reordered comm -> rank in original comm.
+  emp::vector<uitsl::proc_id_t> base_ranks;
+
+};
+
+/// Count edges from nodes assigned to proc to nodes assigned to each other
+/// proc.
+/// @param[in] topology Topology to tally, a `netuit::Topology` or
+/// `netuit::CsrTopology`.
+/// @param[in] proc_assignment Functor of node ids to proc ids.
+/// @param[in] proc Proc whose outgoing traffic to tally.
+/// @return Map of destination proc to number of edges.
+template<typename TopologyType>
+std::map<uitsl::proc_id_t, size_t> TallyProcTraffic(
+  const TopologyType& topology,
+  const std::function<uitsl::proc_id_t(size_t)>& proc_assignment,
+  const uitsl::proc_id_t proc
+) {
+  std::map<uitsl::proc_id_t, size_t> res;
+
+  const auto [x_adj, adjacency] = topology.AsCSR();
+  for (size_t node{}; node < topology.GetSize(); ++node) {
+    if ( proc_assignment(node) != proc ) continue;
+    for (int32_t i = x_adj[node]; i < x_adj[node + 1]; ++i) {
+      const uitsl::proc_id_t dest = proc_assignment( adjacency[i] );
+      if ( dest != proc ) ++res[dest];
+    }
+  }
+
+  return res;
+}
+
+/// Let MPI renumber procs so that partitions that exchange many edges land
+/// on ranks that are close together on the machine.
+///
+/// Builds a distributed graph communicator with `reorder` set from the
+/// proc-level communication graph, weighted by the number of topology edges
+/// between each pair of partitions. The partitioner's output is left as is;
+/// only which physical proc hosts each partition changes. Collective over
+/// comm.
+///
+/// @param[in] topology Topology that will be passed into `Mesh`.
+/// @param[in] proc_assignment Functor of node ids to ranks in comm.
+/// @param[in] comm Communicator to reorder.
+/// @return Reordered communicator and matching proc assignments.
+template<typename TopologyType>
+netuit::ReorderedProcs ReorderProcs(
+  const TopologyType& topology,
+  const std::function<uitsl::proc_id_t(size_t)>& proc_assignment,
+  const MPI_Comm comm=MPI_COMM_WORLD
+) {
+
+  const uitsl::proc_id_t rank = uitsl::get_rank( comm );
+
+  // this proc contributes the outgoing edges of its own partition
+  emp::vector<int> destinations;
+  emp::vector<int> weights;
+  for (const auto& [dest, num_edges] : netuit::TallyProcTraffic(
+    topology, proc_assignment, rank
+  )) {
+    emp_assert( dest < uitsl::get_nprocs( comm ) );
+    destinations.push_back( dest );
+    weights.push_back( std::min(
+      num_edges, static_cast<size_t>( std::numeric_limits<int>::max() )
+    ) );
+  }
+
+  const int source = rank;
+  const int degree = destinations.size();
+  MPI_Comm reordered;
+  UITSL_Dist_graph_create(
+    comm, // MPI_Comm comm_old
+    // procs with no outgoing traffic contribute no edges
+    destinations.empty() ? 0 : 1, // int n
+    &source, // const int sources[]
+    &degree, // const int degrees[]
+    destinations.data(), // const int destinations[]
+    weights.empty() ? MPI_WEIGHTS_EMPTY : weights.data(), // const int weights[]
+    MPI_INFO_NULL, // MPI_Info info
+    1, // int reorder
+    &reordered // MPI_Comm *comm_dist_graph
+  );
+
+  // graph vertex i (i.e., partition i) lives on rank i of the new comm
+  emp::vector<uitsl::proc_id_t> base_ranks( uitsl::get_nprocs( reordered ) );
+  for (size_t new_rank{}; new_rank < base_ranks.size(); ++new_rank) {
+    base_ranks[new_rank] = uitsl::translate_comm_rank(
+      new_rank, reordered, comm
+    );
+  }
+
+  return netuit::ReorderedProcs{
+    reordered,
+    proc_assignment,
+    [proc_assignment, base_ranks](const size_t node_id) {
+      return base_ranks[ proc_assignment(node_id) ];
+    },
+    base_ranks
+  };
+
+}
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_ASSIGN_REORDERPROCS_HPP_INCLUDE
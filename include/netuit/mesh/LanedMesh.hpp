@@ -0,0 +1,130 @@
+#pragma once
+#ifndef NETUIT_MESH_LANEDMESH_HPP_INCLUDE
+#define NETUIT_MESH_LANEDMESH_HPP_INCLUDE
+
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <stddef.h>
+
+#include <mpi.h>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../uitsl/mpi/mpi_utils.hpp"
+#include "../../uitsl/utility/assign_utils.hpp"
+
+#include "../assign/AssignIntegrated.hpp"
+#include "../topology/Topology.hpp"
+
+#include "LanedMeshNode.hpp"
+#include "Mesh.hpp"
+#include "MeshCommTable.hpp"
+
+namespace netuit {
+
+/**
+ * Mesh with a bulk lane and a priority lane over the same topology, for
+ * latency-critical control messages that must not queue behind bulk data.
+ *
+ * Each lane is a full `netuit::Mesh` with its own ImplSpec, ducts, back end,
+ * and mesh id (hence tags). The priority lane always runs on a dedicated
+ * duplicate of comm, so its receives never search past unexpected bulk
+ * messages and aggregating back ends never batch control messages with bulk
+ * ones.
+ *
+ * @tparam BulkSpec ImplSpec for the bulk lane.
+ * @tparam PrioritySpec ImplSpec for the priority lane, typically a small
+ * type over low-latency ducts.
+ */
+template<typename BulkSpec, typename PrioritySpec>
+class LanedMesh {
+
+  using node_id_t = size_t;
+  using node_t = netuit::LanedMeshNode<BulkSpec, PrioritySpec>;
+
+public:
+
+  using submesh_t = emp::vector<node_t>;
+
+private:
+
+  // constructed first so that its comm duplication is ordered the same on
+  // every proc
+  netuit::Mesh<PrioritySpec> priority;
+  netuit::Mesh<BulkSpec> bulk;
+
+  static submesh_t Zip(
+    const typename netuit::Mesh<BulkSpec>::submesh_t& bulk_submesh,
+    const typename netuit::Mesh<PrioritySpec>::submesh_t& priority_submesh
+  ) {
+    // both lanes list the same nodes in node id order
+    emp_assert( bulk_submesh.size() == priority_submesh.size() );
+
+    submesh_t res;
+    for (size_t i{}; i < bulk_submesh.size(); ++i) res.emplace_back(
+      bulk_submesh[i], priority_submesh[i]
+    );
+    return res;
+  }
+
+public:
+
+  LanedMesh(
+    const Topology& topology,
+    const std::function<uitsl::thread_id_t(node_id_t)> thread_assignment
+      =uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+    const std::function<uitsl::proc_id_t(node_id_t)> proc_assignment
+      =uitsl::AssignIntegrated<uitsl::proc_id_t>{},
+    const MPI_Comm comm=MPI_COMM_WORLD,
+    const MeshCommStrategy bulk_comm_strategy=MeshCommStrategy::shared
+  ) : priority(
+    topology,
+    thread_assignment,
+    proc_assignment,
+    std::make_shared<typename PrioritySpec::ProcBackEnd>(),
+    comm,
+    MeshCommStrategy::dedicated
+  ), bulk(
+    topology,
+    thread_assignment,
+    proc_assignment,
+    std::make_shared<typename BulkSpec::ProcBackEnd>(),
+    comm,
+    bulk_comm_strategy
+  ) { ; }
+
+  size_t GetNodeCount() const { return bulk.GetNodeCount(); }
+
+  size_t GetEdgeCount() const { return bulk.GetEdgeCount(); }
+
+  netuit::Mesh<BulkSpec>& GetBulk() { return bulk; }
+
+  netuit::Mesh<PrioritySpec>& GetPriority() { return priority; }
+
+  submesh_t GetSubmesh(const uitsl::thread_id_t tid=0) const {
+    return Zip( bulk.GetSubmesh(tid), priority.GetSubmesh(tid) );
+  }
+
+  submesh_t GetSubmesh(
+    const uitsl::thread_id_t tid,
+    const uitsl::proc_id_t pid
+  ) const {
+    return Zip( bulk.GetSubmesh(tid, pid), priority.GetSubmesh(tid, pid) );
+  }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << "priority" << std::endl;
+    ss << priority.ToString() << std::endl;
+    ss << "bulk" << std::endl;
+    ss << bulk.ToString() << std::endl;
+    return ss.str();
+  }
+
+};
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_MESH_LANEDMESH_HPP_INCLUDE
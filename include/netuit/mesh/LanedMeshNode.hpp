@@ -0,0 +1,113 @@
+#pragma once
+#ifndef NETUIT_MESH_LANEDMESHNODE_HPP_INCLUDE
+#define NETUIT_MESH_LANEDMESHNODE_HPP_INCLUDE
+
+#include <limits>
+#include <sstream>
+#include <stddef.h>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+#include "MeshNode.hpp"
+
+namespace netuit {
+
+/**
+ * A node's inputs and outputs on both lanes of a `netuit::LanedMesh`.
+ *
+ * Lanes have the same edges but carry separate ducts, so a small priority
+ * message never waits behind bulk traffic. `Service` steps a node's inputs
+ * with priority inputs drained first.
+ */
+template<typename BulkSpec, typename PrioritySpec>
+class LanedMeshNode {
+
+public:
+  using bulk_node_t = netuit::MeshNode<BulkSpec>;
+  using priority_node_t = netuit::MeshNode<PrioritySpec>;
+
+private:
+  bulk_node_t bulk;
+  priority_node_t priority;
+
+public:
+
+  LanedMeshNode(const bulk_node_t& bulk_, const priority_node_t& priority_)
+  : bulk(bulk_)
+  , priority(priority_) {
+    emp_assert( bulk.GetNodeID() == priority.GetNodeID() );
+  }
+
+  size_t GetNodeID() const { return bulk.GetNodeID(); }
+
+  bulk_node_t& GetBulk() { return bulk; }
+
+  priority_node_t& GetPriority() { return priority; }
+
+  const bulk_node_t& GetBulk() const { return bulk; }
+
+  const priority_node_t& GetPriority() const { return priority; }
+
+  /**
+   * Step every priority input until none has anything left.
+   *
+   * @param handler called as `handler(input_idx, value)` for each message.
+   * @return number of messages handled.
+   */
+  template<typename PriorityHandler>
+  size_t DrainPriority(PriorityHandler&& handler) {
+    size_t res{};
+    for (size_t i{}; i < priority.GetNumInputs(); ++i) {
+      auto& input = priority.GetInput(i);
+      for ( ; input.TryStep(); ++res ) handler( i, std::as_const(input).Get() );
+    }
+    return res;
+  }
+
+  /**
+   * Step the node's inputs, draining priority inputs first and again after
+   * each bulk message.
+   *
+   * A priority message arriving mid-service waits behind at most one bulk
+   * message, however far the bulk lane has backed up.
+   *
+   * @param on_priority called as `on_priority(input_idx, value)`.
+   * @param on_bulk called as `on_bulk(input_idx, value)`.
+   * @param bulk_budget most bulk messages to step per bulk input.
+   * @return number of messages handled across both lanes.
+   */
+  template<typename PriorityHandler, typename BulkHandler>
+  size_t Service(
+    PriorityHandler&& on_priority,
+    BulkHandler&& on_bulk,
+    const size_t bulk_budget=std::numeric_limits<size_t>::max()
+  ) {
+    size_t res{ DrainPriority( on_priority ) };
+    for (size_t i{}; i < bulk.GetNumInputs(); ++i) {
+      auto& input = bulk.GetInput(i);
+      for (size_t step{}; step < bulk_budget && input.TryStep(); ++step) {
+        on_bulk( i, std::as_const(input).Get() );
+        res += 1 + DrainPriority( on_priority );
+      }
+    }
+    return res;
+  }
+
+  std::string ToString() const {
+    std::stringstream ss;
+
+    ss << "priority" << std::endl;
+    ss << priority.ToString() << std::endl;
+
+    ss << "bulk" << std::endl;
+    ss << bulk.ToString() << std::endl;
+
+    return ss.str();
+  }
+
+};
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_MESH_LANEDMESHNODE_HPP_INCLUDE
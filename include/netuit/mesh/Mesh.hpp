@@ -2,9 +2,16 @@
 #ifndef NETUIT_MESH_MESH_HPP_INCLUDE
 #define NETUIT_MESH_MESH_HPP_INCLUDE
 
+#include <functional>
+#include <map>
+#include <memory>
 #include <ratio>
 #include <stddef.h>
+#include <string>
+#include <tuple>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
 
 #include <mpi.h>
 
@@ -17,9 +24,16 @@
 #include "../../uit/setup/InterProcAddress.hpp"
 
 #include "../assign/AssignIntegrated.hpp"
+#include "../assign/NodeLoad.hpp"
+#include "../topology/CsrTopology.hpp"
+#include "../topology/ImplicitTopology.hpp"
+#include "../topology/LocalTopology.hpp"
 #include "../topology/Topology.hpp"
 
+#include "MeshCommTable.hpp"
+#include "MeshMigration.hpp"
 #include "MeshNode.hpp"
+#include "MeshPlacement.hpp"
 #include "MeshTopology.hpp"
 
 namespace netuit {
@@ -39,6 +53,36 @@ public:
 
 };
 
+// does BackEnd have an Initialize overload callable with a communicator?
+template<typename BackEnd, typename=void>
+struct initializes_with_comm : std::false_type {};
+
+template<typename BackEnd>
+struct initializes_with_comm<BackEnd, std::void_t<
+  decltype( std::declval<BackEnd&>().Initialize( std::declval<MPI_Comm>() ) )
+>> : std::true_type {};
+
+// is BackEnd configured with a message size, e.g., uit::RuntimeSizeBackEnd?
+template<typename BackEnd, typename=void>
+struct has_runtime_size : std::false_type {};
+
+template<typename BackEnd>
+struct has_runtime_size<BackEnd, std::void_t<
+  decltype( std::declval<const BackEnd&>().HasSize() ),
+  decltype( BackEnd( std::declval<const BackEnd&>().GetSize() ) )
+>> : std::true_type {};
+
+// fresh back end with the same message size as back_end, if it has one
+template<typename BackEnd>
+std::shared_ptr<BackEnd> make_like_back_end(const BackEnd& back_end) {
+  if constexpr ( has_runtime_size<BackEnd>::value ) {
+    if ( back_end.HasSize() ) {
+      return std::make_shared<BackEnd>( back_end.GetSize() );
+    }
+  }
+  return std::make_shared<BackEnd>();
+}
+
 } // namespace internal
 
 template<typename ImplSpec>
@@ -50,12 +94,16 @@ class Mesh {
 
   size_t mesh_id;
   MPI_Comm comm;
+  MeshCommStrategy comm_strategy;
+
+  // shared with inter-process addresses, so duplicated comms outlive ducts
+  std::shared_ptr<internal::MeshCommTable> duct_comms;
 
   // node_id -> node
   internal::MeshTopology<ImplSpec> nodes;
 
-  std::function<uitsl::thread_id_t(node_id_t)> thread_assignment;
-  std::function<uitsl::proc_id_t(node_id_t)> proc_assignment;
+  // thread and proc of every node in nodes
+  internal::MeshPlacement placement;
 
   using back_end_t = typename ImplSpec::ProcBackEnd;
   std::shared_ptr<back_end_t> back_end;
@@ -76,12 +124,14 @@ class Mesh {
     const node_id_t inlet_node_id = nodes.GetOutputRegistry().at(
       input.GetEdgeID()
     );
-    const uitsl::thread_id_t inlet_thread = thread_assignment(inlet_node_id);
+    const uitsl::thread_id_t inlet_thread = placement.GetThread(inlet_node_id);
 
     const node_id_t outlet_node_id = nodes.GetInputRegistry().at(
       input.GetEdgeID()
     );
-    const uitsl::thread_id_t outlet_thread = thread_assignment(outlet_node_id);
+    const uitsl::thread_id_t outlet_thread = placement.GetThread(
+      outlet_node_id
+    );
 
     if (inlet_thread != outlet_thread) input.template EmplaceDuct<
       typename ImplSpec::ThreadDuct
@@ -107,12 +157,14 @@ class Mesh {
     const node_id_t inlet_node_id = nodes.GetOutputRegistry().at(
       input.GetEdgeID()
     );
-    const uitsl::proc_id_t inlet_proc_id = proc_assignment(inlet_node_id);
+    const uitsl::proc_id_t inlet_proc_id = placement.GetProc(inlet_node_id);
 
     const node_id_t outlet_node_id = nodes.GetInputRegistry().at(
       input.GetEdgeID()
     );
-    const uitsl::proc_id_t outlet_proc_id = proc_assignment(outlet_node_id);
+    const uitsl::proc_id_t outlet_proc_id = placement.GetProc(outlet_node_id);
+
+    if (inlet_proc_id == outlet_proc_id) return;
 
     static std::unordered_set<int> tag_checker;
     const int tag = uitsl::safe_cast<int>(
@@ -122,19 +174,21 @@ class Mesh {
     const uit::InterProcAddress addr{
       outlet_proc_id,
       inlet_proc_id,
-      thread_assignment(outlet_node_id),
-      thread_assignment(inlet_node_id),
+      placement.GetThread(outlet_node_id),
+      placement.GetThread(inlet_node_id),
       tag,
-      comm
+      duct_comms->Lookup(
+        placement.GetThread(outlet_node_id),
+        placement.GetThread(inlet_node_id)
+      ),
+      duct_comms
     };
 
-    if (inlet_proc_id != outlet_proc_id) {
-      input.template SplitDuct<
-        typename ImplSpec::ProcOutletDuct
-      >(addr, back_end);
-      // assert that generated tags are unique
-      emp_assert( tag_checker.insert(tag).second );
-    }
+    input.template SplitDuct<
+      typename ImplSpec::ProcOutletDuct
+    >(addr, back_end);
+    // assert that generated tags are unique
+    emp_assert( tag_checker.insert(tag).second );
 
   }
 
@@ -142,31 +196,172 @@ class Mesh {
     const node_id_t inlet_node_id = nodes.GetOutputRegistry().at(
       output.GetEdgeID()
     );
-    const uitsl::proc_id_t inlet_proc_id = proc_assignment(inlet_node_id);
+    const uitsl::proc_id_t inlet_proc_id = placement.GetProc(inlet_node_id);
 
     const node_id_t outlet_node_id = nodes.GetInputRegistry().at(
       output.GetEdgeID()
     );
-    const uitsl::proc_id_t outlet_proc_id = proc_assignment(outlet_node_id);
+    const uitsl::proc_id_t outlet_proc_id = placement.GetProc(outlet_node_id);
+
+    if (inlet_proc_id == outlet_proc_id) return;
 
     const uit::InterProcAddress addr{
       outlet_proc_id,
       inlet_proc_id,
-      thread_assignment(outlet_node_id),
-      thread_assignment(inlet_node_id),
+      placement.GetThread(outlet_node_id),
+      placement.GetThread(inlet_node_id),
       uitsl::safe_cast<int>(
         uitsl::sidebyside_hash<std::ratio<3, 4>>(mesh_id, output.GetEdgeID())
       ),
-      comm
+      duct_comms->Lookup(
+        placement.GetThread(outlet_node_id),
+        placement.GetThread(inlet_node_id)
+      ),
+      duct_comms
     };
 
-    if (inlet_proc_id != outlet_proc_id) output.template SplitDuct<
+    output.template SplitDuct<
       typename ImplSpec::ProcInletDuct
     >(addr, back_end);
 
 
   }
 
+  void InitializeBackEnd() {
+    // back ends that set up their own communicators need the mesh's comm
+    if constexpr (
+      internal::initializes_with_comm<back_end_t>::value
+    ) back_end->Initialize( comm );
+    else back_end->Initialize();
+  }
+
+  /**
+   * Can moves be made by re-emplacing ducts between threads on a proc? Not
+   * if any node changes proc, or if any node on an inter-process duct
+   * changes thread, because inter-process ducts are addressed by thread.
+   */
+  bool CanMigrateInPlace(
+    const std::function<uitsl::thread_id_t(node_id_t)>& thread_assignment,
+    const std::function<uitsl::proc_id_t(node_id_t)>& proc_assignment
+  ) const {
+
+    const auto is_inter_proc = [this](const edge_id_t edge_id){
+      return placement.GetProc( nodes.GetOutputRegistry().at(edge_id) )
+        != placement.GetProc( nodes.GetInputRegistry().at(edge_id) );
+    };
+
+    for (const auto& [node_id, node] : nodes) {
+      if ( proc_assignment(node_id) != placement.GetProc(node_id) ) {
+        return false;
+      }
+      if ( thread_assignment(node_id) == placement.GetThread(node_id) ) {
+        continue;
+      }
+      for (const auto& input : node.GetInputs()) {
+        if ( is_inter_proc( input.GetEdgeID() ) ) return false;
+      }
+      for (const auto& output : node.GetOutputs()) {
+        if ( is_inter_proc( output.GetEdgeID() ) ) return false;
+      }
+    }
+
+    return true;
+
+  }
+
+  void MigrateInPlace(
+    const std::function<uitsl::thread_id_t(node_id_t)>& thread_assignment,
+    const std::function<uitsl::proc_id_t(node_id_t)>& proc_assignment
+  ) {
+
+    internal::MeshPlacement next( nodes, thread_assignment, proc_assignment );
+
+    // inputs and outputs share ducts, so visiting inputs covers every duct
+    for (auto& [node_id, node] : nodes) {
+      for (auto& input : node.GetInputs()) {
+
+        const node_id_t inlet_node_id = nodes.GetOutputRegistry().at(
+          input.GetEdgeID()
+        );
+        if (
+          placement.GetProc(inlet_node_id) != placement.GetProc(node_id)
+          || (
+            next.GetThread(inlet_node_id) == placement.GetThread(inlet_node_id)
+            && next.GetThread(node_id) == placement.GetThread(node_id)
+          )
+        ) continue;
+
+        if ( next.GetThread(inlet_node_id) == next.GetThread(node_id) ) {
+          input.template EmplaceDuct<typename ImplSpec::IntraDuct>();
+        } else input.template EmplaceDuct<typename ImplSpec::ThreadDuct>();
+
+      }
+    }
+
+    placement = std::move( next );
+
+  }
+
+  void MigrateRebuild(
+    const std::function<uitsl::thread_id_t(node_id_t)>& thread_assignment,
+    const std::function<uitsl::proc_id_t(node_id_t)>& proc_assignment,
+    const std::function<std::string(node_id_t)>& pack,
+    const std::function<void(node_id_t, std::string)>& unpack,
+    const std::function<std::shared_ptr<back_end_t>()>& make_back_end
+  ) {
+
+    const uitsl::proc_id_t rank = uitsl::get_proc_id( comm );
+
+    // this proc's share of the topology, and the nodes that keep it
+    emp::vector<LocalTopology::Edge> slice;
+    emp::vector<node_id_t> kept;
+    emp::vector<std::tuple<node_id_t, uitsl::proc_id_t, std::string>> leaving;
+    for (const auto& [node_id, node] : nodes) {
+
+      if ( placement.GetProc(node_id) != rank ) continue;
+
+      const uitsl::proc_id_t destination = proc_assignment(node_id);
+      if ( destination == rank ) kept.push_back( node_id );
+      else leaving.emplace_back( node_id, destination, pack(node_id) );
+
+      for (const auto& input : node.GetInputs()) slice.push_back(
+        LocalTopology::Edge{
+          input.GetEdgeID(),
+          nodes.GetOutputRegistry().at( input.GetEdgeID() ),
+          node_id
+        }
+      );
+      for (const auto& output : node.GetOutputs()) slice.push_back(
+        LocalTopology::Edge{
+          output.GetEdgeID(),
+          node_id,
+          nodes.GetInputRegistry().at( output.GetEdgeID() )
+        }
+      );
+
+    }
+
+    auto arrivals = internal::ExchangeNodeStates( leaving, comm );
+    for (const auto& [node_id, state] : arrivals) kept.push_back( node_id );
+
+    // fresh ducts, comms, and back end under a new mesh id, so that tags
+    // can't collide with messages still in flight on the old ducts
+    // (back ends are initialized once, so the old one can't be reused)
+    *this = Mesh{
+      LocalTopology::Scatter( slice, std::move(kept), proc_assignment, comm ),
+      thread_assignment,
+      proc_assignment,
+      make_back_end
+        ? make_back_end()
+        : internal::make_like_back_end( std::as_const(*back_end) ),
+      comm,
+      comm_strategy
+    };
+
+    for (auto& [node_id, state] : arrivals) unpack( node_id, std::move(state) );
+
+  }
+
 
 public:
 
@@ -178,23 +373,116 @@ public:
       =uitsl::AssignIntegrated<uitsl::proc_id_t>{},
     std::shared_ptr<back_end_t> back_end_=std::make_shared<back_end_t>(),
     const MPI_Comm comm_=MPI_COMM_WORLD,
+    const MeshCommStrategy comm_strategy_=MeshCommStrategy::shared,
     const size_t mesh_id_=internal::MeshIDCounter::Generate()
   )
   : mesh_id(mesh_id_)
   , comm(comm_)
+  , comm_strategy(comm_strategy_)
+  , duct_comms(std::make_shared<internal::MeshCommTable>(
+    topology, thread_assignment_, proc_assignment_, comm, comm_strategy
+  ))
   , nodes(topology, proc_assignment_, comm)
-  , thread_assignment(thread_assignment_)
-  , proc_assignment(proc_assignment_)
+  , placement(nodes, thread_assignment_, proc_assignment_)
   , back_end(back_end_) {
     InitializeInterThreadDucts();
     InitializeInterProcDucts();
-    back_end->Initialize();
+    InitializeBackEnd();
   }
 
+  /**
+   * Build from only this proc's share of the topology, so setup time and
+   * memory scale with the nodes on this proc and their neighbors instead of
+   * with the whole graph. Collective over comm.
+   *
+   * Assignment functors are only called for nodes in topology and their
+   * neighbors.
+   */
+  Mesh(
+    const LocalTopology & topology,
+    const std::function<uitsl::thread_id_t(node_id_t)> thread_assignment_
+      =uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+    const std::function<uitsl::proc_id_t(node_id_t)> proc_assignment_
+      =uitsl::AssignIntegrated<uitsl::proc_id_t>{},
+    std::shared_ptr<back_end_t> back_end_=std::make_shared<back_end_t>(),
+    const MPI_Comm comm_=MPI_COMM_WORLD,
+    const MeshCommStrategy comm_strategy_=MeshCommStrategy::shared,
+    const size_t mesh_id_=internal::MeshIDCounter::Generate()
+  )
+  : mesh_id(mesh_id_)
+  , comm(comm_)
+  , comm_strategy(comm_strategy_)
+  , duct_comms(std::make_shared<internal::MeshCommTable>(
+    topology, thread_assignment_, proc_assignment_, comm, comm_strategy
+  ))
+  , nodes(topology, proc_assignment_, comm)
+  , placement(nodes, thread_assignment_, proc_assignment_)
+  , back_end(back_end_) {
+    InitializeInterThreadDucts();
+    InitializeInterProcDucts();
+    InitializeBackEnd();
+  }
+
+  /**
+   * Build from a CSR topology by extracting this proc's share, so only the
+   * local part of the mesh is materialized. As with a `LocalTopology`,
+   * GetEdgeCount only counts edges with an end on this proc.
+   */
+  Mesh(
+    const CsrTopology & topology,
+    const std::function<uitsl::thread_id_t(node_id_t)> thread_assignment_
+      =uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+    const std::function<uitsl::proc_id_t(node_id_t)> proc_assignment_
+      =uitsl::AssignIntegrated<uitsl::proc_id_t>{},
+    std::shared_ptr<back_end_t> back_end_=std::make_shared<back_end_t>(),
+    const MPI_Comm comm_=MPI_COMM_WORLD,
+    const MeshCommStrategy comm_strategy=MeshCommStrategy::shared,
+    const size_t mesh_id_=internal::MeshIDCounter::Generate()
+  ) : Mesh(
+    LocalTopology::Extract( topology, proc_assignment_, comm_ ),
+    thread_assignment_,
+    proc_assignment_,
+    back_end_,
+    comm_,
+    comm_strategy,
+    mesh_id_
+  ) { }
+
+  /**
+   * Build from a topology computed on demand, so only this proc's nodes and
+   * their edges are ever materialized. As with a `LocalTopology`,
+   * GetEdgeCount only counts edges with an end on this proc.
+   */
+  template<typename Derived>
+  Mesh(
+    const ImplicitTopology<Derived> & topology,
+    const std::function<uitsl::thread_id_t(node_id_t)> thread_assignment_
+      =uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+    const std::function<uitsl::proc_id_t(node_id_t)> proc_assignment_
+      =uitsl::AssignIntegrated<uitsl::proc_id_t>{},
+    std::shared_ptr<back_end_t> back_end_=std::make_shared<back_end_t>(),
+    const MPI_Comm comm_=MPI_COMM_WORLD,
+    const MeshCommStrategy comm_strategy=MeshCommStrategy::shared,
+    const size_t mesh_id_=internal::MeshIDCounter::Generate()
+  ) : Mesh(
+    topology.GetLocalTopology( proc_assignment_, comm_ ),
+    thread_assignment_,
+    proc_assignment_,
+    back_end_,
+    comm_,
+    comm_strategy,
+    mesh_id_
+  ) { }
+
+  /// How many duplicates of comm were made for inter-process ducts?
+  size_t GetNumDuctComms() const { return duct_comms->GetNumDuplicates(); }
+
   // TODO rename GetNumNodes
   size_t GetNodeCount() const { return nodes.GetNodeCount(); }
 
   // TODO rename GetNumEdges
+  /// Meshes built from a LocalTopology only count edges with an end on this
+  /// proc.
   size_t GetEdgeCount() const { return nodes.GetEdgeCount(); }
 
   using submesh_t = emp::vector<node_t>;
@@ -210,13 +498,108 @@ public:
     submesh_t res;
     for (const auto& [node_id, node] : nodes) {
       if (
-        thread_assignment(node_id) == tid
-        && proc_assignment(node_id) == pid
+        placement.GetThread(node_id) == tid
+        && placement.GetProc(node_id) == pid
       ) res.push_back(node);
     }
     return res;
   }
 
+  /**
+   * Move nodes to new threads and procs at a step boundary. Collective over
+   * comm, and every proc must pass the same assignments.
+   *
+   * If every move stays on its proc and no moved node has an inter-process
+   * duct, affected ducts are re-emplaced in place, as intra or thread ducts,
+   * and everything else is left untouched. Otherwise this proc's share of
+   * the mesh is rebuilt around its new nodes, re-splitting inter-process
+   * ducts, and messages still in flight are dropped. Either way, submeshes
+   * must be fetched again afterwards.
+   *
+   * A rebuilt mesh is built from a `LocalTopology`, so afterwards
+   * GetEdgeCount only counts edges with an end on this proc, even if the
+   * mesh was built from a whole `Topology`. It also gets a new back end.
+   *
+   * @param pack called for each node leaving this proc, returns the node's
+   * serialized state.
+   * @param unpack called with the state of each node arriving on this proc.
+   * @param make_back_end called for the back end of a rebuilt mesh. If
+   * empty, the new back end is default constructed, keeping the current
+   * back end's message size if it has one. Pass a factory for other
+   * configuration, or to share one fresh back end between meshes.
+   */
+  void Migrate(
+    const std::function<uitsl::thread_id_t(node_id_t)>& thread_assignment,
+    const std::function<uitsl::proc_id_t(node_id_t)>& proc_assignment,
+    const std::function<std::string(node_id_t)>& pack
+      =[](node_id_t){ return std::string{}; },
+    const std::function<void(node_id_t, std::string)>& unpack
+      =[](node_id_t, std::string){},
+    const std::function<std::shared_ptr<back_end_t>()>& make_back_end={}
+  ) {
+    if ( internal::AllAgree(
+      CanMigrateInPlace(thread_assignment, proc_assignment), comm
+    ) ) MigrateInPlace(thread_assignment, proc_assignment);
+    else MigrateRebuild(
+      thread_assignment, proc_assignment, pack, unpack, make_back_end
+    );
+  }
+
+  /**
+   * Gather per-node loads from every proc, ask balancer for a new placement,
+   * and migrate to it. Collective over comm.
+   *
+   * @param balancer called as `balancer(loads, num_procs, threads_per_proc)`
+   * with a `netuit::NodeLoad` for every node, must return them with new
+   * placements and give the same answer on every proc, e.g.,
+   * `netuit::GreedyBalancer`.
+   * @param node_load measured cost of each node on this proc, e.g., seconds
+   * per update.
+   * @param threads_per_proc number of threads nodes can be placed on.
+   * @param make_back_end as for `Migrate`.
+   */
+  template<typename Balancer>
+  void Rebalance(
+    const Balancer& balancer,
+    const std::function<double(node_id_t)>& node_load,
+    const size_t threads_per_proc,
+    const std::function<std::string(node_id_t)>& pack
+      =[](node_id_t){ return std::string{}; },
+    const std::function<void(node_id_t, std::string)>& unpack
+      =[](node_id_t, std::string){},
+    const std::function<std::shared_ptr<back_end_t>()>& make_back_end={}
+  ) {
+
+    const uitsl::proc_id_t rank = uitsl::get_proc_id( comm );
+
+    emp::vector<netuit::NodeLoad> local;
+    for (const auto& [node_id, node] : nodes) {
+      if ( placement.GetProc(node_id) == rank ) local.push_back(
+        netuit::NodeLoad{
+          node_id, rank, placement.GetThread(node_id), node_load(node_id)
+        }
+      );
+    }
+
+    std::unordered_map<
+      node_id_t, std::pair<uitsl::proc_id_t, uitsl::thread_id_t>
+    > lookup;
+    for (const auto& load : balancer(
+      netuit::GatherNodeLoads( local, comm ),
+      uitsl::get_nprocs( comm ),
+      threads_per_proc
+    )) lookup.emplace( load.node_id, std::pair{ load.proc, load.thread } );
+
+    Migrate(
+      [&lookup](const node_id_t node_id){ return lookup.at(node_id).second; },
+      [&lookup](const node_id_t node_id){ return lookup.at(node_id).first; },
+      pack,
+      unpack,
+      make_back_end
+    );
+
+  }
+
   std::string ToString() const {
     std::stringstream ss;
     ss << nodes.ToString() << std::endl;
@@ -0,0 +1,214 @@
+#pragma once
+#ifndef NETUIT_MESH_MESHCOMMTABLE_HPP_INCLUDE
+#define NETUIT_MESH_MESHCOMMTABLE_HPP_INCLUDE
+
+#include <functional>
+#include <iterator>
+#include <map>
+#include <numeric>
+#include <set>
+#include <stddef.h>
+#include <utility>
+
+#include <mpi.h>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../uitsl/debug/safe_cast.hpp"
+#include "../../uitsl/mpi/audited_routines.hpp"
+#include "../../uitsl/mpi/comm_utils.hpp"
+#include "../../uitsl/mpi/proc_id_t.hpp"
+#include "../../uitsl/parallel/thread_utils.hpp"
+
+#include "../topology/LocalTopology.hpp"
+#include "../topology/Topology.hpp"
+
+namespace netuit {
+
+/// Which communicator each inter-process duct in a `Mesh` uses.
+enum class MeshCommStrategy {
+  /// All ducts use the mesh's comm.
+  shared,
+  /// Ducts get a duplicate of the mesh's comm per outlet (receiving) thread,
+  /// so each thread matches against its own message queue.
+  per_outlet_thread,
+  /// Ducts get a duplicate of the mesh's comm per (outlet thread, inlet
+  /// thread) pair, so no two threads on a proc send or receive on the same
+  /// comm.
+  per_thread_pair,
+  /// All ducts share one duplicate of the mesh's comm, so they never match
+  /// against messages from other meshes on that comm.
+  dedicated
+};
+
+namespace internal {
+
+/**
+ * Duplicates of a mesh's communicator, keyed by the threads at either end of
+ * an inter-process duct.
+ *
+ * Duplication is collective, so every proc must duplicate the same comms in
+ * the same order. Procs either scan the whole topology or, given only their
+ * local share, gather thread pairs from each other. Only thread pairs that
+ * actually share an inter-process edge get a comm. Duplicates are freed on
+ * destruction.
+ */
+class MeshCommTable {
+
+  using key_t = std::pair<uitsl::thread_id_t, uitsl::thread_id_t>;
+
+  MPI_Comm comm;
+
+  netuit::MeshCommStrategy strategy;
+
+  std::map<key_t, MPI_Comm> dups;
+
+  key_t MakeKey(
+    const uitsl::thread_id_t outlet_thread,
+    const uitsl::thread_id_t inlet_thread
+  ) const {
+    switch (strategy) {
+      case netuit::MeshCommStrategy::per_outlet_thread:
+        return { outlet_thread, 0 };
+      case netuit::MeshCommStrategy::per_thread_pair:
+        return { outlet_thread, inlet_thread };
+      case netuit::MeshCommStrategy::dedicated:
+        return { 0, 0 };
+      default:
+        emp_assert( false );
+        return {};
+    }
+  }
+
+  std::set<key_t> GatherKeys(const std::set<key_t>& local_keys) const {
+
+    const emp::vector<key_t> send( std::begin(local_keys), std::end(local_keys) );
+    const int send_bytes = uitsl::safe_cast<int>( send.size() * sizeof(key_t) );
+
+    emp::vector<int> recv_counts( uitsl::get_nprocs( comm ) );
+    UITSL_Allgather(
+      &send_bytes, // const void *sendbuf
+      1, // int sendcount
+      MPI_INT, // MPI_Datatype sendtype
+      recv_counts.data(), // void *recvbuf
+      1, // int recvcount
+      MPI_INT, // MPI_Datatype recvtype
+      comm // MPI_Comm comm
+    );
+
+    emp::vector<int> displs{ 0 };
+    std::partial_sum(
+      std::begin(recv_counts),
+      std::prev( std::end(recv_counts) ),
+      std::back_inserter( displs )
+    );
+
+    emp::vector<key_t> recv(
+      std::accumulate( std::begin(recv_counts), std::end(recv_counts), 0 )
+      / sizeof(key_t)
+    );
+    UITSL_Allgatherv(
+      send.data(), // const void *sendbuf
+      send_bytes, // int sendcount
+      MPI_BYTE, // MPI_Datatype sendtype
+      recv.data(), // void *recvbuf
+      recv_counts.data(), // const int recvcounts[]
+      displs.data(), // const int displs[]
+      MPI_BYTE, // MPI_Datatype recvtype
+      comm // MPI_Comm comm
+    );
+
+    return std::set<key_t>( std::begin(recv), std::end(recv) );
+
+  }
+
+  // collective, keys must be the same on every proc
+  void Duplicate(const std::set<key_t>& keys) {
+    for (const auto& key : keys) dups.emplace(
+      key, uitsl::duplicate_comm( comm )
+    );
+  }
+
+public:
+
+  MeshCommTable(
+    const netuit::Topology& topology,
+    const std::function<uitsl::thread_id_t(size_t)>& thread_assignment,
+    const std::function<uitsl::proc_id_t(size_t)>& proc_assignment,
+    const MPI_Comm comm_,
+    const netuit::MeshCommStrategy strategy_
+  ) : comm(comm_)
+  , strategy(strategy_) {
+
+    if (strategy == netuit::MeshCommStrategy::shared) return;
+
+    std::set<key_t> keys;
+    const auto [x_adj, adjacency] = topology.AsCSR();
+    for (size_t inlet_node{}; inlet_node < topology.GetSize(); ++inlet_node) {
+      for (int32_t i = x_adj[inlet_node]; i < x_adj[inlet_node + 1]; ++i) {
+        const size_t outlet_node = adjacency[i];
+        if (
+          proc_assignment(inlet_node) != proc_assignment(outlet_node)
+        ) keys.insert( MakeKey(
+          thread_assignment(outlet_node), thread_assignment(inlet_node)
+        ) );
+      }
+    }
+
+    Duplicate( keys );
+
+  }
+
+  /**
+   * Only scans edges on this proc, then gathers every proc's thread pairs so
+   * that all procs duplicate the same comms in the same order.
+   */
+  MeshCommTable(
+    const netuit::LocalTopology& topology,
+    const std::function<uitsl::thread_id_t(size_t)>& thread_assignment,
+    const std::function<uitsl::proc_id_t(size_t)>& proc_assignment,
+    const MPI_Comm comm_,
+    const netuit::MeshCommStrategy strategy_
+  ) : comm(comm_)
+  , strategy(strategy_) {
+
+    if (strategy == netuit::MeshCommStrategy::shared) return;
+
+    std::set<key_t> local_keys;
+    for (const auto& edge : topology.GetEdges()) {
+      if (
+        proc_assignment(edge.inlet_node) != proc_assignment(edge.outlet_node)
+      ) local_keys.insert( MakeKey(
+        thread_assignment(edge.outlet_node), thread_assignment(edge.inlet_node)
+      ) );
+    }
+
+    Duplicate( GatherKeys( local_keys ) );
+
+  }
+
+  ~MeshCommTable() { for (auto& [key, dup] : dups) UITSL_Comm_free( &dup ); }
+
+  MeshCommTable(const MeshCommTable&) = delete;
+
+  MeshCommTable& operator=(const MeshCommTable&) = delete;
+
+  /// Get comm for an inter-process duct between these threads.
+  MPI_Comm Lookup(
+    const uitsl::thread_id_t outlet_thread,
+    const uitsl::thread_id_t inlet_thread
+  ) const {
+    if (strategy == netuit::MeshCommStrategy::shared) return comm;
+    return dups.at( MakeKey(outlet_thread, inlet_thread) );
+  }
+
+  size_t GetNumDuplicates() const { return dups.size(); }
+
+};
+
+} // namespace internal
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_MESH_MESHCOMMTABLE_HPP_INCLUDE
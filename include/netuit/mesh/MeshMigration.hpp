@@ -0,0 +1,126 @@
+#pragma once
+#ifndef NETUIT_MESH_MESHMIGRATION_HPP_INCLUDE
+#define NETUIT_MESH_MESHMIGRATION_HPP_INCLUDE
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <numeric>
+#include <stddef.h>
+#include <string>
+#include <tuple>
+
+#include <mpi.h>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../uitsl/debug/safe_cast.hpp"
+#include "../../uitsl/mpi/audited_routines.hpp"
+#include "../../uitsl/mpi/comm_utils.hpp"
+#include "../../uitsl/mpi/proc_id_t.hpp"
+
+namespace netuit {
+namespace internal {
+
+/// Is condition true on every proc? Collective over comm.
+inline bool AllAgree(const bool condition, const MPI_Comm comm) {
+  int local = condition;
+  int res;
+  UITSL_Allreduce(
+    &local, // const void *sendbuf
+    &res, // void *recvbuf
+    1, // int count
+    MPI_INT, // MPI_Datatype datatype
+    MPI_LAND, // MPI_Op op
+    comm // MPI_Comm comm
+  );
+  return res;
+}
+
+/**
+ * Send serialized node states to the procs nodes are moving to, with one
+ * all-to-all exchange. Collective over comm.
+ *
+ * @param outgoing (node_id, destination proc, state) for each node leaving
+ * this proc.
+ * @return node_id -> state for each node arriving on this proc.
+ */
+inline std::map<size_t, std::string> ExchangeNodeStates(
+  const emp::vector<
+    std::tuple<size_t, uitsl::proc_id_t, std::string>
+  >& outgoing,
+  const MPI_Comm comm
+) {
+
+  const size_t num_procs = uitsl::get_nprocs( comm );
+
+  // each record is node id, state size, then state
+  emp::vector<std::string> buckets( num_procs );
+  for (const auto& [node_id, proc, state] : outgoing) {
+    emp_assert( uitsl::safe_cast<size_t>( proc ) < num_procs, proc );
+    const size_t header[2]{ node_id, state.size() };
+    buckets[proc].append(
+      reinterpret_cast<const char*>( header ), sizeof(header)
+    );
+    buckets[proc] += state;
+  }
+
+  emp::vector<int> send_counts, send_displs;
+  std::string send_buffer;
+  for (const auto& bucket : buckets) {
+    send_displs.push_back( uitsl::safe_cast<int>( send_buffer.size() ) );
+    send_counts.push_back( uitsl::safe_cast<int>( bucket.size() ) );
+    send_buffer += bucket;
+  }
+
+  emp::vector<int> recv_counts( num_procs );
+  UITSL_Alltoall(
+    send_counts.data(), // const void *sendbuf
+    1, // int sendcount
+    MPI_INT, // MPI_Datatype sendtype
+    recv_counts.data(), // void *recvbuf
+    1, // int recvcount
+    MPI_INT, // MPI_Datatype recvtype
+    comm // MPI_Comm comm
+  );
+
+  emp::vector<int> recv_displs{ 0 };
+  std::partial_sum(
+    std::begin(recv_counts),
+    std::prev( std::end(recv_counts) ),
+    std::back_inserter( recv_displs )
+  );
+
+  std::string recv_buffer( std::accumulate(
+    std::begin(recv_counts), std::end(recv_counts), size_t{}
+  ), '\0' );
+  UITSL_Alltoallv(
+    send_buffer.data(), // const void *sendbuf
+    send_counts.data(), // const int sendcounts[]
+    send_displs.data(), // const int sdispls[]
+    MPI_BYTE, // MPI_Datatype sendtype
+    recv_buffer.data(), // void *recvbuf
+    recv_counts.data(), // const int recvcounts[]
+    recv_displs.data(), // const int rdispls[]
+    MPI_BYTE, // MPI_Datatype recvtype
+    comm // MPI_Comm comm
+  );
+
+  std::map<size_t, std::string> res;
+  for (size_t pos{}; pos < recv_buffer.size(); ) {
+    size_t header[2];
+    std::memcpy( header, recv_buffer.data() + pos, sizeof(header) );
+    pos += sizeof(header);
+    res.emplace( header[0], recv_buffer.substr( pos, header[1] ) );
+    pos += header[1];
+  }
+  return res;
+
+}
+
+} // namespace internal
+} // namespace netuit
+
+#endif // #ifndef NETUIT_MESH_MESHMIGRATION_HPP_INCLUDE
@@ -0,0 +1,83 @@
+#pragma once
+#ifndef NETUIT_MESH_MESHPLACEMENT_HPP_INCLUDE
+#define NETUIT_MESH_MESHPLACEMENT_HPP_INCLUDE
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <stddef.h>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../uitsl/mpi/proc_id_t.hpp"
+#include "../../uitsl/parallel/thread_utils.hpp"
+
+namespace netuit {
+namespace internal {
+
+/**
+ * Thread and proc of every node a mesh touches on this proc, in dense
+ * arrays.
+ *
+ * Assignment functors are called once per node at setup instead of once per
+ * lookup, so expensive assignments (e.g., partitioner output held in a map)
+ * are only paid for the local share of the mesh.
+ */
+class MeshPlacement {
+
+  using node_id_t = size_t;
+
+  // sorted
+  emp::vector<node_id_t> node_ids;
+
+  // aligned with node_ids
+  emp::vector<uitsl::thread_id_t> threads;
+  emp::vector<uitsl::proc_id_t> procs;
+
+  size_t Find(const node_id_t node_id) const {
+    const auto it = std::lower_bound(
+      std::begin(node_ids), std::end(node_ids), node_id
+    );
+    emp_assert( it != std::end(node_ids) && *it == node_id, node_id );
+    return std::distance( std::begin(node_ids), it );
+  }
+
+public:
+
+  MeshPlacement() = default;
+
+  /**
+   * @param nodes sorted range of (node_id, node) pairs, e.g., a
+   * `MeshTopology`.
+   */
+  template<typename Nodes>
+  MeshPlacement(
+    const Nodes& nodes,
+    const std::function<uitsl::thread_id_t(node_id_t)>& thread_assignment,
+    const std::function<uitsl::proc_id_t(node_id_t)>& proc_assignment
+  ) {
+    for (const auto& [node_id, node] : nodes) {
+      emp_assert( node_ids.empty() || node_ids.back() < node_id );
+      node_ids.push_back( node_id );
+      threads.push_back( thread_assignment(node_id) );
+      procs.push_back( proc_assignment(node_id) );
+    }
+  }
+
+  uitsl::thread_id_t GetThread(const node_id_t node_id) const {
+    return threads[ Find(node_id) ];
+  }
+
+  uitsl::proc_id_t GetProc(const node_id_t node_id) const {
+    return procs[ Find(node_id) ];
+  }
+
+  size_t GetSize() const { return node_ids.size(); }
+
+};
+
+} // namespace internal
+} // namespace netuit
+
+#endif // #ifndef NETUIT_MESH_MESHPLACEMENT_HPP_INCLUDE
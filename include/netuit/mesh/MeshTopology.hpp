@@ -14,6 +14,7 @@
 #include "../../uit/ducts/Duct.hpp"
 #include "../../uit/fixtures/Conduit.hpp"
 
+#include "../topology/LocalTopology.hpp"
 #include "../topology/Topology.hpp"
 
 #include "MeshNode.hpp"
@@ -66,6 +67,18 @@ class MeshTopology {
     }
   }
 
+  void InitializeRegistries(const netuit::LocalTopology& topology) {
+    for (const auto& edge : topology.GetEdges()) {
+      edge_registry.insert( std::end(edge_registry), edge.edge_id );
+      input_registry.emplace_hint(
+        std::end(input_registry), edge.edge_id, edge.outlet_node
+      );
+      output_registry.emplace_hint(
+        std::end(output_registry), edge.edge_id, edge.inlet_node
+      );
+    }
+  }
+
   void InitializeNodes(
     const netuit::Topology& topology,
     const std::function<uitsl::proc_id_t(node_id_t)> proc_assignment,
@@ -89,12 +102,12 @@ class MeshTopology {
   }
 
   void InitializeEdges(
-    const netuit::Topology& topology,
     const std::function<uitsl::proc_id_t(node_id_t)> proc_assignment,
     const MPI_Comm& comm
   ) {
 
     std::map<edge_id_t, uit::Conduit<ImplSpec>> edge_conduits;
+    const uitsl::proc_id_t rank = uitsl::get_proc_id(comm);
 
     // initialize inputs first...
     for (const edge_id_t edge : edge_registry) {
@@ -103,8 +116,8 @@ class MeshTopology {
       // only construct infrastructure relevant to this proc
       // (but do need nodes that are connected to nodes on this proc)
       if (
-        proc_assignment(input_id) == uitsl::get_proc_id(comm)
-        || proc_assignment(output_id) == uitsl::get_proc_id(comm)
+        proc_assignment(input_id) == rank
+        || proc_assignment(output_id) == rank
       ) {
         auto& conduit = edge_conduits[ edge ];
 
@@ -129,8 +142,8 @@ class MeshTopology {
       // only construct infrastructure relevant to this proc
       // (but do need nodes that are connected to nodes on this proc)
       if (
-        proc_assignment(input_id) == uitsl::get_proc_id(comm)
-        || proc_assignment(output_id) == uitsl::get_proc_id(comm)
+        proc_assignment(input_id) == rank
+        || proc_assignment(output_id) == rank
       ) {
         auto& conduit = edge_conduits.at( edge );
 
@@ -155,7 +168,7 @@ public:
   ) {
     InitializeRegistries(topology);
     InitializeNodes(topology, proc_assignment, comm);
-    InitializeEdges(topology, proc_assignment, comm);
+    InitializeEdges(proc_assignment, comm);
 
     // ensure that input, output registries have same keys as edge registry
     emp_assert(
@@ -185,6 +198,26 @@ public:
 
   }
 
+  /**
+   * Only materializes nodes and edges on this proc and their neighbors, so
+   * setup scales with the local share of the mesh. Edge registries then only
+   * hold edges with an end on this proc.
+   */
+  MeshTopology(
+    const netuit::LocalTopology& topology,
+    const std::function<uitsl::proc_id_t(node_id_t)> proc_assignment
+      =uitsl::AssignIntegrated<uitsl::proc_id_t>{},
+    const MPI_Comm comm=MPI_COMM_WORLD
+  ) {
+    // edges arrive sorted, so registries fill by appending
+    InitializeRegistries(topology);
+    for (const node_id_t node_id : topology.GetNodes()) {
+      emp_assert( proc_assignment(node_id) == uitsl::get_proc_id(comm) );
+      InitializeNode(node_id);
+    }
+    InitializeEdges(proc_assignment, comm);
+  }
+
   size_t GetNodeCount() const { return nodes.size(); }
 
   size_t GetEdgeCount() const { return edge_registry.size(); }
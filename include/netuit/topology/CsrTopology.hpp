@@ -0,0 +1,508 @@
+#pragma once
+#ifndef NETUIT_TOPOLOGY_CSRTOPOLOGY_HPP_INCLUDE
+#define NETUIT_TOPOLOGY_CSRTOPOLOGY_HPP_INCLUDE
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+#include "../../../third-party/Empirical/include/emp/polyfill/span.hpp"
+
+#include "../../uitsl/datastructs/MappedFile.hpp"
+#include "../../uitsl/debug/safe_cast.hpp"
+
+#include "TopoNode.hpp"
+#include "Topology.hpp"
+
+namespace netuit {
+
+/**
+ * Topology stored as flat compressed sparse row (CSR) arrays.
+ *
+ * Each node's output and input edge IDs are contiguous slices of two flat
+ * arrays, and each edge's end nodes are held in tables indexed by edge ID,
+ * so looking up either end of an edge is O(1). Memory is a handful of words
+ * per edge, with no per-node allocations or hash tables.
+ *
+ * Edge IDs should be roughly dense, since end node tables span from the
+ * smallest to the largest edge ID. Topology factories number edges from zero,
+ * so this holds for their output and subtopologies of it.
+ *
+ * Arrays are immutable and shared between copies. They can also be mapped
+ * straight from a binary file, so loading a topology does no parsing.
+ */
+class CsrTopology {
+
+public:
+
+  using node_id_t = size_t;
+  using edge_id_t = size_t;
+
+  /// End node of edge IDs absent from the topology.
+  static constexpr node_id_t npos = std::numeric_limits<node_id_t>::max();
+
+private:
+
+  struct Buffers {
+    emp::vector<size_t> out_offsets{ 0 };
+    emp::vector<edge_id_t> out_edge_ids;
+    emp::vector<size_t> in_offsets{ 0 };
+    emp::vector<edge_id_t> in_edge_ids;
+    emp::vector<node_id_t> edge_inlets;
+    emp::vector<node_id_t> edge_outlets;
+    edge_id_t edge_id_base{};
+    emp::vector<node_id_t> canonical_ids;
+  };
+
+  // owns the arrays viewed below, either Buffers or a file mapping,
+  // immutable so that copies can share it
+  std::shared_ptr<const void> storage;
+
+  // output edge IDs of node i are out_edge_ids[out_offsets[i]:out_offsets[i+1]]
+  std::span<const size_t> out_offsets;
+  std::span<const edge_id_t> out_edge_ids;
+
+  // input edge IDs of node i are in_edge_ids[in_offsets[i]:in_offsets[i+1]]
+  std::span<const size_t> in_offsets;
+  std::span<const edge_id_t> in_edge_ids;
+
+  // edge_id - edge_id_base -> node holding the edge's inlet (output)
+  std::span<const node_id_t> edge_inlets;
+  // edge_id - edge_id_base -> node holding the edge's outlet (input)
+  std::span<const node_id_t> edge_outlets;
+  edge_id_t edge_id_base{};
+
+  // node id -> canonical node id, empty if identity
+  std::span<const node_id_t> canonical_ids;
+
+  static void InitializeEdgeTables(Buffers& buffers) {
+
+    // every edge has both ends
+    emp_assert( buffers.in_edge_ids.size() == buffers.out_edge_ids.size() );
+
+    if ( buffers.out_edge_ids.empty() ) return;
+
+    const auto [min_it, max_it] = std::minmax_element(
+      std::begin( buffers.out_edge_ids ), std::end( buffers.out_edge_ids )
+    );
+    const edge_id_t base = *min_it;
+    buffers.edge_id_base = base;
+    buffers.edge_inlets.assign( *max_it - base + 1, npos );
+    buffers.edge_outlets.assign( *max_it - base + 1, npos );
+
+    const size_t num_nodes = buffers.out_offsets.size() - 1;
+    for (node_id_t node_id{}; node_id < num_nodes; ++node_id) {
+      for (
+        size_t i = buffers.out_offsets[node_id];
+        i < buffers.out_offsets[node_id + 1];
+        ++i
+      ) {
+        const edge_id_t edge_id = buffers.out_edge_ids[i];
+        emp_assert( buffers.edge_inlets[ edge_id - base ] == npos, edge_id );
+        buffers.edge_inlets[ edge_id - base ] = node_id;
+      }
+      for (
+        size_t i = buffers.in_offsets[node_id];
+        i < buffers.in_offsets[node_id + 1];
+        ++i
+      ) {
+        const edge_id_t edge_id = buffers.in_edge_ids[i];
+        emp_assert( edge_id >= base, edge_id );
+        emp_assert( edge_id - base < buffers.edge_inlets.size(), edge_id );
+        emp_assert( buffers.edge_outlets[ edge_id - base ] == npos, edge_id );
+        buffers.edge_outlets[ edge_id - base ] = node_id;
+      }
+    }
+
+  }
+
+  void Adopt(Buffers&& buffers_) {
+
+    InitializeEdgeTables( buffers_ );
+
+    const auto buffers = std::make_shared<const Buffers>( std::move(buffers_) );
+    out_offsets = buffers->out_offsets;
+    out_edge_ids = buffers->out_edge_ids;
+    in_offsets = buffers->in_offsets;
+    in_edge_ids = buffers->in_edge_ids;
+    edge_inlets = buffers->edge_inlets;
+    edge_outlets = buffers->edge_outlets;
+    edge_id_base = buffers->edge_id_base;
+    canonical_ids = buffers->canonical_ids;
+    storage = buffers;
+
+  }
+
+  /// Layout of files written by `WriteFile`. Arrays of 64-bit words follow
+  /// in the order out_offsets, out_edge_ids, in_offsets, in_edge_ids,
+  /// edge_inlets, edge_outlets, canonical_ids.
+  struct FileHeader {
+
+    static constexpr uint64_t magic_number{ 0x5253434f50545455 }; // "UTTOPCSR"
+    static constexpr uint64_t current_version{ 1 };
+
+    uint64_t magic{ magic_number };
+    uint64_t version{ current_version };
+    uint64_t num_nodes;
+    uint64_t num_edges;
+    uint64_t edge_id_base;
+    uint64_t edge_table_size;
+    uint64_t num_canonical_ids;
+    uint64_t reserved{};
+
+  };
+
+  static_assert( sizeof(size_t) == sizeof(uint64_t) );
+  static_assert( sizeof(FileHeader) == 64 );
+
+public:
+
+  CsrTopology() { Adopt( Buffers{} ); }
+
+  /**
+   * Adopt CSR arrays directly.
+   *
+   * @param out_offsets_ GetSize() + 1 offsets into out_edge_ids_.
+   * @param out_edge_ids_ concatenated output edge IDs of every node.
+   * @param in_offsets_ GetSize() + 1 offsets into in_edge_ids_.
+   * @param in_edge_ids_ concatenated input edge IDs of every node.
+   */
+  CsrTopology(
+    emp::vector<size_t> out_offsets_,
+    emp::vector<edge_id_t> out_edge_ids_,
+    emp::vector<size_t> in_offsets_,
+    emp::vector<edge_id_t> in_edge_ids_
+  ) {
+    emp_assert( out_offsets_.size() == in_offsets_.size() );
+    emp_assert( out_offsets_.size() && out_offsets_.front() == 0 );
+    emp_assert( out_offsets_.back() == out_edge_ids_.size() );
+    emp_assert( in_offsets_.size() && in_offsets_.front() == 0 );
+    emp_assert( in_offsets_.back() == in_edge_ids_.size() );
+    Buffers buffers;
+    buffers.out_offsets = std::move( out_offsets_ );
+    buffers.out_edge_ids = std::move( out_edge_ids_ );
+    buffers.in_offsets = std::move( in_offsets_ );
+    buffers.in_edge_ids = std::move( in_edge_ids_ );
+    Adopt( std::move(buffers) );
+  }
+
+  /// Convert from a `netuit::Topology`, keeping the order of each node's
+  /// inputs and outputs.
+  explicit CsrTopology(const netuit::Topology& topology) {
+
+    Buffers buffers;
+    buffers.out_offsets.reserve( topology.GetSize() + 1 );
+    buffers.in_offsets.reserve( topology.GetSize() + 1 );
+
+    for (const auto& node : topology) {
+      for (const auto& output : node.GetOutputs()) {
+        buffers.out_edge_ids.push_back( output.GetEdgeID() );
+      }
+      buffers.out_offsets.push_back( buffers.out_edge_ids.size() );
+      for (const auto& input : node.GetInputs()) {
+        buffers.in_edge_ids.push_back( input.GetEdgeID() );
+      }
+      buffers.in_offsets.push_back( buffers.in_edge_ids.size() );
+    }
+
+    // only hold on to canonical ids that aren't identity
+    for (node_id_t node_id{}; node_id < topology.GetSize(); ++node_id) {
+      if ( topology.GetCanonicalNodeID( node_id ) == node_id ) continue;
+      for (node_id_t i{}; i < topology.GetSize(); ++i) {
+        buffers.canonical_ids.push_back( topology.GetCanonicalNodeID( i ) );
+      }
+      break;
+    }
+
+    Adopt( std::move(buffers) );
+
+  }
+
+  /**
+   * Build from an edge list where edge i runs from edges[i].first to
+   * edges[i].second, using a counting sort instead of per-node containers.
+   */
+  static CsrTopology FromEdgeList(
+    const size_t num_nodes,
+    const emp::vector<std::pair<node_id_t, node_id_t>>& edges
+  ) {
+
+    emp::vector<size_t> out_offsets_( num_nodes + 1 );
+    emp::vector<size_t> in_offsets_( num_nodes + 1 );
+    for (const auto& [inlet_node, outlet_node] : edges) {
+      emp_assert( inlet_node < num_nodes && outlet_node < num_nodes );
+      ++out_offsets_[ inlet_node + 1 ];
+      ++in_offsets_[ outlet_node + 1 ];
+    }
+    std::partial_sum(
+      std::begin(out_offsets_), std::end(out_offsets_), std::begin(out_offsets_)
+    );
+    std::partial_sum(
+      std::begin(in_offsets_), std::end(in_offsets_), std::begin(in_offsets_)
+    );
+
+    // fill cursors advance from each node's offset
+    emp::vector<size_t> out_cursors(
+      std::begin(out_offsets_), std::prev( std::end(out_offsets_) )
+    );
+    emp::vector<size_t> in_cursors(
+      std::begin(in_offsets_), std::prev( std::end(in_offsets_) )
+    );
+    emp::vector<edge_id_t> out_edge_ids_( edges.size() );
+    emp::vector<edge_id_t> in_edge_ids_( edges.size() );
+    for (edge_id_t edge_id{}; edge_id < edges.size(); ++edge_id) {
+      const auto& [inlet_node, outlet_node] = edges[edge_id];
+      out_edge_ids_[ out_cursors[inlet_node]++ ] = edge_id;
+      in_edge_ids_[ in_cursors[outlet_node]++ ] = edge_id;
+    }
+
+    return CsrTopology{
+      std::move( out_offsets_ ),
+      std::move( out_edge_ids_ ),
+      std::move( in_offsets_ ),
+      std::move( in_edge_ids_ )
+    };
+
+  }
+
+  /**
+   * Map a file written by `WriteFile` into memory and use its arrays in
+   * place, without parsing or copying.
+   *
+   * Files are in native byte order, so they should be written on the same
+   * kind of machine that maps them.
+   */
+  static CsrTopology MapFile(const std::string& filename) {
+
+    const auto file = std::make_shared<const uitsl::MappedFile>( filename );
+    emp_always_assert( file->GetSize() >= sizeof(FileHeader), filename );
+
+    FileHeader header;
+    std::memcpy( &header, file->GetData(), sizeof(FileHeader) );
+    emp_always_assert( header.magic == FileHeader::magic_number, filename );
+    emp_always_assert(
+      header.version == FileHeader::current_version, filename, header.version
+    );
+
+    // mmap returns page-aligned memory and the header is a multiple of 8 bytes
+    const size_t* cursor = reinterpret_cast<const size_t*>(
+      file->GetData() + sizeof(FileHeader)
+    );
+    const auto take = [&cursor](const size_t count){
+      const std::span<const size_t> res( cursor, count );
+      cursor += count;
+      return res;
+    };
+
+    CsrTopology res;
+    res.out_offsets = take( header.num_nodes + 1 );
+    res.out_edge_ids = take( header.num_edges );
+    res.in_offsets = take( header.num_nodes + 1 );
+    res.in_edge_ids = take( header.num_edges );
+    res.edge_inlets = take( header.edge_table_size );
+    res.edge_outlets = take( header.edge_table_size );
+    res.canonical_ids = take( header.num_canonical_ids );
+    res.edge_id_base = header.edge_id_base;
+    res.storage = file;
+
+    emp_always_assert(
+      reinterpret_cast<const std::byte*>( cursor )
+        == file->GetData() + file->GetSize(),
+      filename
+    );
+
+    return res;
+
+  }
+
+  /// Write header and arrays in the format read by `MapFile`.
+  void WriteFile(const std::string& filename) const {
+
+    std::ofstream file( filename, std::ios::binary );
+    emp_always_assert( file, filename );
+
+    FileHeader header;
+    header.num_nodes = GetSize();
+    header.num_edges = GetNumEdges();
+    header.edge_id_base = edge_id_base;
+    header.edge_table_size = edge_inlets.size();
+    header.num_canonical_ids = canonical_ids.size();
+    file.write( reinterpret_cast<const char*>(&header), sizeof(header) );
+
+    for (const auto array : {
+      out_offsets, out_edge_ids, in_offsets, in_edge_ids,
+      edge_inlets, edge_outlets, canonical_ids
+    }) file.write(
+      reinterpret_cast<const char*>( array.data() ), array.size_bytes()
+    );
+
+    emp_always_assert( file, filename );
+
+  }
+
+  /// Convert to a `netuit::Topology`, keeping the order of each node's
+  /// inputs and outputs.
+  netuit::Topology ToTopology() const {
+
+    emp::vector<netuit::TopoNode> nodes( GetSize() );
+    for (node_id_t node_id{}; node_id < GetSize(); ++node_id) {
+      for (const edge_id_t edge_id : GetOutputEdgeIDs( node_id )) {
+        nodes[node_id].AddOutput( netuit::TopoNodeOutput{ edge_id } );
+      }
+      for (const edge_id_t edge_id : GetInputEdgeIDs( node_id )) {
+        nodes[node_id].AddInput( netuit::TopoNodeInput{ edge_id } );
+      }
+    }
+
+    netuit::Topology res( std::move(nodes) );
+    if ( canonical_ids.size() ) {
+      std::unordered_map<node_id_t, node_id_t> translator;
+      for (node_id_t node_id{}; node_id < GetSize(); ++node_id) {
+        translator[node_id] = canonical_ids[node_id];
+      }
+      res.SetMap( translator );
+    }
+    return res;
+
+  }
+
+  /// Returns number of nodes in topology.
+  size_t GetSize() const noexcept { return out_offsets.size() - 1; }
+
+  size_t GetNumEdges() const noexcept { return out_edge_ids.size(); }
+
+  std::span<const edge_id_t> GetOutputEdgeIDs(const node_id_t node_id) const {
+    emp_assert( node_id < GetSize() );
+    return std::span<const edge_id_t>(
+      out_edge_ids.data() + out_offsets[node_id],
+      out_offsets[node_id + 1] - out_offsets[node_id]
+    );
+  }
+
+  std::span<const edge_id_t> GetInputEdgeIDs(const node_id_t node_id) const {
+    emp_assert( node_id < GetSize() );
+    return std::span<const edge_id_t>(
+      in_edge_ids.data() + in_offsets[node_id],
+      in_offsets[node_id + 1] - in_offsets[node_id]
+    );
+  }
+
+  size_t GetNumOutputs(const node_id_t node_id) const {
+    return out_offsets[node_id + 1] - out_offsets[node_id];
+  }
+
+  size_t GetNumInputs(const node_id_t node_id) const {
+    return in_offsets[node_id + 1] - in_offsets[node_id];
+  }
+
+  bool HasEdge(const edge_id_t edge_id) const {
+    return edge_id >= edge_id_base
+      && edge_id - edge_id_base < edge_inlets.size()
+      && edge_inlets[ edge_id - edge_id_base ] != npos;
+  }
+
+  /// Node holding the inlet end of edge_id (i.e., with edge_id as an output).
+  node_id_t GetInletNode(const edge_id_t edge_id) const {
+    emp_assert( HasEdge( edge_id ), edge_id );
+    return edge_inlets[ edge_id - edge_id_base ];
+  }
+
+  /// Node holding the outlet end of edge_id (i.e., with edge_id as an input).
+  node_id_t GetOutletNode(const edge_id_t edge_id) const {
+    emp_assert( HasEdge( edge_id ), edge_id );
+    return edge_outlets[ edge_id - edge_id_base ];
+  }
+
+  /// Canonical node ID, as in `netuit::Topology::GetCanonicalNodeID`.
+  node_id_t GetCanonicalNodeID(const node_id_t node_id) const {
+    return canonical_ids.empty() ? node_id : canonical_ids[node_id];
+  }
+
+  /// Return Compressed Sparse Row (CSR) node adjacency, in the same format
+  /// as `netuit::Topology::AsCSR`.
+  /// @return std::pair of vectors of int32_t
+  auto AsCSR() const {
+
+    if ( GetSize() == 0 ) return std::make_pair(
+      emp::vector<int32_t>{},
+      emp::vector<int32_t>{}
+    );
+
+    emp::vector<int32_t> x_adj;
+    x_adj.reserve( out_offsets.size() );
+    std::transform(
+      std::begin( out_offsets ),
+      std::end( out_offsets ),
+      std::back_inserter( x_adj ),
+      []( const size_t offset ){ return uitsl::safe_cast<int32_t>( offset ); }
+    );
+
+    emp::vector<int32_t> adjacency;
+    adjacency.reserve( out_edge_ids.size() );
+    std::transform(
+      std::begin( out_edge_ids ),
+      std::end( out_edge_ids ),
+      std::back_inserter( adjacency ),
+      [this]( const edge_id_t edge_id ){
+        return uitsl::safe_cast<int32_t>( GetOutletNode( edge_id ) );
+      }
+    );
+
+    return std::make_pair(x_adj, adjacency);
+
+  }
+
+  /// Returns a subtopology made up of node_ids and the edges between them,
+  /// as in `netuit::Topology::GetSubTopology`.
+  CsrTopology GetSubTopology(const std::unordered_set<size_t>& node_ids) const {
+
+    Buffers buffers;
+
+    for (const node_id_t node_id : node_ids) {
+      for (const edge_id_t edge_id : GetOutputEdgeIDs( node_id )) {
+        if ( node_ids.count( GetOutletNode( edge_id ) ) ) {
+          buffers.out_edge_ids.push_back( edge_id );
+        }
+      }
+      buffers.out_offsets.push_back( buffers.out_edge_ids.size() );
+      for (const edge_id_t edge_id : GetInputEdgeIDs( node_id )) {
+        if ( node_ids.count( GetInletNode( edge_id ) ) ) {
+          buffers.in_edge_ids.push_back( edge_id );
+        }
+      }
+      buffers.in_offsets.push_back( buffers.in_edge_ids.size() );
+      // subtopology node id -> canonical node id
+      buffers.canonical_ids.push_back( GetCanonicalNodeID( node_id ) );
+    }
+
+    CsrTopology res;
+    res.Adopt( std::move(buffers) );
+    return res;
+
+  }
+
+};
+
+/// Write topology in the binary format read by `CsrTopology::MapFile`.
+inline void write_csr_topology_file(
+  const netuit::Topology& topology, const std::string& filename
+) {
+  netuit::CsrTopology{ topology }.WriteFile( filename );
+}
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_TOPOLOGY_CSRTOPOLOGY_HPP_INCLUDE
@@ -0,0 +1,156 @@
+#pragma once
+#ifndef NETUIT_TOPOLOGY_IMPLICITTOPOLOGY_HPP_INCLUDE
+#define NETUIT_TOPOLOGY_IMPLICITTOPOLOGY_HPP_INCLUDE
+
+#include <functional>
+#include <optional>
+#include <stddef.h>
+#include <stdint.h>
+#include <utility>
+
+#include <mpi.h>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../uitsl/debug/safe_cast.hpp"
+#include "../../uitsl/mpi/comm_utils.hpp"
+#include "../../uitsl/mpi/proc_id_t.hpp"
+
+#include "LocalTopology.hpp"
+#include "Topology.hpp"
+#include "TopoNode.hpp"
+
+namespace netuit {
+
+/**
+ * Base for topologies whose neighbors and edge IDs are computed on demand
+ * from node IDs instead of being stored, so a regular layout of any size
+ * takes constant memory and a proc's share of it only takes memory for the
+ * proc's own nodes.
+ *
+ * Derived classes provide
+ *  - `size_t GetSize() const`,
+ *  - `size_t GetNumOutputs(node_id_t) const`,
+ *  - `size_t GetNumInputs(node_id_t) const`,
+ *  - `Edge GetOutput(node_id_t, size_t) const`, the node's ith output, and
+ *  - `Edge GetInput(node_id_t, size_t) const`, the node's ith input,
+ * in the same order an explicit `netuit::Topology` of the layout would list
+ * them.
+ */
+template<typename Derived>
+class ImplicitTopology {
+
+  const Derived& Self() const { return static_cast<const Derived&>(*this); }
+
+public:
+
+  using node_id_t = size_t;
+  using edge_id_t = size_t;
+  using Edge = netuit::LocalTopology::Edge;
+
+  /// Out-degree of node_id.
+  size_t GetDegree(const node_id_t node_id) const {
+    return Self().GetNumOutputs( node_id );
+  }
+
+  /// Nodes that node_id has an output to, in output order.
+  emp::vector<node_id_t> GetNeighbors(const node_id_t node_id) const {
+    emp::vector<node_id_t> res;
+    res.reserve( GetDegree( node_id ) );
+    for (size_t i{}; i < GetDegree( node_id ); ++i) {
+      res.push_back( Self().GetOutput( node_id, i ).outlet_node );
+    }
+    return res;
+  }
+
+  /// ID of the first edge from inlet_node to outlet_node, if there is one.
+  std::optional<edge_id_t> GetEdgeID(
+    const node_id_t inlet_node, const node_id_t outlet_node
+  ) const {
+    for (size_t i{}; i < GetDegree( inlet_node ); ++i) {
+      const Edge edge = Self().GetOutput( inlet_node, i );
+      if ( edge.outlet_node == outlet_node ) return edge.edge_id;
+    }
+    return std::nullopt;
+  }
+
+  /// Same format as `netuit::Topology::AsCSR`, for partitioners.
+  auto AsCSR() const {
+
+    emp::vector<int32_t> x_adj{ 0 };
+    emp::vector<int32_t> adjacency;
+    for (node_id_t node_id{}; node_id < Self().GetSize(); ++node_id) {
+      for (size_t i{}; i < GetDegree( node_id ); ++i) {
+        adjacency.push_back( uitsl::safe_cast<int32_t>(
+          Self().GetOutput( node_id, i ).outlet_node
+        ) );
+      }
+      x_adj.push_back( uitsl::safe_cast<int32_t>( adjacency.size() ) );
+    }
+
+    // match Topology, which returns no offsets for an empty graph
+    if ( Self().GetSize() == 0 ) x_adj.clear();
+
+    return std::make_pair( x_adj, adjacency );
+
+  }
+
+  /// Materialize every node and edge, mostly useful for testing.
+  netuit::Topology ToTopology() const {
+    netuit::Topology res;
+    for (node_id_t node_id{}; node_id < Self().GetSize(); ++node_id) {
+      netuit::TopoNode node;
+      for (size_t i{}; i < Self().GetNumInputs( node_id ); ++i) {
+        node.AddInput( Self().GetInput( node_id, i ).edge_id );
+      }
+      for (size_t i{}; i < Self().GetNumOutputs( node_id ); ++i) {
+        node.AddOutput( Self().GetOutput( node_id, i ).edge_id );
+      }
+      res.push_back( std::move(node) );
+    }
+    return res;
+  }
+
+  /// Share of the topology for a known set of nodes, without communication.
+  netuit::LocalTopology GetLocalTopology(emp::vector<node_id_t> nodes) const {
+    return netuit::LocalTopology::Generate(
+      std::move( nodes ),
+      [this](const node_id_t node_id, const auto& emit){
+        for (size_t i{}; i < Self().GetNumOutputs( node_id ); ++i) {
+          emit( Self().GetOutput( node_id, i ) );
+        }
+        for (size_t i{}; i < Self().GetNumInputs( node_id ); ++i) {
+          emit( Self().GetInput( node_id, i ) );
+        }
+      }
+    );
+  }
+
+  /**
+   * This proc's share of the topology, without communication.
+   *
+   * Calls proc_assignment once per node, but only holds this proc's nodes and
+   * their edges.
+   */
+  netuit::LocalTopology GetLocalTopology(
+    const std::function<uitsl::proc_id_t(node_id_t)>& proc_assignment,
+    const MPI_Comm comm=MPI_COMM_WORLD
+  ) const {
+
+    const uitsl::proc_id_t rank = uitsl::get_proc_id( comm );
+
+    emp::vector<node_id_t> nodes;
+    for (node_id_t node_id{}; node_id < Self().GetSize(); ++node_id) {
+      if ( proc_assignment( node_id ) == rank ) nodes.push_back( node_id );
+    }
+
+    return GetLocalTopology( std::move(nodes) );
+
+  }
+
+};
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_TOPOLOGY_IMPLICITTOPOLOGY_HPP_INCLUDE
@@ -0,0 +1,309 @@
+#pragma once
+#ifndef NETUIT_TOPOLOGY_LOCALTOPOLOGY_HPP_INCLUDE
+#define NETUIT_TOPOLOGY_LOCALTOPOLOGY_HPP_INCLUDE
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <stddef.h>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+#include <mpi.h>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../uitsl/debug/safe_cast.hpp"
+#include "../../uitsl/mpi/audited_routines.hpp"
+#include "../../uitsl/mpi/comm_utils.hpp"
+#include "../../uitsl/mpi/proc_id_t.hpp"
+
+#include "CsrTopology.hpp"
+#include "Topology.hpp"
+
+namespace netuit {
+
+/**
+ * The share of a topology that one proc needs to build its part of a
+ * `netuit::Mesh`: the nodes assigned to it and every edge with at least one
+ * end among them.
+ *
+ * Every proc holds a `netuit::Topology` in full, so mesh setup from one grows
+ * with the global graph on every proc. A `LocalTopology` only grows with the
+ * proc's own nodes and their edges. Edge IDs must still be unique across the
+ * whole graph and agree between procs, since they pair up the two halves of
+ * each inter-process duct.
+ */
+class LocalTopology {
+
+public:
+
+  using node_id_t = size_t;
+  using edge_id_t = size_t;
+
+  /// Directed edge from the node holding its inlet to the node holding its
+  /// outlet.
+  struct Edge {
+
+    edge_id_t edge_id;
+    node_id_t inlet_node;
+    node_id_t outlet_node;
+
+    bool operator<(const Edge& other) const {
+      return std::tie(edge_id, inlet_node, outlet_node)
+        < std::tie(other.edge_id, other.inlet_node, other.outlet_node);
+    }
+
+    bool operator==(const Edge& other) const {
+      return std::tie(edge_id, inlet_node, outlet_node)
+        == std::tie(other.edge_id, other.inlet_node, other.outlet_node);
+    }
+
+  };
+
+private:
+
+  // sorted and unique
+  emp::vector<node_id_t> nodes;
+
+  // sorted by edge id and unique
+  emp::vector<Edge> edges;
+
+public:
+
+  LocalTopology() = default;
+
+  /**
+   * @param nodes_ nodes assigned to this proc, in any order.
+   * @param edges_ every edge with an end in nodes_, in any order and possibly
+   * repeated.
+   */
+  LocalTopology(emp::vector<node_id_t> nodes_, emp::vector<Edge> edges_)
+  : nodes(std::move(nodes_))
+  , edges(std::move(edges_)) {
+
+    std::sort( std::begin(nodes), std::end(nodes) );
+    nodes.erase(
+      std::unique( std::begin(nodes), std::end(nodes) ), std::end(nodes)
+    );
+
+    std::sort( std::begin(edges), std::end(edges) );
+    edges.erase(
+      std::unique( std::begin(edges), std::end(edges) ), std::end(edges)
+    );
+
+    // each edge ID names exactly one edge
+    emp_assert( std::adjacent_find(
+      std::begin(edges), std::end(edges),
+      [](const auto& a, const auto& b){ return a.edge_id == b.edge_id; }
+    ) == std::end(edges) );
+
+    emp_assert( std::all_of(
+      std::begin(edges), std::end(edges),
+      [this](const auto& edge){
+        return HasNode(edge.inlet_node) || HasNode(edge.outlet_node);
+      }
+    ) );
+
+  }
+
+  /**
+   * Build from a callback that enumerates the edges at a node, without
+   * communication.
+   *
+   * @param nodes_ nodes assigned to this proc.
+   * @param generator called as `generator(node_id, emit)` for each node in
+   * nodes_, must call `emit(edge)` for every edge into or out of node_id.
+   */
+  template<typename Generator>
+  static LocalTopology Generate(
+    emp::vector<node_id_t> nodes_, Generator&& generator
+  ) {
+    emp::vector<Edge> edges_;
+    const auto emit = [&edges_](const Edge& edge){ edges_.push_back(edge); };
+    for (const node_id_t node_id : nodes_) generator(node_id, emit);
+    return LocalTopology{ std::move(nodes_), std::move(edges_) };
+  }
+
+  /**
+   * Build from a distributed edge list, where each proc holds an arbitrary
+   * slice of the global edges. Collective over comm.
+   *
+   * Each edge is routed to the procs at either end with one all-to-all
+   * exchange.
+   *
+   * @param slice this proc's share of the global edge list.
+   * @param nodes_ nodes assigned to this proc.
+   * @param proc_assignment proc of any node, only called for ends of edges in
+   * slice.
+   */
+  static LocalTopology Scatter(
+    const emp::vector<Edge>& slice,
+    emp::vector<node_id_t> nodes_,
+    const std::function<uitsl::proc_id_t(node_id_t)>& proc_assignment,
+    const MPI_Comm comm=MPI_COMM_WORLD
+  ) {
+
+    const size_t num_procs = uitsl::get_nprocs( comm );
+
+    // bucket edges by destination proc
+    emp::vector<emp::vector<Edge>> outgoing( num_procs );
+    for (const auto& edge : slice) {
+      const uitsl::proc_id_t inlet_proc = proc_assignment( edge.inlet_node );
+      const uitsl::proc_id_t outlet_proc = proc_assignment( edge.outlet_node );
+      outgoing[ inlet_proc ].push_back( edge );
+      if (outlet_proc != inlet_proc) outgoing[ outlet_proc ].push_back( edge );
+    }
+
+    emp::vector<int> send_counts, send_displs;
+    emp::vector<Edge> send_buffer;
+    for (const auto& bucket : outgoing) {
+      send_displs.push_back(
+        uitsl::safe_cast<int>( send_buffer.size() * sizeof(Edge) )
+      );
+      send_counts.push_back(
+        uitsl::safe_cast<int>( bucket.size() * sizeof(Edge) )
+      );
+      send_buffer.insert(
+        std::end(send_buffer), std::begin(bucket), std::end(bucket)
+      );
+    }
+
+    emp::vector<int> recv_counts( num_procs );
+    UITSL_Alltoall(
+      send_counts.data(), // const void *sendbuf
+      1, // int sendcount
+      MPI_INT, // MPI_Datatype sendtype
+      recv_counts.data(), // void *recvbuf
+      1, // int recvcount
+      MPI_INT, // MPI_Datatype recvtype
+      comm // MPI_Comm comm
+    );
+
+    emp::vector<int> recv_displs{ 0 };
+    std::partial_sum(
+      std::begin(recv_counts),
+      std::prev( std::end(recv_counts) ),
+      std::back_inserter( recv_displs )
+    );
+    const size_t recv_bytes = std::accumulate(
+      std::begin(recv_counts), std::end(recv_counts), size_t{}
+    );
+
+    emp::vector<Edge> edges_( recv_bytes / sizeof(Edge) );
+    UITSL_Alltoallv(
+      send_buffer.data(), // const void *sendbuf
+      send_counts.data(), // const int sendcounts[]
+      send_displs.data(), // const int sdispls[]
+      MPI_BYTE, // MPI_Datatype sendtype
+      edges_.data(), // void *recvbuf
+      recv_counts.data(), // const int recvcounts[]
+      recv_displs.data(), // const int rdispls[]
+      MPI_BYTE, // MPI_Datatype recvtype
+      comm // MPI_Comm comm
+    );
+
+    return LocalTopology{ std::move(nodes_), std::move(edges_) };
+
+  }
+
+  /**
+   * Extract this proc's share of a full topology.
+   *
+   * Scans the whole topology, so this is mostly useful for testing and for
+   * porting setups that already hold one.
+   */
+  static LocalTopology Extract(
+    const netuit::Topology& topology,
+    const std::function<uitsl::proc_id_t(node_id_t)>& proc_assignment,
+    const MPI_Comm comm=MPI_COMM_WORLD
+  ) {
+
+    const uitsl::proc_id_t rank = uitsl::get_proc_id( comm );
+
+    // edge id -> end nodes, filled from both sides
+    std::unordered_map<edge_id_t, Edge> registry;
+    for (node_id_t node_id{}; node_id < topology.GetSize(); ++node_id) {
+      for (const auto& output : topology[node_id].GetOutputs()) {
+        registry[ output.GetEdgeID() ].inlet_node = node_id;
+      }
+      for (const auto& input : topology[node_id].GetInputs()) {
+        registry[ input.GetEdgeID() ].outlet_node = node_id;
+      }
+    }
+
+    emp::vector<node_id_t> nodes_;
+    for (node_id_t node_id{}; node_id < topology.GetSize(); ++node_id) {
+      if ( proc_assignment(node_id) == rank ) nodes_.push_back( node_id );
+    }
+
+    emp::vector<Edge> edges_;
+    for (auto& [edge_id, edge] : registry) {
+      edge.edge_id = edge_id;
+      if (
+        proc_assignment(edge.inlet_node) == rank
+        || proc_assignment(edge.outlet_node) == rank
+      ) edges_.push_back( edge );
+    }
+
+    return LocalTopology{ std::move(nodes_), std::move(edges_) };
+
+  }
+
+  /**
+   * Extract this proc's share of a full CSR topology.
+   *
+   * Visits every node once to check its assignment, but only looks at the
+   * edges of nodes on this proc.
+   */
+  static LocalTopology Extract(
+    const netuit::CsrTopology& topology,
+    const std::function<uitsl::proc_id_t(node_id_t)>& proc_assignment,
+    const MPI_Comm comm=MPI_COMM_WORLD
+  ) {
+
+    const uitsl::proc_id_t rank = uitsl::get_proc_id( comm );
+
+    emp::vector<node_id_t> nodes_;
+    emp::vector<Edge> edges_;
+    for (node_id_t node_id{}; node_id < topology.GetSize(); ++node_id) {
+      if ( proc_assignment(node_id) != rank ) continue;
+      nodes_.push_back( node_id );
+      for (const edge_id_t edge_id : topology.GetOutputEdgeIDs( node_id )) {
+        edges_.push_back(
+          Edge{ edge_id, node_id, topology.GetOutletNode( edge_id ) }
+        );
+      }
+      for (const edge_id_t edge_id : topology.GetInputEdgeIDs( node_id )) {
+        edges_.push_back(
+          Edge{ edge_id, topology.GetInletNode( edge_id ), node_id }
+        );
+      }
+    }
+
+    return LocalTopology{ std::move(nodes_), std::move(edges_) };
+
+  }
+
+  /// Nodes assigned to this proc, sorted.
+  const emp::vector<node_id_t>& GetNodes() const { return nodes; }
+
+  /// Edges with an end on this proc, sorted by edge ID.
+  const emp::vector<Edge>& GetEdges() const { return edges; }
+
+  size_t GetNumNodes() const { return nodes.size(); }
+
+  size_t GetNumEdges() const { return edges.size(); }
+
+  bool HasNode(const node_id_t node_id) const {
+    return std::binary_search( std::begin(nodes), std::end(nodes), node_id );
+  }
+
+};
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_TOPOLOGY_LOCALTOPOLOGY_HPP_INCLUDE
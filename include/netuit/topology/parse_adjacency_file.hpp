@@ -0,0 +1,143 @@
+#pragma once
+#ifndef NETUIT_TOPOLOGY_PARSE_ADJACENCY_FILE_HPP_INCLUDE
+#define NETUIT_TOPOLOGY_PARSE_ADJACENCY_FILE_HPP_INCLUDE
+
+#include <algorithm>
+#include <charconv>
+#include <iterator>
+#include <stddef.h>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../uitsl/datastructs/MappedFile.hpp"
+#include "../../uitsl/parallel/ThreadTeam.hpp"
+
+#include "CsrTopology.hpp"
+
+namespace netuit {
+
+namespace internal {
+
+struct AdjacencyChunk {
+
+  // (node, neighbor) in file order
+  emp::vector<std::pair<size_t, size_t>> edges;
+  size_t num_lines{};
+  size_t num_nodes{};
+
+  void Parse(const char* cur, const char* const end) {
+
+    const auto is_blank = [](const char c){
+      return c == ' ' || c == '\t' || c == '\r';
+    };
+
+    while (cur != end) {
+
+      const char* const line_end = std::find( cur, end, '\n' );
+
+      size_t node_id;
+      while (cur != line_end && is_blank(*cur)) ++cur;
+      const auto [ptr, ec] = std::from_chars( cur, line_end, node_id );
+
+      // skip blank lines
+      if (cur != line_end) {
+        emp_always_assert( ec == std::errc{}, std::string(cur, line_end) );
+        cur = ptr;
+        ++num_lines;
+        num_nodes = std::max( num_nodes, node_id + 1 );
+
+        while (true) {
+          while (cur != line_end && is_blank(*cur)) ++cur;
+          if (cur == line_end) break;
+          size_t neighbor;
+          const auto [next, err] = std::from_chars( cur, line_end, neighbor );
+          emp_always_assert( err == std::errc{}, std::string(cur, line_end) );
+          cur = next;
+          edges.emplace_back( node_id, neighbor );
+          num_nodes = std::max( num_nodes, neighbor + 1 );
+        }
+      }
+
+      cur = line_end == end ? end : std::next( line_end );
+
+    }
+
+  }
+
+};
+
+} // namespace internal
+
+/**
+ * Parse an adjacency list file, in the format read by
+ * `Topology(std::istream&)`, with several threads.
+ *
+ * The file is memory mapped and split into chunks at line breaks, one per
+ * thread. Edge IDs are numbered in file order, as `Topology(std::istream&)`
+ * does, and node IDs are assumed to be dense.
+ *
+ * @param filename adjacency list file.
+ * @param num_threads number of threads to parse with.
+ */
+inline netuit::CsrTopology parse_adjacency_file(
+  const std::string& filename,
+  const size_t num_threads=std::max(std::thread::hardware_concurrency(), 1u)
+) {
+
+  emp_assert( num_threads );
+
+  const uitsl::MappedFile file( filename );
+  const char* const begin = reinterpret_cast<const char*>( file.GetData() );
+  const char* const end = begin + file.GetSize();
+
+  // chunk boundaries fall just after line breaks
+  emp::vector<const char*> bounds{ begin };
+  for (size_t chunk = 1; chunk < num_threads; ++chunk) {
+    const char* const target = std::max(
+      begin + file.GetSize() * chunk / num_threads, bounds.back()
+    );
+    const char* const line_end = std::find( target, end, '\n' );
+    bounds.push_back( line_end == end ? end : std::next( line_end ) );
+  }
+  bounds.push_back( end );
+
+  emp::vector<internal::AdjacencyChunk> chunks( num_threads );
+  uitsl::ThreadTeam team;
+  for (size_t chunk{}; chunk < num_threads; ++chunk) team.Add(
+    [&chunks, &bounds, chunk](){
+      chunks[chunk].Parse( bounds[chunk], bounds[chunk + 1] );
+    }
+  );
+  team.Join();
+
+  size_t num_edges{}, num_lines{}, num_nodes{};
+  for (const auto& chunk : chunks) {
+    num_edges += chunk.edges.size();
+    num_lines += chunk.num_lines;
+    num_nodes = std::max( num_nodes, chunk.num_nodes );
+  }
+
+  // as in Topology(std::istream&), node ids must be less than number of lines
+  emp_assert( num_nodes <= num_lines, num_nodes, num_lines );
+
+  emp::vector<std::pair<size_t, size_t>> edges;
+  edges.reserve( num_edges );
+  for (auto& chunk : chunks) {
+    edges.insert(
+      std::end( edges ), std::begin( chunk.edges ), std::end( chunk.edges )
+    );
+    chunk.edges = {};
+  }
+
+  return netuit::CsrTopology::FromEdgeList( num_nodes, edges );
+
+}
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_TOPOLOGY_PARSE_ADJACENCY_FILE_HPP_INCLUDE
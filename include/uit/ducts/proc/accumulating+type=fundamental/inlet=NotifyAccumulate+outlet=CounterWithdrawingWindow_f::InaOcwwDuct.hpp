@@ -0,0 +1,38 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_ACCUMULATING_TYPE_FUNDAMENTAL_INLET_NOTIFYACCUMULATE_OUTLET_COUNTERWITHDRAWINGWINDOW_F__INAOCWWDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_ACCUMULATING_TYPE_FUNDAMENTAL_INLET_NOTIFYACCUMULATE_OUTLET_COUNTERWITHDRAWINGWINDOW_F__INAOCWWDUCT_HPP_INCLUDE
+
+#include <type_traits>
+
+#include "../impl/inlet/accumulating+type=fundamental/f::NotifyAccumulateDuct.hpp"
+#include "../impl/outlet/accumulating+type=fundamental/f::CounterWithdrawingWindowDuct.hpp"
+
+namespace uit {
+namespace f {
+
+/**
+ * Accumulating RDMA duct whose outlet polls a notification counter and only
+ * withdraws the packet when it has moved.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+struct InaOcwwDuct {
+
+  using InletImpl = uit::f::NotifyAccumulateDuct<ImplSpec>;
+  using OutletImpl = uit::f::CounterWithdrawingWindowDuct<ImplSpec>;
+
+  static_assert(std::is_same<
+    typename InletImpl::BackEndImpl,
+    typename OutletImpl::BackEndImpl
+  >::value);
+
+  using BackEndImpl = typename InletImpl::BackEndImpl;
+
+};
+
+} // namespace f
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_ACCUMULATING_TYPE_FUNDAMENTAL_INLET_NOTIFYACCUMULATE_OUTLET_COUNTERWITHDRAWINGWINDOW_F__INAOCWWDUCT_HPP_INCLUDE
@@ -0,0 +1,38 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_ACCUMULATING_TYPE_SPAN_CHUNKED_INLET_CHUNKEDISEND_OUTLET_CHUNKEDIRECV_S__CHUNKEDICIOCIDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_ACCUMULATING_TYPE_SPAN_CHUNKED_INLET_CHUNKEDISEND_OUTLET_CHUNKEDIRECV_S__CHUNKEDICIOCIDUCT_HPP_INCLUDE
+
+#include <type_traits>
+
+#include "../impl/inlet/accumulating+type=span/s::ChunkedIsendDuct.hpp"
+#include "../impl/outlet/accumulating+type=span/s::ChunkedIrecvDuct.hpp"
+
+namespace uit {
+namespace s {
+
+/**
+ * Accumulating span duct for large messages, sent and received as a
+ * bounded pipeline of 64 KiB chunks.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+struct ChunkedIciOciDuct {
+
+  using InletImpl = uit::s::ChunkedIsendDuct<ImplSpec>;
+  using OutletImpl = uit::s::ChunkedIrecvDuct<ImplSpec>;
+
+  static_assert(std::is_same<
+    typename InletImpl::BackEndImpl,
+    typename OutletImpl::BackEndImpl
+  >::value);
+
+  using BackEndImpl = typename InletImpl::BackEndImpl;
+
+};
+
+} // namespace s
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_ACCUMULATING_TYPE_SPAN_CHUNKED_INLET_CHUNKEDISEND_OUTLET_CHUNKEDIRECV_S__CHUNKEDICIOCIDUCT_HPP_INCLUDE
@@ -0,0 +1,171 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_BACKEND_COALESCEDBACKEND_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_BACKEND_COALESCEDBACKEND_HPP_INCLUDE
+
+#include <map>
+
+#include "../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+#include "../../../../../uitsl/datastructs/VectorMap.hpp"
+#include "../../../../../uitsl/mpi/proc_id_t.hpp"
+#include "../../../../../uitsl/parallel/thread_utils.hpp"
+
+#include "../../../../setup/InterProcAddress.hpp"
+
+#include "impl/AggregatorSpec.hpp"
+#include "impl/InletFrameCoalescer.hpp"
+#include "impl/InletMemoryAggregator.hpp"
+#include "impl/OutletFrameDemuxer.hpp"
+#include "impl/OutletMemoryAggregator.hpp"
+
+namespace uit {
+
+/**
+ * Aggregates like `uit::AggregatedBackEnd`, but additionally combines the
+ * aggregates of all threads on this proc bound for the same proc into one
+ * message per flush round.
+ *
+ * Each thread stages puts in its own `uit::InletMemoryAggregator` as usual,
+ * which deposits its frame into a `uit::InletFrameCoalescer` shared by all
+ * threads sending to that proc. On the receiving proc, a
+ * `uit::OutletFrameDemuxer` shared by all threads receiving from that proc
+ * hands each thread's `uit::OutletMemoryAggregator` its share.
+ *
+ * Backing ducts are called from whichever thread completes a round, so
+ * meshes with more than one thread per proc require MPI initialized with
+ * `MPI_THREAD_MULTIPLE` (see `uitsl::MpiMultithreadGuard`).
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ * @tparam ProcDuct proc duct backing the combined frames.
+ */
+template<
+  typename ImplSpec,
+  template<typename> typename ProcDuct
+>
+class CoalescedBackEnd {
+
+  using address_t = uit::InterProcAddress;
+
+  using AggregatorSpec_t = uit::AggregatorSpec<ImplSpec, ProcDuct>;
+
+  using coalescer_t = uit::InletFrameCoalescer<AggregatorSpec_t>;
+  using demuxer_t = uit::OutletFrameDemuxer<AggregatorSpec_t>;
+
+public:
+
+  using inlet_aggregator_t = uit::InletMemoryAggregator<
+    AggregatorSpec_t,
+    typename coalescer_t::SegmentInlet
+  >;
+  using outlet_aggregator_t = uit::OutletMemoryAggregator<
+    AggregatorSpec_t,
+    typename demuxer_t::ChannelOutlet
+  >;
+
+private:
+
+  // proc_id of target -> coalescer shared by all inlet threads
+  // (std::map because coalescers are neither copyable nor movable)
+  std::map<uitsl::proc_id_t, coalescer_t> coalescers;
+
+  // proc_id of source -> demuxer shared by all outlet threads
+  std::map<uitsl::proc_id_t, demuxer_t> demuxers;
+
+  // thread_id of caller -> proc_id of target -> inlet aggregator
+  uitsl::VectorMap<
+    uitsl::thread_id_t,
+    uitsl::VectorMap<
+      uitsl::proc_id_t,
+      inlet_aggregator_t
+    >
+  > inlet_aggregators;
+
+  // thread_id of caller -> proc_id of source -> outlet aggregator
+  uitsl::VectorMap<
+    uitsl::thread_id_t,
+    uitsl::VectorMap<
+      uitsl::proc_id_t,
+      outlet_aggregator_t
+    >
+  > outlet_aggregators;
+
+  bool initialized{};
+
+public:
+
+  void RegisterInletSlot(const address_t& address) {
+    emp_assert( !initialized );
+    coalescers[ address.GetOutletProc() ].Register( address );
+    inlet_aggregators[
+      address.GetInletThread()
+    ][
+      address.GetOutletProc()
+    ].Register(address);
+  }
+
+  void RegisterOutletSlot(const address_t& address) {
+    emp_assert( !initialized );
+    demuxers[ address.GetInletProc() ].Register( address );
+    outlet_aggregators[
+      address.GetOutletThread()
+    ][
+      address.GetInletProc()
+    ].Register(address);
+  }
+
+  void Initialize() {
+    emp_assert( !initialized );
+
+    for (auto& [__, coalescer] : coalescers) coalescer.Initialize();
+    for (auto& [__, demuxer] : demuxers) demuxer.Initialize();
+
+    for (auto& [thread, proc_map] : inlet_aggregators) {
+      for (auto& [proc, aggregator] : proc_map) aggregator.Initialize(
+        coalescers.at( proc ).GetSegmentInlet( thread )
+      );
+    }
+    for (auto& [thread, proc_map] : outlet_aggregators) {
+      for (auto& [proc, aggregator] : proc_map) aggregator.Initialize(
+        demuxers.at( proc ).GetChannelOutlet( thread )
+      );
+    }
+
+    initialized = true;
+  }
+
+  inlet_aggregator_t& GetInletAggregator(const address_t& address) {
+    emp_assert( initialized );
+
+    auto& aggregator = inlet_aggregators.at(
+      address.GetInletThread()
+    ).at(
+      address.GetOutletProc()
+    );
+
+    emp_assert( aggregator.IsInitialized(), aggregator.GetSize() );
+
+    return aggregator;
+  }
+
+  outlet_aggregator_t& GetOutletAggregator(const address_t& address) {
+    emp_assert( initialized );
+
+    auto& aggregator = outlet_aggregators.at(
+      address.GetOutletThread()
+    ).at(
+      address.GetInletProc()
+    );
+
+    emp_assert( aggregator.IsInitialized() );
+
+    return aggregator;
+  }
+
+  constexpr static bool CanStep() { return outlet_aggregator_t::CanStep(); }
+
+};
+
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_BACKEND_COALESCEDBACKEND_HPP_INCLUDE
@@ -0,0 +1,69 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_BACKEND_CREDITBACKEND_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_BACKEND_CREDITBACKEND_HPP_INCLUDE
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <utility>
+
+#include "../../../../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+namespace uit {
+
+/**
+ * Finishes the teardown handshakes of credit ring ducts.
+ *
+ * A credit duct can't just cancel its requests when destroyed: its peer may
+ * still hold credit for receives it would cancel, or have sends in flight
+ * toward them. So, each duct hands the back end a teardown step that
+ * advances its half of the handshake without blocking. Steps are polled
+ * together once the last duct sharing the back end is gone, so procs may
+ * destroy ducts in any order without deadlocking on one another. Destroying
+ * the back end blocks until peer procs destroy their ends of its ducts.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class CreditBackEnd {
+
+public:
+
+  /// Advances a teardown handshake, returning true once it has completed.
+  using teardown_t = std::function<bool()>;
+
+private:
+
+  emp::vector<teardown_t> teardowns;
+
+  std::mutex mutex;
+
+public:
+
+  ~CreditBackEnd() {
+    while ( teardowns.size() ) teardowns.erase(
+      std::remove_if(
+        std::begin( teardowns ), std::end( teardowns ),
+        [](auto& teardown){ return teardown(); }
+      ),
+      std::end( teardowns )
+    );
+  }
+
+  void Initialize() { ; }
+
+  /**
+   * Take over a destroyed duct's teardown, finishing it now if possible.
+   */
+  void Retire(teardown_t teardown) {
+    if ( teardown() ) return;
+    const std::lock_guard guard{ mutex };
+    teardowns.push_back( std::move(teardown) );
+  }
+
+};
+
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_BACKEND_CREDITBACKEND_HPP_INCLUDE
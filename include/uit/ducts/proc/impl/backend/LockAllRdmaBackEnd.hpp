@@ -0,0 +1,38 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_BACKEND_LOCKALLRDMABACKEND_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_BACKEND_LOCKALLRDMABACKEND_HPP_INCLUDE
+
+#include <mpi.h>
+
+#include "../../../../../uitsl/distributed/LockAllWindowManager.hpp"
+
+namespace uit {
+
+/**
+ * Shares a single RDMA window, opened once in a `lock_all` epoch, between
+ * every RDMA duct on a proc.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class LockAllRdmaBackEnd {
+
+  uitsl::LockAllWindowManager window_manager;
+
+public:
+
+  uitsl::LockAllWindowManager& GetWindowManager() {
+    return window_manager;
+  }
+
+  /// Collective over comm.
+  void Initialize(const MPI_Comm comm=MPI_COMM_WORLD) {
+    window_manager.Initialize( comm );
+  }
+
+};
+
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_BACKEND_LOCKALLRDMABACKEND_HPP_INCLUDE
@@ -0,0 +1,353 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_BACKEND_NEIGHBORHOODBACKEND_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_BACKEND_NEIGHBORHOODBACKEND_HPP_INCLUDE
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <stddef.h>
+#include <utility>
+
+#include <mpi.h>
+
+#include "../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../../../../uitsl/meta/t::static_test.hpp"
+#include "../../../../../uitsl/mpi/audited_routines.hpp"
+#include "../../../../../uitsl/mpi/comm_utils.hpp"
+#include "../../../../../uitsl/mpi/mpi_types.hpp"
+#include "../../../../../uitsl/mpi/Request.hpp"
+#include "../../../../../uitsl/mpi/request_utils.hpp"
+
+#include "../../../../setup/InterProcAddress.hpp"
+
+namespace uit {
+
+/**
+ * Exchanges the latest value of every registered inter-process duct with a
+ * single `MPI_Ineighbor_alltoallv` per step.
+ *
+ * During initialization, a distributed graph communicator is built from the
+ * procs at the other end of registered inlets and outlets. Puts overwrite a
+ * staging slot. Once every inlet on this proc has flushed, or once an outlet
+ * polls for gets after any inlet has flushed, staged slots are packed
+ * neighbor by neighbor and the exchange is posted. The exchange completes in
+ * the background and is unpacked the next time any duct on this proc flushes
+ * or polls for gets. Only one exchange is in flight at a time, so procs
+ * advance in lockstep with their neighbors (BSP-style).
+ *
+ * Procs with no inter-process ducts are split off and do not participate.
+ * On destruction, participants catch up to the furthest-along participant
+ * so that outstanding exchanges match up.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class NeighborhoodBackEnd {
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::t::static_test<T>(), uitsl_t_message );
+
+  using address_t = uit::InterProcAddress;
+
+  struct Packet {
+    T value;
+    // number of puts since the previous exchange, zero if slot is stale
+    size_t num_puts;
+  };
+
+  std::mutex mutex;
+
+  // duct address -> slot index, assigned during initialization
+  // (map ordering groups slots by neighbor identically on both ends)
+  std::map<address_t, size_t> inlet_slots;
+  std::map<address_t, size_t> outlet_slots;
+
+  // procs that have at least one inter-process duct
+  MPI_Comm participant_comm{ MPI_COMM_NULL };
+
+  MPI_Comm graph_comm{ MPI_COMM_NULL };
+
+  // per-neighbor counts and displacements, in bytes
+  emp::vector<int> send_counts;
+  emp::vector<int> send_displs;
+  emp::vector<int> recv_counts;
+  emp::vector<int> recv_displs;
+
+  emp::vector<Packet> staged;
+  emp::vector<Packet> send_buffer;
+  emp::vector<Packet> recv_buffer;
+
+  // per outlet slot, most recent value and number of puts not yet consumed
+  emp::vector<T> latest;
+  emp::vector<size_t> num_unconsumed;
+
+  uitsl::Request request;
+
+  size_t num_exchanges{};
+
+  // incremented every time TryFlush is called
+  // then reset to zero once every inlet on this proc has called
+  size_t pending_flush_counter{};
+
+  bool initialized{};
+
+  bool IsParticipant() const { return graph_comm != MPI_COMM_NULL; }
+
+  void PostExchange() {
+    emp_assert( uitsl::test_null( request ) );
+
+    pending_flush_counter = 0;
+
+    std::copy( std::begin(staged), std::end(staged), std::begin(send_buffer) );
+    for (auto& packet : staged) packet.num_puts = 0;
+
+    UITSL_Ineighbor_alltoallv(
+      send_buffer.data(), // const void *sendbuf
+      send_counts.data(), // const int sendcounts[]
+      send_displs.data(), // const int sdispls[]
+      MPI_BYTE, // MPI_Datatype sendtype
+      recv_buffer.data(), // void *recvbuf
+      recv_counts.data(), // const int recvcounts[]
+      recv_displs.data(), // const int rdispls[]
+      MPI_BYTE, // MPI_Datatype recvtype
+      graph_comm, // MPI_Comm comm
+      &request // MPI_Request *request
+    );
+
+    ++num_exchanges;
+  }
+
+  void Unpack() {
+    for (size_t slot{}; slot < recv_buffer.size(); ++slot) {
+      const auto& packet = recv_buffer[slot];
+      if (packet.num_puts) {
+        latest[slot] = packet.value;
+        num_unconsumed[slot] += packet.num_puts;
+      }
+    }
+  }
+
+  // must hold mutex
+  // polling for gets ends the put phase of the current step early,
+  // so that inlets that never flush don't stall their neighbors
+  void TryAdvance(const bool is_polling) {
+    emp_assert( IsInitialized() );
+    if ( !IsParticipant() ) return;
+
+    if ( !uitsl::test_null( request ) ) {
+      if ( uitsl::test_completion( request ) ) Unpack();
+      else return;
+    }
+
+    if (
+      pending_flush_counter >= inlet_slots.size()
+      || ( is_polling && pending_flush_counter )
+    ) PostExchange();
+  }
+
+  static void AssignSlots(std::map<address_t, size_t>& slots) {
+    size_t slot{};
+    for (auto& [address, index] : slots) index = slot++;
+  }
+
+  // tally contiguous runs of slots that share a neighbor
+  template<typename GetNeighbor>
+  static emp::vector<int> TallyNeighbors(
+    const std::map<address_t, size_t>& slots,
+    emp::vector<int>& counts,
+    GetNeighbor&& get_neighbor
+  ) {
+    emp::vector<int> neighbors;
+    for (const auto& [address, slot] : slots) {
+      const int neighbor = get_neighbor(address);
+      emp_assert( neighbors.empty() || neighbors.back() <= neighbor );
+      if ( neighbors.empty() || neighbors.back() != neighbor ) {
+        neighbors.push_back( neighbor );
+        counts.push_back( 0 );
+      }
+      emp_assert(
+        static_cast<size_t>( counts.back() )
+        <= std::numeric_limits<int>::max() - sizeof(Packet)
+      );
+      counts.back() += sizeof(Packet);
+    }
+    return neighbors;
+  }
+
+  static bool IsCongruent(const MPI_Comm a, const MPI_Comm b) {
+    int res;
+    UITSL_Comm_compare( a, b, &res );
+    return res == MPI_IDENT || res == MPI_CONGRUENT;
+  }
+
+  static emp::vector<int> ToDisplacements(const emp::vector<int>& counts) {
+    emp::vector<int> res( counts.size() );
+    std::exclusive_scan( std::begin(counts), std::end(counts), std::begin(res), 0 );
+    return res;
+  }
+
+public:
+
+  ~NeighborhoodBackEnd() {
+    if ( !IsParticipant() ) return;
+
+    // neighborhood collectives must match up across participants,
+    // so catch up with whoever has posted the most exchanges
+    // (agreed on over participant_comm to stay out of graph_comm's ordering)
+    size_t target;
+    UITSL_Allreduce(
+      &num_exchanges, // const void *sendbuf
+      &target, // void *recvbuf
+      1, // int count
+      uitsl::datatype_from_type<size_t>(), // MPI_Datatype datatype
+      MPI_MAX, // MPI_Op op
+      participant_comm // MPI_Comm comm
+    );
+
+    if ( !uitsl::test_null( request ) ) UITSL_Wait( &request, MPI_STATUS_IGNORE );
+    for (auto& packet : staged) packet.num_puts = 0;
+    while (num_exchanges < target) {
+      PostExchange();
+      UITSL_Wait( &request, MPI_STATUS_IGNORE );
+    }
+
+    UITSL_Comm_free( &graph_comm );
+    UITSL_Comm_free( &participant_comm );
+  }
+
+  bool IsInitialized() const { return initialized; }
+
+  void RegisterInletSlot(const address_t& address) {
+    const std::lock_guard guard{ mutex };
+    emp_assert( !IsInitialized() );
+    emp_assert( !inlet_slots.count(address) );
+    inlet_slots.emplace( address, 0 );
+  }
+
+  void RegisterOutletSlot(const address_t& address) {
+    const std::lock_guard guard{ mutex };
+    emp_assert( !IsInitialized() );
+    emp_assert( !outlet_slots.count(address) );
+    outlet_slots.emplace( address, 0 );
+  }
+
+  /// Build graph communicator. Collective over comm.
+  void Initialize(const MPI_Comm comm=MPI_COMM_WORLD) {
+    const std::lock_guard guard{ mutex };
+    emp_assert( !IsInitialized() );
+
+    // ducts may use duplicates of comm, but ranks must line up
+    emp_assert( std::all_of(
+      std::begin(inlet_slots), std::end(inlet_slots),
+      [comm](const auto& pair){ return IsCongruent(pair.first.GetComm(), comm); }
+    ) );
+    emp_assert( std::all_of(
+      std::begin(outlet_slots), std::end(outlet_slots),
+      [comm](const auto& pair){ return IsCongruent(pair.first.GetComm(), comm); }
+    ) );
+
+    AssignSlots( inlet_slots );
+    AssignSlots( outlet_slots );
+
+    emp::vector<int> dests = TallyNeighbors(
+      inlet_slots, send_counts,
+      [](const auto& address){ return address.GetOutletProc(); }
+    );
+    emp::vector<int> sources = TallyNeighbors(
+      outlet_slots, recv_counts,
+      [](const auto& address){ return address.GetInletProc(); }
+    );
+    send_displs = ToDisplacements( send_counts );
+    recv_displs = ToDisplacements( recv_counts );
+
+    const bool participates = dests.size() || sources.size();
+    participant_comm = uitsl::split_comm(
+      [participates](const int){ return participates ? 0 : MPI_UNDEFINED; },
+      comm
+    );
+
+    if ( participates ) {
+      for (auto& rank : dests) rank = uitsl::translate_comm_rank(
+        rank, comm, participant_comm
+      );
+      for (auto& rank : sources) rank = uitsl::translate_comm_rank(
+        rank, comm, participant_comm
+      );
+
+      UITSL_Dist_graph_create_adjacent(
+        participant_comm, // MPI_Comm comm_old
+        sources.size(), // int indegree
+        sources.data(), // const int sources[]
+        MPI_UNWEIGHTED, // const int sourceweights[]
+        dests.size(), // int outdegree
+        dests.data(), // const int destinations[]
+        MPI_UNWEIGHTED, // const int destweights[]
+        MPI_INFO_NULL, // MPI_Info info
+        0, // int reorder
+        &graph_comm // MPI_Comm *comm_dist_graph
+      );
+    }
+
+    staged.resize( inlet_slots.size(), Packet{ T{}, 0 } );
+    send_buffer.resize( inlet_slots.size() );
+    recv_buffer.resize( outlet_slots.size() );
+    latest.resize( outlet_slots.size() );
+    num_unconsumed.resize( outlet_slots.size() );
+
+    initialized = true;
+  }
+
+  size_t LookupInletSlot(const address_t& address) const {
+    emp_assert( IsInitialized() );
+    return inlet_slots.at( address );
+  }
+
+  size_t LookupOutletSlot(const address_t& address) const {
+    emp_assert( IsInitialized() );
+    return outlet_slots.at( address );
+  }
+
+  /// Overwrite staged value for next exchange.
+  bool TryPut(const T& val, const size_t slot) {
+    const std::lock_guard guard{ mutex };
+    emp_assert( IsInitialized() );
+    staged[slot].value = val;
+    ++staged[slot].num_puts;
+    return true;
+  }
+
+  /// Mark an inlet as done putting for the current step.
+  bool TryFlush() {
+    const std::lock_guard guard{ mutex };
+    ++pending_flush_counter;
+    TryAdvance( false );
+    return true;
+  }
+
+  /**
+   * Take latest value received for slot, if any arrived since last call.
+   *
+   * @return number of puts made to slot since last call.
+   */
+  size_t TryConsumeGets(const size_t slot, T& dest) {
+    const std::lock_guard guard{ mutex };
+    TryAdvance( true );
+    const size_t res = std::exchange( num_unconsumed[slot], 0 );
+    if (res) dest = latest[slot];
+    return res;
+  }
+
+  size_t GetNumExchanges() const { return num_exchanges; }
+
+  constexpr static bool CanStep() { return false; }
+
+};
+
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_BACKEND_NEIGHBORHOODBACKEND_HPP_INCLUDE
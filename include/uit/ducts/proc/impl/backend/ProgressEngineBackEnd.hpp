@@ -0,0 +1,65 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_BACKEND_PROGRESSENGINEBACKEND_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_BACKEND_PROGRESSENGINEBACKEND_HPP_INCLUDE
+
+#include <memory>
+#include <mutex>
+#include <stddef.h>
+#include <unordered_map>
+
+#include "../../../../../uitsl/mpi/ProgressEngine.hpp"
+#include "../../../../../uitsl/mpi/ProgressThread.hpp"
+#include "../../../../../uitsl/parallel/thread_utils.hpp"
+
+namespace uit {
+
+/**
+ * Holds one `uitsl::ProgressEngine` per thread, shared by every duct the
+ * mesh assigns to that thread.
+ *
+ * Ducts look up their engine by the thread their address assigns them, so
+ * ducts may be constructed on one thread and then used on another. Ducts
+ * that offload progress share the process's `uitsl::ProgressThread`
+ * instead.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class ProgressEngineBackEnd {
+
+  // node-based, so references stay valid as engines are added
+  std::unordered_map<uitsl::thread_id_t, uitsl::ProgressEngine> engines;
+
+  std::shared_ptr<uitsl::ProgressThread> progress_thread;
+
+  std::mutex mutex;
+
+public:
+
+  void Initialize() { ; }
+
+  /**
+   * Get the engine serving thread, creating it if needed.
+   */
+  uitsl::ProgressEngine& GetEngine(const uitsl::thread_id_t thread) {
+    const std::lock_guard guard{ mutex };
+    return engines[thread];
+  }
+
+  /**
+   * Get the process's progress thread, starting it if needed.
+   */
+  uitsl::ProgressThread& GetProgressThread() {
+    const std::lock_guard guard{ mutex };
+    if ( !progress_thread ) progress_thread = uitsl::ProgressThread::Acquire();
+    return *progress_thread;
+  }
+
+  size_t GetNumEngines() const { return engines.size(); }
+
+};
+
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_BACKEND_PROGRESSENGINEBACKEND_HPP_INCLUDE
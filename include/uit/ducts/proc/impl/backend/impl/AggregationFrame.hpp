@@ -0,0 +1,111 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_AGGREGATIONFRAME_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_AGGREGATIONFRAME_HPP_INCLUDE
+
+#include <stddef.h>
+#include <tuple>
+#include <vector>
+
+#include "../../../../../../../third-party/cereal/include/cereal/types/vector.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/polyfill/span.hpp"
+
+namespace uit {
+
+/**
+ * Flat wire format for aggregated messages.
+ *
+ * A header holding, per slot, the slot's tag and the offset of its first
+ * payload, followed by all payloads laid out contiguously slot by slot.
+ * Slot `i` owns payloads `[offsets[i], offsets[i + 1])`.
+ *
+ * Capacity is retained across `Reset` so that a frame reused every flush
+ * stops allocating after warmup. Members are plain `std::vector`s so that
+ * cereal's vector overloads apply directly.
+ *
+ * @tparam T payload type.
+ */
+template<typename T>
+class AggregationFrame {
+
+  // header: tag of each slot
+  std::vector<int> tags;
+
+  // header: prefix sum of per-slot payload counts, size is num slots + 1
+  std::vector<size_t> offsets{ 0 };
+
+  // payloads, contiguous and grouped by slot
+  std::vector<T> payloads;
+
+public:
+
+  using value_type = T;
+
+  /// Clear all slots and payloads without releasing capacity.
+  void Reset() {
+    tags.clear();
+    offsets.resize(1);
+    payloads.clear();
+  }
+
+  /// Append a slot holding a copy of each payload in [first, last).
+  template<typename InputIt>
+  void AppendSlot(const int tag, InputIt first, InputIt last) {
+    tags.push_back( tag );
+    payloads.insert( std::end(payloads), first, last );
+    offsets.push_back( payloads.size() );
+  }
+
+  size_t GetNumSlots() const { return tags.size(); }
+
+  size_t GetNumPayloads() const { return payloads.size(); }
+
+  bool IsEmpty() const { return payloads.empty(); }
+
+  int GetTag(const size_t slot) const {
+    emp_assert( slot < GetNumSlots() );
+    return tags[slot];
+  }
+
+  const std::vector<int>& GetTags() const { return tags; }
+
+  size_t GetCount(const size_t slot) const {
+    emp_assert( slot < GetNumSlots() );
+    return offsets[slot + 1] - offsets[slot];
+  }
+
+  size_t GetOffset(const size_t slot) const {
+    emp_assert( slot < GetNumSlots() );
+    return offsets[slot];
+  }
+
+  T& GetPayload(const size_t slot, const size_t pos) {
+    emp_assert( pos < GetCount(slot) );
+    return payloads[ offsets[slot] + pos ];
+  }
+
+  const T& GetPayload(const size_t slot, const size_t pos) const {
+    emp_assert( pos < GetCount(slot) );
+    return payloads[ offsets[slot] + pos ];
+  }
+
+  std::span<const T> GetSlot(const size_t slot) const {
+    return std::span<const T>(
+      payloads.data() + GetOffset(slot),
+      GetCount(slot)
+    );
+  }
+
+  bool operator==(const AggregationFrame& other) const {
+    return std::tie( tags, offsets, payloads )
+      == std::tie( other.tags, other.offsets, other.payloads );
+  }
+
+  template<class Archive>
+  void serialize( Archive & archive ) { archive( tags, offsets, payloads ); }
+
+};
+
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_AGGREGATIONFRAME_HPP_INCLUDE
@@ -2,14 +2,13 @@
 #ifndef UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_AGGREGATORSPEC_HPP_INCLUDE
 #define UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_AGGREGATORSPEC_HPP_INCLUDE
 
-#include <map>
-
-#include "../../../../../../../third-party/cereal/include/cereal/types/map.hpp"
-
+#include "../../../../../setup/FlushPolicy.hpp"
 #include "../../../../../spouts/wrappers/TrivialSpoutWrapper.hpp"
 
 #include "../../../../mock/ThrowDuct.hpp"
 
+#include "AggregationFrame.hpp"
+
 namespace uit {
 
 template<
@@ -22,7 +21,7 @@ class AggregatorSpec {
 
 public:
 
-  using T = std::multimap< int, typename ImplSpec::T >;
+  using T = uit::AggregationFrame< typename ImplSpec::T >;
   template<typename Inlet>
   using inlet_wrapper_t =
     typename uit::TrivialSpoutWrapper<T>::template inlet_wrapper_t<Inlet>;
@@ -34,6 +33,10 @@ public:
   constexpr inline static size_t N{ ImplSpec::N };
   constexpr inline static size_t B{ ImplSpec::B };
 
+  // applied by the aggregator itself, deliberately not named FlushPolicy so
+  // that the backing duct does not pick it up too
+  using AggregateFlushPolicy = uit::get_flush_policy_t<ImplSpec>;
+
   using IntraDuct = uit::ThrowDuct<THIS_T>;
   using ThreadDuct = uit::ThrowDuct<THIS_T>;
 
@@ -0,0 +1,257 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_INLETFRAMECOALESCER_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_INLETFRAMECOALESCER_HPP_INCLUDE
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <set>
+#include <stddef.h>
+#include <utility>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/optional.hpp"
+
+#include "../../../../../../uitsl/parallel/cache_line.hpp"
+#include "../../../../../../uitsl/parallel/thread_utils.hpp"
+
+#include "../../../../../fixtures/Sink.hpp"
+#include "../../../../../setup/InterProcAddress.hpp"
+#include "../../../../../spouts/Inlet.hpp"
+
+namespace uit {
+
+/**
+ * Combines the frames that every inlet thread on this proc flushes to one
+ * outlet proc into a single frame, so that one message goes out per round
+ * instead of one per thread.
+ *
+ * Each inlet thread owns a segment that it deposits its frame into, without
+ * locking. A round completes once every thread has deposited. The thread
+ * that completes it packs all segments into one frame, sends it through the
+ * backing duct, and then reopens the segments. Threads that deposit again
+ * before then are refused, so they keep their data staged and retry.
+ *
+ * If the backing duct refuses the combined frame, it is kept and the
+ * segments stay closed. Refused depositors retry sending it, so no
+ * deposited data is lost.
+ *
+ * Every registered inlet thread must keep flushing for rounds to complete.
+ *
+ * @tparam AggregatorSpec spec of the frames sent.
+ */
+template<typename AggregatorSpec>
+class InletFrameCoalescer {
+
+  using address_t = uit::InterProcAddress;
+  std::set<address_t> addresses;
+
+  using T = typename AggregatorSpec::T;
+
+  template<typename Inlet>
+  using inlet_wrapper_t = typename AggregatorSpec::template inlet_wrapper_t<
+    Inlet
+  >;
+  emp::optional<inlet_wrapper_t<uit::Inlet<AggregatorSpec>>> inlet;
+
+  // inlet thread -> segment index, filled during initialization
+  std::map<uitsl::thread_id_t, size_t> segment_lookup;
+
+  struct alignas(uitsl::CACHE_LINE_SIZE) Segment {
+    T frame;
+    // set by the owning thread on deposit, cleared by the flushing thread
+    std::atomic<bool> full{};
+  };
+  std::unique_ptr<Segment[]> segments;
+
+  alignas(uitsl::CACHE_LINE_SIZE) std::atomic<size_t> num_full{};
+
+  // only touched by the thread that completes a round or, while unsent, by
+  // the retrying thread, reused between rounds
+  T combined;
+
+  // set while combined awaits room in the backing duct, handing it from the
+  // thread that completed the round over to retrying threads
+  alignas(uitsl::CACHE_LINE_SIZE) std::atomic<bool> unsent{};
+
+  // held by the thread retrying combined
+  std::atomic_flag retrying = ATOMIC_FLAG_INIT;
+
+  size_t GetNumSegments() const { return segment_lookup.size(); }
+
+  bool TrySendCombined() {
+    const bool res = combined.IsEmpty()
+      || inlet->TryPut( std::as_const(combined) );
+    inlet->TryFlush();
+    return res;
+  }
+
+  // must come last, since depositors may complete a new round right away
+  void ReopenSegments() {
+    num_full.store( 0, std::memory_order_relaxed );
+    for (size_t i{}; i < GetNumSegments(); ++i) {
+      segments[i].full.store( false, std::memory_order_release );
+    }
+  }
+
+  void TryRetryCombined() {
+    if ( !unsent.load( std::memory_order_acquire ) ) return;
+    if ( retrying.test_and_set( std::memory_order_acquire ) ) return;
+
+    if ( unsent.load( std::memory_order_acquire ) && TrySendCombined() ) {
+      unsent.store( false, std::memory_order_relaxed );
+      ReopenSegments();
+    }
+
+    retrying.clear( std::memory_order_release );
+  }
+
+  void FlushCombined() {
+
+    combined.Reset();
+    for (size_t i{}; i < GetNumSegments(); ++i) {
+      const auto& frame = segments[i].frame;
+      for (size_t slot{}; slot < frame.GetNumSlots(); ++slot) {
+        const auto span = frame.GetSlot( slot );
+        combined.AppendSlot(
+          frame.GetTag( slot ), std::begin( span ), std::end( span )
+        );
+      }
+    }
+
+    // if the backing duct is full, keep combined for refused depositors
+    // to retry
+    if ( TrySendCombined() ) ReopenSegments();
+    else unsent.store( true, std::memory_order_release );
+
+  }
+
+public:
+
+  /**
+   * Per-thread endpoint into the coalescer, used by an inlet thread's
+   * `uit::InletMemoryAggregator` in place of a backing duct inlet.
+   */
+  class SegmentInlet {
+
+    InletFrameCoalescer* coalescer;
+    size_t segment;
+
+    // whether a frame was deposited since the last flush
+    bool deposited{};
+
+  public:
+
+    SegmentInlet(InletFrameCoalescer& coalescer_, const size_t segment_)
+    : coalescer(&coalescer_)
+    , segment(segment_)
+    { ; }
+
+    /// Deposit frame into this thread's segment, refused if the previous
+    /// round has not yet gone out.
+    bool TryPut(const T& frame) {
+      deposited = coalescer->TryDeposit( segment, frame );
+      return deposited;
+    }
+
+    /// Complete this thread's part of the round, depositing an empty frame
+    /// if nothing was put.
+    bool TryFlush() {
+      if ( std::exchange( deposited, false ) ) return true;
+      else return coalescer->TryDeposit( segment, T{} );
+    }
+
+  };
+
+  bool IsInitialized() const { return inlet.has_value(); }
+
+  size_t GetSize() const { return addresses.size(); }
+
+  /// Register a duct whose inlet thread deposits into this coalescer.
+  void Register(const address_t& address) {
+    emp_assert( !IsInitialized() );
+    emp_assert( !addresses.count(address) );
+    addresses.insert(address);
+  }
+
+  /// Call after all ducts have registered.
+  void Initialize() {
+
+    emp_assert( !IsInitialized() );
+    emp_assert( !addresses.empty() );
+
+    emp_assert( std::all_of(
+      std::begin(addresses),
+      std::end(addresses),
+      [this](const auto& addr){ return (
+          addr.GetOutletProc() == addresses.begin()->GetOutletProc()
+          && addr.GetInletProc() == addresses.begin()->GetInletProc()
+          && addr.GetComm() == addresses.begin()->GetComm()
+        );
+      }
+    ) );
+
+    auto backend = std::make_shared<
+      typename AggregatorSpec::ProcBackEnd
+    >();
+
+    auto sink = uit::Sink<AggregatorSpec>{
+      std::in_place_type_t<
+        typename AggregatorSpec::ProcInletDuct
+      >{},
+      *addresses.begin(),
+      backend
+    };
+
+    backend->Initialize();
+
+    inlet = sink.GetInlet();
+
+    for (const auto& address : addresses) segment_lookup.emplace(
+      address.GetInletThread(), segment_lookup.size()
+    );
+    segments = std::make_unique<Segment[]>( GetNumSegments() );
+
+  }
+
+  /// Get the endpoint for inlet thread, one per thread.
+  SegmentInlet GetSegmentInlet(const uitsl::thread_id_t thread) {
+    emp_assert( IsInitialized() );
+    return SegmentInlet{ *this, segment_lookup.at( thread ) };
+  }
+
+  /**
+   * Copy frame into segment and, if that completes the round, send the
+   * combined frame. Only the segment's owning thread may call.
+   *
+   * @return false if the segment still holds a deposit from the previous
+   * round, which has not yet gone out.
+   */
+  bool TryDeposit(const size_t segment, const T& frame) {
+    emp_assert( IsInitialized() );
+
+    auto& target = segments[segment];
+    if ( target.full.load( std::memory_order_acquire ) ) {
+      TryRetryCombined();
+      return false;
+    }
+
+    target.frame = frame;
+    target.full.store( true, std::memory_order_relaxed );
+
+    // last depositor of the round sees every other segment's frame
+    if (
+      num_full.fetch_add( 1, std::memory_order_acq_rel ) + 1
+      == GetNumSegments()
+    ) FlushCombined();
+
+    return true;
+
+  }
+
+};
+
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_INLETFRAMECOALESCER_HPP_INCLUDE
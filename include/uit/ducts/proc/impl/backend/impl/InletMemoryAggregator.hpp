@@ -5,32 +5,69 @@
 #include <algorithm>
 #include <mutex>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 
 #include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
 #include "../../../../../../../third-party/Empirical/include/emp/base/optional.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/vector.hpp"
 
 #include "../../../../../fixtures/Sink.hpp"
 #include "../../../../../setup/InterProcAddress.hpp"
 #include "../../../../../spouts/Inlet.hpp"
 
+#include "../../inlet/templated/impl/FlushTrigger.hpp"
+
 namespace uit {
 
-template<typename AggregatorSpec>
+/**
+ * Stages puts from a thread's ducts to one proc and flushes them together as
+ * a single `uit::AggregationFrame`.
+ *
+ * @tparam AggregatorSpec spec of the frames sent.
+ * @tparam FrameInlet endpoint frames are put into, by default an inlet to a
+ * dedicated backing proc duct.
+ */
+template<
+  typename AggregatorSpec,
+  typename FrameInlet=typename AggregatorSpec::template inlet_wrapper_t<
+    uit::Inlet<AggregatorSpec>
+  >
+>
 class InletMemoryAggregator {
 
   using address_t = uit::InterProcAddress;
   std::set<address_t> addresses;
 
-  template<typename T>
-  using inlet_wrapper_t = typename AggregatorSpec::template inlet_wrapper_t<T>;
-  emp::optional<inlet_wrapper_t<uit::Inlet<AggregatorSpec>>> inlet;
+  emp::optional<FrameInlet> inlet;
 
-  // multimap of tag -> data
+  // flat frame of tag-grouped data, handed to inlet as an rvalue each flush
+  // serializing inlets leave it intact, so its capacity is reused next flush;
+  // inlets that store frames take its buffers instead of copying them
   using T = typename AggregatorSpec::T;
-  T buffer{};
+  T frame{};
 
   constexpr static inline size_t B{ AggregatorSpec::B };
 
+  using value_type = typename AggregatorSpec::T::value_type;
+
+  // tag -> slot index, filled during initialization
+  std::unordered_map<int, size_t> slot_lookup;
+
+  // slot index -> tag
+  emp::vector<int> slot_tags;
+
+  // slot index -> data staged since last flush
+  // (capacity is retained between flushes)
+  emp::vector<emp::vector<value_type>> staged;
+
+  // total number of items staged across all slots
+  size_t num_staged{};
+
+  using flush_policy_t = typename AggregatorSpec::AggregateFlushPolicy;
+  uit::internal::FlushTrigger<flush_policy_t, value_type> flush_trigger;
+
   // incremented every time TryFlush is called
   // then reset to zero once every member of the pool has called
   size_t pending_flush_counter{};
@@ -39,24 +76,44 @@ class InletMemoryAggregator {
     std::unordered_set<size_t> flush_index_checker;
   #endif
 
-  using value_type = typename AggregatorSpec::T::mapped_type;
+  void PackFrame() {
+    frame.Reset();
+    for (size_t slot{}; slot < staged.size(); ++slot) frame.AppendSlot(
+      slot_tags[slot],
+      std::begin( staged[slot] ),
+      std::end( staged[slot] )
+    );
+  }
+
+  void ClearStaged() {
+    for (auto& slot_buffer : staged) slot_buffer.clear();
+    num_staged = 0;
+  }
 
-  bool FlushAggregate() {
+  // send everything staged, independent of the pool's TryFlush round
+  bool FlushStaged() {
     emp_assert( IsInitialized() );
 
-    pending_flush_counter = 0;
-    #ifndef NDEBUG
-      flush_index_checker.clear();
-    #endif
+    if ( num_staged == 0 ) return inlet->TryFlush();
 
-    if ( buffer.empty() ) return inlet->TryFlush();
-    else if ( inlet->TryPut( std::move(buffer) ) ) {
-      buffer.clear();
+    PackFrame();
+    if ( inlet->TryPut( std::move(frame) ) ) {
+      ClearStaged();
+      flush_trigger.Reset();
       return inlet->TryFlush();
     } else return false;
 
   }
 
+  // called once every member of the pool has called TryFlush
+  bool FlushAggregate() {
+    pending_flush_counter = 0;
+    #ifndef NDEBUG
+      flush_index_checker.clear();
+    #endif
+    return FlushStaged();
+  }
+
   void CheckCallingProc() const {
     [[maybe_unused]] const auto& rep = *addresses.begin();
     emp_assert( rep.GetInletProc() == uitsl::get_rank( rep.GetComm() ) );
@@ -80,8 +137,15 @@ public:
     emp_assert( IsInitialized() );
     CheckCallingProc();
 
-    if (buffer.count(tag) < B) {
-      buffer.emplace( std::make_pair( tag, val) );
+    auto& slot_buffer = staged[ slot_lookup.at(tag) ];
+    if (slot_buffer.size() < B) {
+      slot_buffer.push_back( val );
+      ++num_staged;
+      // if the backing inlet is full, items stay staged and the trigger
+      // stays set, so the flush is retried on the next put or TryFlush
+      if ( flush_trigger.RecordPut( [this](){ return FlushStaged(); } ) ) {
+        FlushStaged();
+      }
       return true;
     } else return false;
 
@@ -96,6 +160,8 @@ public:
     emp_assert( flush_index_checker.insert(tag).second );
 
     if ( ++pending_flush_counter == addresses.size() ) return FlushAggregate();
+    // don't hold overdue items until the rest of the pool calls
+    else if ( flush_trigger.IsOverdue() ) return FlushStaged();
     else return true;
 
   }
@@ -103,18 +169,7 @@ public:
   /// Call after all members have requested a position in the pool.
   void Initialize() {
 
-    emp_assert( !IsInitialized() );
-
-    emp_assert( std::all_of(
-      std::begin(addresses),
-      std::end(addresses),
-      [this](const auto& addr){ return (
-          addr.GetOutletProc() == addresses.begin()->GetOutletProc()
-          && addr.GetInletThread() == addresses.begin()->GetInletThread()
-          && addr.GetComm() == addresses.begin()->GetComm()
-        );
-      }
-    ) );
+    CheckAddresses();
 
     auto backend = std::make_shared<
       typename AggregatorSpec::ProcBackEnd
@@ -132,6 +187,49 @@ public:
 
     inlet = sink.GetInlet();
 
+    InitializeSlots();
+
+  }
+
+  /// Call after all members have requested a position in the pool, sending
+  /// frames through inlet_ instead of a dedicated backing duct.
+  void Initialize(FrameInlet inlet_) {
+
+    CheckAddresses();
+
+    inlet = std::move(inlet_);
+
+    InitializeSlots();
+
+  }
+
+private:
+
+  void CheckAddresses() const {
+
+    emp_assert( !IsInitialized() );
+
+    emp_assert( std::all_of(
+      std::begin(addresses),
+      std::end(addresses),
+      [this](const auto& addr){ return (
+          addr.GetOutletProc() == addresses.begin()->GetOutletProc()
+          && addr.GetInletThread() == addresses.begin()->GetInletThread()
+          && addr.GetComm() == addresses.begin()->GetComm()
+        );
+      }
+    ) );
+
+  }
+
+  void InitializeSlots() {
+
+    for (const auto& address : addresses) {
+      slot_lookup.emplace( address.GetTag(), slot_tags.size() );
+      slot_tags.push_back( address.GetTag() );
+    }
+    staged.resize( slot_tags.size() );
+
   }
 
 };
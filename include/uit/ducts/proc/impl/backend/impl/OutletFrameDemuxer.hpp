@@ -0,0 +1,198 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_OUTLETFRAMEDEMUXER_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_OUTLETFRAMEDEMUXER_HPP_INCLUDE
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stddef.h>
+#include <unordered_map>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/optional.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../../../../../uitsl/datastructs/SpscRingBuffer.hpp"
+#include "../../../../../../uitsl/parallel/thread_utils.hpp"
+
+#include "../../../../../fixtures/Source.hpp"
+#include "../../../../../setup/InterProcAddress.hpp"
+#include "../../../../../spouts/Outlet.hpp"
+
+namespace uit {
+
+/**
+ * Splits the combined frames that one inlet proc sends to this proc, see
+ * `uit::InletFrameCoalescer`, into per outlet thread frames.
+ *
+ * Whichever outlet thread steps first receives from the backing duct and
+ * pushes each thread's share of every frame onto that thread's lock-free
+ * channel. Other threads step concurrently without waiting, consuming what
+ * is already on their own channels. Shares are dropped while a channel holds
+ * N unconsumed frames.
+ *
+ * @tparam AggregatorSpec spec of the frames received.
+ */
+template<typename AggregatorSpec>
+class OutletFrameDemuxer {
+
+  using address_t = uit::InterProcAddress;
+  std::set<address_t> addresses;
+
+  using T = typename AggregatorSpec::T;
+
+  constexpr inline static size_t N{ AggregatorSpec::N };
+
+  template<typename Outlet>
+  using outlet_wrapper_t = typename AggregatorSpec::template outlet_wrapper_t<
+    Outlet
+  >;
+  emp::optional<outlet_wrapper_t<uit::Outlet<AggregatorSpec>>> outlet;
+
+  // guards outlet, split, and the producer end of every channel
+  std::mutex mutex;
+
+  // outlet thread -> channel index, filled during initialization
+  std::map<uitsl::thread_id_t, size_t> channel_lookup;
+
+  // tag -> channel index, filled during initialization
+  std::unordered_map<int, size_t> tag_lookup;
+
+  // front is the owning thread's current frame
+  // one extra to hold the current frame alongside N unconsumed frames
+  using channel_t = uitsl::SpscRingBuffer<T, N + 1>;
+  std::unique_ptr<channel_t[]> channels;
+
+  // channel index -> share of the frame being split, reused between frames
+  emp::vector<T> split;
+
+  size_t GetNumChannels() const { return channel_lookup.size(); }
+
+  void Demultiplex(const T& frame) {
+
+    for (auto& share : split) share.Reset();
+
+    for (size_t slot{}; slot < frame.GetNumSlots(); ++slot) {
+      const auto span = frame.GetSlot( slot );
+      split[ tag_lookup.at( frame.GetTag( slot ) ) ].AppendSlot(
+        frame.GetTag( slot ), std::begin( span ), std::end( span )
+      );
+    }
+
+    for (size_t i{}; i < GetNumChannels(); ++i) {
+      if ( !split[i].IsEmpty() ) channels[i].TryPush( std::as_const(split[i]) );
+    }
+
+  }
+
+  /// Distribute every frame received so far, unless another thread is.
+  void Pump() {
+    const std::unique_lock lock{ mutex, std::try_to_lock };
+    if ( !lock.owns_lock() ) return;
+    while ( outlet->TryStep( 1 ) ) Demultiplex( outlet->Get() );
+  }
+
+public:
+
+  /**
+   * Per-thread endpoint out of the demuxer, used by an outlet thread's
+   * `uit::OutletMemoryAggregator` in place of a backing duct outlet.
+   */
+  class ChannelOutlet {
+
+    OutletFrameDemuxer* demuxer;
+    channel_t* channel;
+
+  public:
+
+    ChannelOutlet(OutletFrameDemuxer& demuxer_, const size_t channel_)
+    : demuxer(&demuxer_)
+    , channel(&demuxer_.channels[channel_])
+    { ; }
+
+    /// Step past up to num_requested frames, returns number stepped.
+    size_t TryStep(const size_t num_requested) {
+      demuxer->Pump();
+      const size_t num_stepped = std::min(
+        channel->GetSize() - 1, num_requested
+      );
+      for (size_t i{}; i < num_stepped; ++i) channel->Pop();
+      return num_stepped;
+    }
+
+    T& Get() { return channel->GetFront(); }
+
+    const T& Get() const { return channel->GetFront(); }
+
+  };
+
+  bool IsInitialized() const { return outlet.has_value(); }
+
+  size_t GetSize() const { return addresses.size(); }
+
+  /// Register a duct whose outlet thread steps through this demuxer.
+  void Register(const address_t& address) {
+    emp_assert( !IsInitialized() );
+    emp_assert( !addresses.count(address) );
+    addresses.insert(address);
+  }
+
+  /// Call after all ducts have registered.
+  void Initialize() {
+
+    emp_assert( !IsInitialized() );
+    emp_assert( !addresses.empty() );
+
+    emp_assert( std::all_of(
+      std::begin(addresses),
+      std::end(addresses),
+      [this](const auto& addr){ return (
+          addr.GetInletProc() == addresses.begin()->GetInletProc()
+          && addr.GetOutletProc() == addresses.begin()->GetOutletProc()
+          && addr.GetComm() == addresses.begin()->GetComm()
+        );
+      }
+    ) );
+
+    auto backend = std::make_shared<
+      typename AggregatorSpec::ProcBackEnd
+    >();
+
+    auto source = uit::Source<AggregatorSpec>{
+      std::in_place_type_t<
+        typename AggregatorSpec::ProcOutletDuct
+      >{},
+      *addresses.begin(),
+      backend
+    };
+
+    backend->Initialize();
+
+    outlet = source.GetOutlet();
+
+    for (const auto& address : addresses) {
+      const auto [it, __] = channel_lookup.emplace(
+        address.GetOutletThread(), channel_lookup.size()
+      );
+      tag_lookup.emplace( address.GetTag(), it->second );
+    }
+
+    channels = std::make_unique<channel_t[]>( GetNumChannels() );
+    for (size_t i{}; i < GetNumChannels(); ++i) channels[i].TryPush( T{} );
+    split.resize( GetNumChannels() );
+
+  }
+
+  /// Get the endpoint for outlet thread, one per thread.
+  ChannelOutlet GetChannelOutlet(const uitsl::thread_id_t thread) {
+    emp_assert( IsInitialized() );
+    return ChannelOutlet{ *this, channel_lookup.at( thread ) };
+  }
+
+};
+
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_OUTLETFRAMEDEMUXER_HPP_INCLUDE
@@ -3,13 +3,17 @@
 #define UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_OUTLETMEMORYAGGREGATOR_HPP_INCLUDE
 
 #include <algorithm>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <memory>
 #include <mutex>
 #include <set>
+#include <unordered_map>
 
 #include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
 #include "../../../../../../../third-party/Empirical/include/emp/base/optional.hpp"
-
-#include "../../../../../../uitsl/algorithm/upper_uniquify.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/vector.hpp"
 
 #include "../../../../../fixtures/Source.hpp"
 #include "../../../../../setup/InterProcAddress.hpp"
@@ -17,21 +21,82 @@
 
 namespace uit {
 
-template<typename AggregatorSpec>
+/**
+ * Receives `uit::AggregationFrame`s from one proc and serves their payloads
+ * to a thread's ducts.
+ *
+ * At most `AggregatorSpec::N` received frames are retained. Once more arrive,
+ * slots still reading from the oldest frame keep a copy of their current
+ * value and drop the rest of that frame, so a slow slot cannot pin an
+ * unbounded backlog of frames.
+ *
+ * @tparam AggregatorSpec spec of the frames received.
+ * @tparam FrameOutlet endpoint frames are stepped out of, by default an
+ * outlet from a dedicated backing proc duct.
+ */
+template<
+  typename AggregatorSpec,
+  typename FrameOutlet=typename AggregatorSpec::template outlet_wrapper_t<
+    uit::Outlet<AggregatorSpec>
+  >
+>
 class OutletMemoryAggregator {
 
   using address_t = uit::InterProcAddress;
   std::set<address_t> addresses;
 
-  template<typename T>
-  using outlet_wrapper_t = typename AggregatorSpec::template outlet_wrapper_t<
-    T
-  >;
-  emp::optional<outlet_wrapper_t<uit::Outlet<AggregatorSpec>>> outlet;
+  emp::optional<FrameOutlet> outlet;
 
-  // multimap of index -> value_type
   using T = typename AggregatorSpec::T;
-  T buffer{};
+  using value_type = typename AggregatorSpec::T::value_type;
+
+  constexpr inline static size_t npos{ std::numeric_limits<size_t>::max() };
+
+  constexpr inline static size_t max_frames{ AggregatorSpec::N };
+  static_assert( max_frames > 0 );
+
+  // a received frame along with its header translated into local slots
+  struct ReceivedFrame {
+
+    T frame;
+
+    // local slot -> position in frame header, or npos if absent
+    // (shared between consecutive frames with identical headers)
+    std::shared_ptr<const emp::vector<size_t>> header_positions;
+
+    // number of slot cursors currently resting within this frame
+    size_t num_cursors{};
+
+    size_t GetCount(const size_t slot) const {
+      const size_t pos = (*header_positions)[slot];
+      return pos == npos ? 0 : frame.GetCount(pos);
+    }
+
+    value_type& GetPayload(const size_t slot, const size_t i) {
+      return frame.GetPayload( (*header_positions)[slot], i );
+    }
+
+  };
+
+  // received frames still referenced by some slot, oldest first
+  std::deque<ReceivedFrame> frames;
+
+  // sequence number of frames.front()
+  size_t frames_base{};
+
+  // per-slot ring index into received frames
+  // (a cursor whose frame has been evicted is parked on a copy of its value)
+  struct Cursor {
+    size_t frame_seq;
+    size_t pos;
+  };
+  emp::vector<Cursor> cursors;
+
+  // slot -> value kept from an evicted frame, served while parked
+  emp::vector<value_type> parked;
+
+  // tag -> slot index, filled during initialization
+  std::unordered_map<int, size_t> slot_lookup;
 
   // incremented every time TryConsumeGets is called with
   // requested == std::numeric_limits<size_t>::max()
@@ -41,8 +106,6 @@ class OutletMemoryAggregator {
   size_t current_request{}; // num jump steps requested in current round
   size_t current_num_consumed{}; // num jump steps realized in current round
 
-  using value_type = typename AggregatorSpec::T::mapped_type;
-
   std::unordered_map<int, bool> hit_since_last_consume;
   bool dry_flag{ false };
 
@@ -55,42 +118,152 @@ class OutletMemoryAggregator {
     } else return false;
   }
 
-  size_t DoTryStepGets(const size_t num_requested, const int tag) {
+  ReceivedFrame& GetFrame(const size_t seq) {
+    emp_assert( seq >= frames_base && seq - frames_base < frames.size() );
+    return frames[ seq - frames_base ];
+  }
+
+  const ReceivedFrame& GetFrame(const size_t seq) const {
+    emp_assert( seq >= frames_base && seq - frames_base < frames.size() );
+    return frames[ seq - frames_base ];
+  }
+
+  size_t GetEndSeq() const { return frames_base + frames.size(); }
 
-    size_t num_requested_countdown{ num_requested };
+  bool IsParked(const size_t slot) const {
+    return cursors[slot].frame_seq < frames_base;
+  }
 
-    do {
+  // number of values available to slot at its cursor's frame
+  size_t GetCursorCount(const size_t slot) const {
+    return IsParked( slot )
+      ? 1
+      : GetFrame( cursors[slot].frame_seq ).GetCount( slot );
+  }
 
-      emp_assert( buffer.count( tag ) );
+  void IngestFrame(T&& frame) {
+
+    const auto& tags = frame.GetTags();
+
+    // inlets send the same header every flush, so usually reuse translation
+    auto header_positions = (
+      !frames.empty() && frames.back().frame.GetTags() == tags
+    ) ? frames.back().header_positions
+      : [this, &tags](){
+        auto res = std::make_shared<emp::vector<size_t>>(
+          cursors.size(), npos
+        );
+        for (size_t pos{}; pos < tags.size(); ++pos) {
+          const auto it = slot_lookup.find( tags[pos] );
+          if ( it != std::end(slot_lookup) ) (*res)[ it->second ] = pos;
+        }
+        return std::shared_ptr<const emp::vector<size_t>>( res );
+      }();
 
-      const auto lower_bound = buffer.lower_bound( tag );
+    frames.push_back( ReceivedFrame{ std::move(frame), header_positions } );
+
+    while ( frames.size() > max_frames ) EvictFrame();
+
+  }
+
+  // drop oldest frame, parking any cursors still resting in it
+  void EvictFrame() {
+    auto& front = frames.front();
+    for (size_t slot{}; front.num_cursors; ++slot) {
+      emp_assert( slot < cursors.size() );
+      auto& cursor = cursors[slot];
+      if ( cursor.frame_seq != frames_base ) continue;
+      parked[slot] = std::move( front.GetPayload( slot, cursor.pos ) );
+      cursor.pos = 0;
+      --front.num_cursors;
+    }
+    frames.pop_front();
+    ++frames_base;
+  }
+
+  void ReleaseFrames() {
+    while ( !frames.empty() && frames.front().num_cursors == 0 ) {
+      frames.pop_front();
+      ++frames_base;
+    }
+  }
+
+  void MoveCursor(const size_t slot, const size_t seq, const size_t pos) {
+    auto& cursor = cursors[slot];
+    if ( !IsParked( slot ) ) --GetFrame( cursor.frame_seq ).num_cursors;
+    cursor = Cursor{ seq, pos };
+    ++GetFrame( seq ).num_cursors;
+    ReleaseFrames();
+  }
+
+  // advance slot through buffered frames, returns number of steps taken
+  size_t AdvanceCursor(const size_t slot, const size_t num_requested) {
+
+    size_t num_advanced{};
+
+    while ( num_advanced < num_requested ) {
+
+      auto& cursor = cursors[slot];
+      const size_t count = GetCursorCount( slot );
+      emp_assert( count );
+
+      // always retain at least one value
       const size_t cur_step = std::min(
-        num_requested_countdown,
-        buffer.count( tag ) - 1
+        num_requested - num_advanced,
+        count - cursor.pos - 1
       );
-      buffer.erase(
-        lower_bound,
-        std::next(lower_bound, cur_step)
-      );
-      num_requested_countdown -= cur_step;
+      cursor.pos += cur_step;
+      num_advanced += cur_step;
+
+      if ( num_advanced == num_requested ) break;
+
+      // hop to next buffered frame with data for this slot, if any
+      size_t seq{ std::max( cursor.frame_seq + 1, frames_base ) };
+      while ( seq < GetEndSeq() && GetFrame(seq).GetCount(slot) == 0 ) ++seq;
+
+      if ( seq == GetEndSeq() ) break;
+
+      MoveCursor( slot, seq, 0 );
+      ++num_advanced;
 
-    } while (
-      num_requested_countdown
+    }
+
+    return num_advanced;
+
+  }
+
+  void JumpCursor(const size_t slot) {
+    const size_t first_seq{ std::max( cursors[slot].frame_seq, frames_base ) };
+    for (size_t seq{ GetEndSeq() }; seq-- > first_seq; ) {
+      if ( const size_t count = GetFrame(seq).GetCount(slot); count ) {
+        MoveCursor( slot, seq, count - 1 );
+        return;
+      }
+    }
+  }
+
+  bool TryIngestNextFrame() {
+    const bool res = outlet->TryStep( 1 );
+    dry_flag = !res;
+    if ( res ) IngestFrame( std::move( outlet->Get() ) );
+    return res;
+  }
+
+  size_t DoTryStepGets(const size_t num_requested, const int tag) {
+
+    const size_t slot = slot_lookup.at( tag );
+
+    size_t num_consumed{ AdvanceCursor( slot, num_requested ) };
+
+    while (
+      num_consumed < num_requested
       && PreventRedundantDryConsumes( tag )
-      && [this](){
-        const bool res = outlet->TryStep( 1 );
-        dry_flag = !res;
-        return res;
-      }()
-      && [this](){
-        buffer.merge( outlet->Get() );
-        return true;
-      }()
-    );
+      && TryIngestNextFrame()
+    ) num_consumed += AdvanceCursor( slot, num_requested - num_consumed );
 
     hit_since_last_consume[tag] = true;
 
-    return num_requested - num_requested_countdown;
+    return num_consumed;
 
   }
 
@@ -103,12 +276,12 @@ class OutletMemoryAggregator {
 
     // estimate value steps
     const size_t approx_steps = (
-      buffer_steps * outlet->Get().size() / addresses.size()
+      buffer_steps * outlet->Get().GetNumPayloads() / addresses.size()
     );
 
-    buffer.merge( outlet->Get() );
+    if ( buffer_steps ) IngestFrame( std::move( outlet->Get() ) );
 
-    uitsl::upper_uniquify( buffer );
+    for (size_t slot{}; slot < cursors.size(); ++slot) JumpCursor( slot );
 
     return approx_steps;
 
@@ -134,16 +307,15 @@ public:
   value_type& Get(const int tag) {
     emp_assert( IsInitialized() );
     CheckCallingProc();
-    emp_assert( buffer.count(tag) );
-    return buffer.lower_bound(tag)->second;
+    const size_t slot = slot_lookup.at( tag );
+    const auto& cursor = cursors[slot];
+    if ( IsParked( slot ) ) return parked[slot];
+    return GetFrame( cursor.frame_seq ).GetPayload( slot, cursor.pos );
   }
 
   /// Get the querying duct's current value from the underlying duct.
   const value_type& Get(const int tag) const {
-    emp_assert( IsInitialized() );
-    CheckCallingProc();
-    emp_assert( buffer.count(tag) );
-    return buffer.lower_bound(tag)->second;
+    return const_cast<OutletMemoryAggregator*>(this)->Get( tag );
   }
 
   /// Every member of the pool should call this with same requested.
@@ -173,19 +345,7 @@ public:
   /// Call after all members have requested a position in the pool.
   void Initialize() {
 
-    emp_assert( !IsInitialized() );
-
-    emp_assert( std::all_of(
-      std::begin(addresses),
-      std::end(addresses),
-      [this](const auto& addr){ return (
-          addr.GetInletProc() == addresses.begin()->GetInletProc()
-          && addr.GetOutletThread() == addresses.begin()->GetOutletThread()
-          && addr.GetComm() == addresses.begin()->GetComm()
-        );
-      }
-    ) );
-    emp_assert( !addresses.empty() );
+    CheckAddresses();
 
     auto backend = std::make_shared<
       typename AggregatorSpec::ProcBackEnd
@@ -203,14 +363,55 @@ public:
 
     outlet = source.GetOutlet();
 
-    std::transform(
+    InitializeSlots();
+
+  }
+
+  /// Call after all members have requested a position in the pool, stepping
+  /// frames out of outlet_ instead of a dedicated backing duct.
+  void Initialize(FrameOutlet outlet_) {
+
+    CheckAddresses();
+
+    outlet = std::move(outlet_);
+
+    InitializeSlots();
+
+  }
+
+private:
+
+  void CheckAddresses() const {
+
+    emp_assert( !IsInitialized() );
+
+    emp_assert( std::all_of(
       std::begin(addresses),
       std::end(addresses),
-      std::inserter( buffer, std::end(buffer) ),
-      [](const auto& address){
-        return std::pair{ address.GetTag(), value_type{} };
+      [this](const auto& addr){ return (
+          addr.GetInletProc() == addresses.begin()->GetInletProc()
+          && addr.GetOutletThread() == addresses.begin()->GetOutletThread()
+          && addr.GetComm() == addresses.begin()->GetComm()
+        );
       }
-    );
+    ) );
+    emp_assert( !addresses.empty() );
+
+  }
+
+  void InitializeSlots() {
+
+    // seed frame holds a value-initialized entry for every slot
+    T seed;
+    const value_type init{};
+    for (const auto& address : addresses) {
+      slot_lookup.emplace( address.GetTag(), slot_lookup.size() );
+      seed.AppendSlot( address.GetTag(), &init, std::next(&init) );
+    }
+    cursors.assign( addresses.size(), Cursor{ frames_base, 0 } );
+    parked.resize( addresses.size() );
+    IngestFrame( std::move(seed) );
+    frames.back().num_cursors = cursors.size();
 
     std::transform(
       std::begin(addresses),
@@ -0,0 +1,183 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_INLET_ACCUMULATING_TYPE_FUNDAMENTAL_F__NOTIFYACCUMULATEDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_INLET_ACCUMULATING_TYPE_FUNDAMENTAL_F__NOTIFYACCUMULATEDUCT_HPP_INCLUDE
+
+#include <memory>
+#include <stddef.h>
+#include <string>
+
+#include <mpi.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+#include "../../../../../../uitsl/distributed/LockAllWindowManager.hpp"
+#include "../../../../../../uitsl/distributed/RdmaAccumulatorPacket.hpp"
+#include "../../../../../../uitsl/distributed/RdmaNotifiedPacket.hpp"
+#include "../../../../../../uitsl/meta/f::static_test.hpp"
+#include "../../../../../../uitsl/mpi/audited_routines.hpp"
+#include "../../../../../../uitsl/mpi/mpi_utils.hpp"
+#include "../../../../../../uitsl/mpi/Request.hpp"
+#include "../../../../../../uitsl/mpi/request_utils.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/LockAllRdmaBackEnd.hpp"
+
+namespace uit {
+namespace f {
+
+/**
+ * Accumulates each value into the outlet's window, then bumps a separate
+ * counter so the outlet can tell there is something to withdraw without
+ * reading the packet.
+ *
+ * The packet is flushed to the target before the counter is bumped, so a
+ * moved counter always means the packet already holds the new value.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class NotifyAccumulateDuct {
+
+public:
+
+  using BackEndImpl = uit::LockAllRdmaBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::f::static_test<T>(), uitsl_f_message );
+  using packet_t = uitsl::RdmaAccumulatorPacket<T>;
+  using notified_packet_t = uitsl::RdmaNotifiedPacket<packet_t>;
+
+  // origin buffers, reusable once flushed
+  packet_t send_buffer{};
+  inline static const size_t increment{ 1 };
+
+  bool pending_notification{};
+
+  const uit::InterProcAddress address;
+
+  std::shared_ptr<BackEndImpl> back_end;
+
+  uitsl::Request target_offset_request;
+  int target_offset;
+
+  uitsl::LockAllWindowManager& GetWindowManager() {
+    return back_end->GetWindowManager();
+  }
+
+  void FlushNotification() {
+    GetWindowManager().Flush( address.GetOutletProc() );
+    pending_notification = false;
+  }
+
+public:
+
+  NotifyAccumulateDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end_
+  ) : address(address_)
+  , back_end(back_end_)
+  {
+    if (uitsl::get_rank(address.GetComm()) == address.GetInletProc()) {
+      GetWindowManager().Activate();
+      UITSL_Irecv(
+        &target_offset, // void *buf
+        1, // int count
+        MPI_INT, // MPI_Datatype datatype
+        address.GetOutletProc(), // int source
+        address.GetTag(), // int tag
+        address.GetComm(), // MPI_Comm comm
+        &target_offset_request // MPI_Request *request
+      );
+    }
+  }
+
+  ~NotifyAccumulateDuct() {
+    if ( pending_notification ) FlushNotification();
+    if ( !uitsl::test_null( target_offset_request ) ) UITSL_Wait(
+      &target_offset_request, MPI_STATUS_IGNORE
+    );
+  }
+
+  /**
+   * Add val into the outlet's window and notify the outlet.
+   *
+   * Blocks on remote completion of the accumulate.
+   *
+   * @param val value to add.
+   */
+  bool TryPut(const T& val) {
+
+    // outlet sends its slot offset during setup
+    if ( !uitsl::test_null( target_offset_request ) ) UITSL_Wait(
+      &target_offset_request, MPI_STATUS_IGNORE
+    );
+
+    send_buffer = packet_t( val, 1 );
+    GetWindowManager().template Accumulate<T>(
+      address.GetOutletProc(),
+      send_buffer.m_array,
+      2,
+      target_offset + notified_packet_t::GetPayloadOffset(),
+      MPI_SUM
+    );
+    // also completes the previous notification
+    GetWindowManager().Flush( address.GetOutletProc() );
+
+    GetWindowManager().template Accumulate<size_t>(
+      address.GetOutletProc(),
+      &increment,
+      1,
+      target_offset + notified_packet_t::GetCounterOffset(),
+      MPI_SUM
+    );
+    pending_notification = true;
+
+    return true;
+
+  }
+
+  /**
+   * Make the latest notification visible to the outlet.
+   */
+  bool TryFlush() {
+    if ( pending_notification ) FlushNotification();
+    return true;
+  }
+
+  [[noreturn]] size_t TryConsumeGets(size_t) const {
+    emp_always_assert(false, "ConsumeGets called on NotifyAccumulateDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] const T& Get() const {
+    emp_always_assert(false, "Get called on NotifyAccumulateDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] T& Get() {
+    emp_always_assert(false, "Get called on NotifyAccumulateDuct");
+    __builtin_unreachable();
+  }
+
+  static std::string GetType() { return "NotifyAccumulateDuct"; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetType() << std::endl;
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << std::endl;
+    ss << uitsl::format_member("InterProcAddress address", address) << std::endl;
+    return ss.str();
+  }
+
+};
+
+} // namespace f
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_INLET_ACCUMULATING_TYPE_FUNDAMENTAL_F__NOTIFYACCUMULATEDUCT_HPP_INCLUDE
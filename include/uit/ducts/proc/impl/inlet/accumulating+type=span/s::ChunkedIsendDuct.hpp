@@ -0,0 +1,211 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_INLET_ACCUMULATING_TYPE_SPAN_S__CHUNKEDISENDDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_INLET_ACCUMULATING_TYPE_SPAN_S__CHUNKEDISENDDUCT_HPP_INCLUDE
+
+#include <memory>
+#include <stddef.h>
+#include <string>
+#include <utility>
+
+#include <mpi.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+#include "../../../../../../uitsl/datastructs/RingBuffer.hpp"
+#include "../../../../../../uitsl/debug/err_audit.hpp"
+#include "../../../../../../uitsl/debug/safe_cast.hpp"
+#include "../../../../../../uitsl/distributed/MsgAccumulatorBundle.hpp"
+#include "../../../../../../uitsl/distributed/MsgChunkLayout.hpp"
+#include "../../../../../../uitsl/meta/s::static_test.hpp"
+#include "../../../../../../uitsl/mpi/audited_routines.hpp"
+#include "../../../../../../uitsl/mpi/mpi_utils.hpp"
+#include "../../../../../../uitsl/mpi/Request.hpp"
+#include "../../../../../../uitsl/mpi/request_utils.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/RuntimeSizeBackEnd.hpp"
+
+namespace uit {
+namespace s {
+
+/**
+ * Accumulating send duct for large spans that sends each flushed sum as a
+ * pipeline of fixed-size chunks instead of one rendezvous-sized message.
+ *
+ * At most N chunk sends are in flight, and more are posted as earlier ones
+ * complete whenever the duct is put to or flushed. Chunks are small enough
+ * to travel eagerly, and the outlet accumulates each one as it lands. Pairs
+ * with `uit::s::ChunkedIrecvDuct` using the same ChunkBytes.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ * @tparam ChunkBytes target chunk size, rounded up to whole items.
+ */
+template<typename ImplSpec, size_t ChunkBytes=64 * 1024>
+class ChunkedIsendDuct {
+
+public:
+
+  using BackEndImpl = uit::RuntimeSizeBackEnd<ImplSpec>;
+
+private:
+
+  const uit::InterProcAddress address;
+
+  using T = typename ImplSpec::T;
+  using value_type = typename T::value_type;
+  static_assert( uitsl::s::static_test<T>(), uitsl_s_message );
+  constexpr inline static size_t N{ImplSpec::N};
+
+  // keep the trailing epoch within at most the last two chunks
+  static_assert( ChunkBytes >= sizeof(size_t) );
+
+  using bundle_t = uitsl::MsgAccumulatorBundle<value_type>;
+  bundle_t send_buffer;
+  bundle_t pending_buffer;
+
+  const uitsl::MsgChunkLayout<value_type> layout;
+
+  // next chunk of send_buffer to post
+  size_t send_chunk;
+
+  uitsl::RingBuffer<uitsl::Request, N> requests;
+
+  void PostChunkSend() {
+    emp_assert( send_chunk < layout.GetNumChunks() );
+
+    uitsl_err_audit(!   requests.PushHead()   );
+    emp_assert( uitsl::test_null( requests.GetHead() ) );
+
+    UITSL_Isend(
+      reinterpret_cast<const std::byte*>( send_buffer.data() )
+        + layout.GetByteBegin( send_chunk ), // const void *buf
+      uitsl::safe_cast<int>( layout.GetByteSize( send_chunk ) ), // int count
+      MPI_BYTE, // MPI_Datatype datatype
+      address.GetOutletProc(), // int dest
+      address.GetTag(), // int tag
+      address.GetComm(), // MPI_Comm comm
+      &requests.GetHead() // MPI_Request * request
+    );
+    emp_assert( !uitsl::test_null( requests.GetHead() ) );
+
+    ++send_chunk;
+  }
+
+  // returns true if every chunk of send_buffer has been sent
+  bool AdvancePipeline() {
+    while (
+      requests.GetSize() && uitsl::test_completion( requests.GetTail() )
+    ) uitsl_err_audit(!   requests.PopTail()   );
+
+    while (
+      send_chunk < layout.GetNumChunks() && requests.GetSize() < N
+    ) PostChunkSend();
+
+    return send_chunk == layout.GetNumChunks() && requests.GetSize() == 0;
+  }
+
+  void CancelPendingSend() {
+    emp_assert( !uitsl::test_null( requests.GetTail() ) );
+
+    UITSL_Cancel( &requests.GetTail() );
+    UITSL_Request_free( &requests.GetTail() );
+
+    emp_assert( uitsl::test_null( requests.GetTail() ) );
+
+    uitsl_err_audit(!   requests.PopTail()   );
+  }
+
+public:
+
+  ChunkedIsendDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end,
+    const uit::RuntimeSizeBackEnd<ImplSpec>& rts
+      =uit::RuntimeSizeBackEnd<ImplSpec>{}
+  ) : address(address_)
+  , send_buffer( rts.HasSize() ? rts.GetSize() : back_end->GetSize() )
+  , pending_buffer( rts.HasSize() ? rts.GetSize() : back_end->GetSize() )
+  , layout( send_buffer.byte_size(), ChunkBytes )
+  , send_chunk( layout.GetNumChunks() ) {
+    emp_assert( rts.HasSize() || back_end->HasSize() );
+  }
+
+  ~ChunkedIsendDuct() {
+    AdvancePipeline();
+    while ( requests.GetSize() ) CancelPendingSend();
+  }
+
+  /**
+   * Add val to the pending sum, then advance any send in progress.
+   *
+   * @param val value to put.
+   */
+  bool TryPut(const T& val) {
+    pending_buffer.BumpData(val);
+    pending_buffer.BumpEpoch();
+
+    TryFlush();
+
+    return true;
+  }
+
+  /**
+   * Advance the chunk pipeline, and start sending the pending sum once the
+   * previous one is fully sent.
+   *
+   * @return true if the pending sum was handed off or there was none.
+   */
+  bool TryFlush() {
+
+    if ( !AdvancePipeline() ) return false;
+
+    if ( pending_buffer.GetEpoch() ) {
+      std::swap( send_buffer, pending_buffer );
+      pending_buffer.Reset();
+      send_chunk = 0;
+      AdvancePipeline();
+    }
+
+    return true;
+
+  }
+
+  [[noreturn]] size_t TryConsumeGets(size_t) const {
+    emp_always_assert(false, "ConsumeGets called on ChunkedIsendDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] const T& Get() const {
+    emp_always_assert(false, "Get called on ChunkedIsendDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] T& Get() {
+    emp_always_assert(false, "Get called on ChunkedIsendDuct");
+    __builtin_unreachable();
+  }
+
+  static std::string GetType() { return "ChunkedIsendDuct"; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetType() << std::endl;
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << std::endl;
+    ss << uitsl::format_member("size_t send_chunk", send_chunk) << std::endl;
+    ss << uitsl::format_member(
+      "size_t num_chunks", layout.GetNumChunks()
+    ) << std::endl;
+    ss << uitsl::format_member("InterProcAddress address", address) << std::endl;
+    return ss.str();
+  }
+
+};
+
+} // namespace s
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_INLET_ACCUMULATING_TYPE_SPAN_S__CHUNKEDISENDDUCT_HPP_INCLUDE
@@ -0,0 +1,225 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_SPAN_S__RINGGATHERISENDDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_SPAN_S__RINGGATHERISENDDUCT_HPP_INCLUDE
+
+#include <memory>
+#include <stddef.h>
+#include <string>
+#include <type_traits>
+
+#include <mpi.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/optional.hpp"
+
+#include "../../../../../../uitsl/datastructs/GatherSpan.hpp"
+#include "../../../../../../uitsl/datastructs/RingBuffer.hpp"
+#include "../../../../../../uitsl/debug/err_audit.hpp"
+#include "../../../../../../uitsl/debug/safe_cast.hpp"
+#include "../../../../../../uitsl/meta/s::static_test.hpp"
+#include "../../../../../../uitsl/mpi/audited_routines.hpp"
+#include "../../../../../../uitsl/mpi/HindexedTypeCache.hpp"
+#include "../../../../../../uitsl/mpi/mpi_utils.hpp"
+#include "../../../../../../uitsl/mpi/Request.hpp"
+#include "../../../../../../uitsl/mpi/request_utils.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/RuntimeSizeBackEnd.hpp"
+
+namespace uit {
+namespace s {
+
+/**
+ * Ring send duct that transmits each `uitsl::GatherSpan` put in place, as
+ * a single message, without packing its segments.
+ *
+ * Multi-segment puts are sent with an `MPI_Type_create_hindexed` datatype
+ * describing the segments relative to the first one. Datatypes are cached
+ * per shape, so steady-state puts of the same fields build no datatypes.
+ * The outlet receives the concatenated segments as contiguous bytes, so any
+ * span outlet pairs with this inlet.
+ *
+ * Segment memory must stay unchanged until `TryFlush` returns true.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class RingGatherIsendDuct {
+
+public:
+
+  using BackEndImpl = uit::RuntimeSizeBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::s::static_test<T>(), uitsl_s_message );
+  static_assert( std::is_same<
+    T, uitsl::GatherSpan<typename T::value_type>
+  >::value, "T must be a uitsl::GatherSpan" );
+  constexpr inline static size_t N{ImplSpec::N};
+
+  // sends read segments in place, so only requests need be kept
+  using buffer_t = uitsl::RingBuffer< uitsl::Request, N >;
+  buffer_t buffer{};
+
+  uitsl::HindexedTypeCache datatypes;
+
+  // reused between puts to look up datatypes without allocating
+  uitsl::HindexedTypeCache::shape_t shape;
+
+  const uit::InterProcAddress address;
+
+  emp::optional<size_t> runtime_size;
+
+  // datatype and displacements are relative to the first segment
+  MPI_Datatype GetDatatype(const T& val) {
+    MPI_Aint base;
+    UITSL_Get_address( val.GetSegment(0).first, &base );
+
+    shape.clear();
+    for (size_t i{}; i < val.GetNumSegments(); ++i) {
+      const auto [ptr, num_bytes] = val.GetSegment(i);
+      MPI_Aint segment_address;
+      UITSL_Get_address( ptr, &segment_address );
+      shape.emplace_back(
+        MPI_Aint_diff( segment_address, base ),
+        uitsl::safe_cast<int>( num_bytes )
+      );
+    }
+
+    return datatypes.Lookup( shape );
+  }
+
+  void PostSendRequest(const T& val) {
+    emp_assert( uitsl::test_null( buffer.GetHead() ) );
+    emp_assert( !runtime_size.has_value() || *runtime_size == val.size() );
+
+    // contiguous puts need no derived datatype
+    const bool is_single = val.GetNumSegments() == 1;
+    UITSL_Isend(
+      val.GetSegment(0).first, // const void *buf
+      is_single ? uitsl::safe_cast<int>( val.GetNumBytes() ) : 1, // int count
+      is_single ? MPI_BYTE : GetDatatype( val ), // MPI_Datatype datatype
+      address.GetOutletProc(), // int dest
+      address.GetTag(), // int tag
+      address.GetComm(), // MPI_Comm comm
+      &buffer.GetHead() // MPI_Request * request
+    );
+
+    emp_assert( !uitsl::test_null( buffer.GetHead() ) );
+  }
+
+  bool TryFinalizeSend() {
+    emp_assert( !uitsl::test_null( buffer.GetTail() ) );
+
+    if (uitsl::test_completion( buffer.GetTail() )) {
+      emp_assert( uitsl::test_null( buffer.GetTail() ) );
+      uitsl_err_audit(!   buffer.PopTail()   );
+      return true;
+    } else return false;
+  }
+
+  void CancelPendingSend() {
+    emp_assert( !uitsl::test_null( buffer.GetTail() ) );
+
+    UITSL_Cancel( &buffer.GetTail() );
+    UITSL_Request_free( &buffer.GetTail() );
+
+    emp_assert( uitsl::test_null( buffer.GetTail() ) );
+
+    uitsl_err_audit(!   buffer.PopTail()   );
+  }
+
+  void FlushFinalizedSends() { while (buffer.GetSize() && TryFinalizeSend()); }
+
+  void DoPut(const T& val) {
+    emp_assert( buffer.GetSize() < N );
+
+    uitsl_err_audit(!   buffer.PushHead()   );
+
+    PostSendRequest(val);
+  }
+
+  bool IsReadyForPut() {
+    FlushFinalizedSends();
+    return buffer.GetSize() < N;
+  }
+
+public:
+
+  RingGatherIsendDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end,
+    const uit::RuntimeSizeBackEnd<ImplSpec>& rts
+      =uit::RuntimeSizeBackEnd<ImplSpec>{}
+  ) : address(address_)
+  , runtime_size( [&]() -> emp::optional<size_t> {
+    if ( rts.HasSize() ) return {rts.GetSize()};
+    else if ( back_end->HasSize() ) return {back_end->GetSize()};
+    else return std::nullopt;
+  }() )
+  { ; }
+
+  ~RingGatherIsendDuct() {
+    FlushFinalizedSends();
+    while ( buffer.GetSize() ) CancelPendingSend();
+  }
+
+  /**
+   * Send val's segments in place, or drop val if too many sends are pending.
+   *
+   * @param val value to put.
+   */
+  bool TryPut(const T& val) {
+    if (IsReadyForPut()) { DoPut(val); return true; }
+    else return false;
+  }
+
+  /**
+   * Check whether every put's send has completed, after which put segments
+   * may be modified or freed.
+   */
+  bool TryFlush() {
+    FlushFinalizedSends();
+    return buffer.GetSize() == 0;
+  }
+
+  [[noreturn]] size_t TryConsumeGets(size_t) const {
+    emp_always_assert(false, "ConsumeGets called on RingGatherIsendDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] const T& Get() const {
+    emp_always_assert(false, "Get called on RingGatherIsendDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] T& Get() {
+    emp_always_assert(false, "Get called on RingGatherIsendDuct");
+    __builtin_unreachable();
+  }
+
+  static std::string GetType() { return "RingGatherIsendDuct"; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetType() << std::endl;
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << std::endl;
+    ss << uitsl::format_member(
+      "size_t cached datatypes", datatypes.GetSize()
+    ) << std::endl;
+    ss << uitsl::format_member("InterProcAddress address", address) << std::endl;
+    return ss.str();
+  }
+
+};
+
+} // namespace s
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_SPAN_S__RINGGATHERISENDDUCT_HPP_INCLUDE
@@ -0,0 +1,292 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_IMPL_TRIVIALCREDITRINGIMMEDIATESENDDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_IMPL_TRIVIALCREDITRINGIMMEDIATESENDDUCT_HPP_INCLUDE
+
+#include <memory>
+#include <stddef.h>
+#include <string>
+#include <tuple>
+
+#include <mpi.h>
+
+#include "../../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+#include "../../../../../../../uitsl/datastructs/RingBuffer.hpp"
+#include "../../../../../../../uitsl/debug/err_audit.hpp"
+#include "../../../../../../../uitsl/meta/t::static_test.hpp"
+#include "../../../../../../../uitsl/mpi/audited_routines.hpp"
+#include "../../../../../../../uitsl/mpi/mpi_types.hpp"
+#include "../../../../../../../uitsl/mpi/mpi_utils.hpp"
+#include "../../../../../../../uitsl/mpi/Request.hpp"
+#include "../../../../../../../uitsl/mpi/request_utils.hpp"
+#include "../../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../../setup/InterProcAddress.hpp"
+
+#include "../../../backend/CreditBackEnd.hpp"
+
+namespace uit {
+namespace internal {
+
+/**
+ * Ring send duct that only sends within credit granted by the outlet.
+ *
+ * The outlet grants one credit for each receive it has posted, so every send
+ * finds a matching receive waiting. Puts beyond credit are dropped before
+ * touching the network, and ready-mode sends are safe. Pairs with
+ * `uit::t::CreditRingIrecvDuct`.
+ *
+ * On destruction, the duct's sends are drained rather than cancelled. Then,
+ * within credit, it sends an empty message marking the end of data and
+ * collects credit until the outlet answers with a zero grant. The
+ * `uit::CreditBackEnd` finishes this handshake after the duct is gone.
+ *
+ * Data and credits share a tag, told apart by direction, so inlet and outlet
+ * must be on different procs.
+ *
+ * @tparam ImmediateSendFunctor nonblocking send routine, e.g., Isend or
+ * Irsend.
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImmediateSendFunctor, typename ImplSpec>
+class TrivialCreditRingImmediateSendDuct {
+
+public:
+
+  using BackEndImpl = uit::CreditBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::t::static_test<T>(), uitsl_t_message );
+  constexpr inline static size_t N{ImplSpec::N};
+
+  // communication state, which outlives the duct until teardown completes
+  class Channel {
+
+    using buffer_t = uitsl::RingBuffer<std::tuple<T, uitsl::Request>, N>;
+    buffer_t buffer{};
+
+    // sends the outlet has posted receives for, but that haven't been made
+    size_t credits{};
+
+    size_t credit_recv_buffer;
+    uitsl::Request credit_request;
+
+    // set once the outlet grants zero credit, its last credit message
+    bool credits_closed{};
+
+    // empty message marking the end of data
+    uitsl::Request fin_request;
+    bool fin_sent{};
+
+    const uit::InterProcAddress address;
+
+    void PostCreditRequest() {
+      emp_assert( uitsl::test_null( credit_request ) );
+      UITSL_Irecv(
+        &credit_recv_buffer, // void *buf
+        1, // int count
+        uitsl::datatype_from_type<size_t>(), // MPI_Datatype datatype
+        address.GetOutletProc(), // int source
+        address.GetTag(), // int tag
+        address.GetComm(), // MPI_Comm comm
+        &credit_request // MPI_Request *request
+      );
+    }
+
+    void CollectCredits() {
+      while (
+        !uitsl::test_null( credit_request )
+        && uitsl::test_completion( credit_request )
+      ) {
+        if ( credit_recv_buffer == 0 ) { credits_closed = true; break; }
+        credits += credit_recv_buffer;
+        emp_assert( credits <= N, credits, N );
+        PostCreditRequest();
+      }
+    }
+
+    void PostSendRequest() {
+
+      emp_assert( uitsl::test_null( std::get<uitsl::Request>( buffer.GetHead() ) ) );
+      ImmediateSendFunctor{}(
+        &std::get<T>( buffer.GetHead() ),
+        sizeof(T),
+        MPI_BYTE,
+        address.GetOutletProc(),
+        address.GetTag(),
+        address.GetComm(),
+        &std::get<uitsl::Request>( buffer.GetHead() )
+      );
+      emp_assert(!uitsl::test_null(std::get<uitsl::Request>( buffer.GetHead() )));
+
+    }
+
+    void PostFinRequest() {
+      emp_assert( credits );
+      ImmediateSendFunctor{}(
+        nullptr,
+        0,
+        MPI_BYTE,
+        address.GetOutletProc(),
+        address.GetTag(),
+        address.GetComm(),
+        &fin_request
+      );
+      --credits;
+      fin_sent = true;
+    }
+
+    bool TryFinalizeSend() {
+      emp_assert( !uitsl::test_null( std::get<uitsl::Request>( buffer.GetTail() ) ) );
+
+      if (uitsl::test_completion( std::get<uitsl::Request>( buffer.GetTail() ) )) {
+        emp_assert( uitsl::test_null( std::get<uitsl::Request>(buffer.GetTail()) ) );
+        uitsl_err_audit(!   buffer.PopTail()   );
+        return true;
+      } else return false;
+    }
+
+    void FlushFinalizedSends() { while (buffer.GetSize() && TryFinalizeSend()); }
+
+    void DoPut(const T& val) {
+      emp_assert( buffer.GetSize() < N );
+      emp_assert( credits );
+
+      uitsl_err_audit(!   buffer.PushHead()   );
+
+      std::get<T>( buffer.GetHead() ) = val;
+
+      PostSendRequest();
+      --credits;
+    }
+
+    bool IsReadyForPut() {
+      CollectCredits();
+      if ( credits == 0 ) return false;
+      FlushFinalizedSends();
+      return buffer.GetSize() < N;
+    }
+
+  public:
+
+    explicit Channel(const uit::InterProcAddress& address_)
+    : address(address_) {
+      if (uitsl::get_rank(address.GetComm()) == address.GetInletProc()) {
+        PostCreditRequest();
+      }
+    }
+
+    bool TryPut(const T& val) {
+      if (IsReadyForPut()) { DoPut(val); return true; }
+      else return false;
+    }
+
+    /**
+     * Advance the teardown handshake without blocking.
+     *
+     * Sends in flight match receives the outlet already posted, so they are
+     * waited on. The end-of-data message follows them on the same channel,
+     * then credits are collected until the outlet's final zero grant so none
+     * is left unreceived.
+     *
+     * @return true once the handshake has completed.
+     */
+    bool TryTeardown() {
+      FlushFinalizedSends();
+      CollectCredits();
+      if ( buffer.GetSize() ) return false;
+
+      if ( !fin_sent ) {
+        if ( credits == 0 ) return false;
+        PostFinRequest();
+      }
+
+      return uitsl::test_completion( fin_request ) && credits_closed;
+    }
+
+    size_t GetCredits() const { return credits; }
+
+    const uit::InterProcAddress& GetAddress() const { return address; }
+
+  };
+
+  std::shared_ptr<Channel> channel;
+
+  std::shared_ptr<BackEndImpl> back_end;
+
+public:
+
+  TrivialCreditRingImmediateSendDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end_
+  ) : channel( std::make_shared<Channel>( address_ ) )
+  , back_end( back_end_ ) {
+    emp_always_assert(
+      address_.GetInletProc() != address_.GetOutletProc(),
+      "credit ring ducts tell data from credits by direction",
+      address_.ToString()
+    );
+  }
+
+  ~TrivialCreditRingImmediateSendDuct() {
+    const auto& address = channel->GetAddress();
+    if (uitsl::get_rank(address.GetComm()) != address.GetInletProc()) return;
+    back_end->Retire(
+      [channel = std::move(channel)](){ return channel->TryTeardown(); }
+    );
+  }
+
+  /**
+   * Send val if the outlet has granted credit for it, otherwise drop it.
+   *
+   * @param val value to put.
+   */
+  bool TryPut(const T& val) { return channel->TryPut(val); }
+
+  /**
+   * Sends need no flushing.
+   */
+  bool TryFlush() const { return true; }
+
+  [[noreturn]] size_t TryConsumeGets(size_t) const {
+    emp_always_assert(
+      false, "ConsumeGets called on TrivialCreditRingImmediateSendDuct"
+    );
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] const T& Get() const {
+    emp_always_assert(
+      false, "Get called on TrivialCreditRingImmediateSendDuct"
+    );
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] T& Get() {
+    emp_always_assert(
+      false, "Get called on TrivialCreditRingImmediateSendDuct"
+    );
+    __builtin_unreachable();
+  }
+
+  static std::string GetType() { return "TrivialCreditRingImmediateSendDuct"; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetType() << std::endl;
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << std::endl;
+    ss << uitsl::format_member("size_t credits", channel->GetCredits()) << std::endl;
+    ss << uitsl::format_member("InterProcAddress address", channel->GetAddress()) << std::endl;
+    return ss.str();
+  }
+
+};
+
+} // namespace internal
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_IMPL_TRIVIALCREDITRINGIMMEDIATESENDDUCT_HPP_INCLUDE
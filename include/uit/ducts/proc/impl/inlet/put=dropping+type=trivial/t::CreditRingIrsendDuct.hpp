@@ -0,0 +1,40 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__CREDITRINGIRSENDDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__CREDITRINGIRSENDDUCT_HPP_INCLUDE
+
+#include "../../../../../../uitsl/mpi/routine_functors.hpp"
+
+#include "impl/TrivialCreditRingImmediateSendDuct.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Credit-limited ring duct sending with `MPI_Irsend`.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class CreditRingIrsendDuct
+: public uit::internal::TrivialCreditRingImmediateSendDuct<
+  uitsl::IrsendFunctor,
+  ImplSpec
+> {
+
+  // inherit parent's constructors
+  // adapted from https://stackoverflow.com/a/434784
+  using parent_t = uit::internal::TrivialCreditRingImmediateSendDuct<
+    uitsl::IrsendFunctor,
+    ImplSpec
+  >;
+  using parent_t::parent_t;
+
+  static std::string GetName() { return "CreditRingIrsendDuct"; }
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__CREDITRINGIRSENDDUCT_HPP_INCLUDE
@@ -0,0 +1,162 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__EXPOSEDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__EXPOSEDUCT_HPP_INCLUDE
+
+#include <memory>
+#include <stddef.h>
+
+#include <mpi.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../../../../../uitsl/debug/safe_cast.hpp"
+#include "../../../../../../uitsl/distributed/LockAllWindowManager.hpp"
+#include "../../../../../../uitsl/distributed/RdmaVersionedPacket.hpp"
+#include "../../../../../../uitsl/meta/t::static_test.hpp"
+#include "../../../../../../uitsl/mpi/audited_routines.hpp"
+#include "../../../../../../uitsl/mpi/mpi_utils.hpp"
+#include "../../../../../../uitsl/mpi/Request.hpp"
+#include "../../../../../../uitsl/mpi/request_utils.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/LockAllRdmaBackEnd.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Writes each put into a slot in the inlet proc's own portion of a shared
+ * RDMA window, for the outlet to fetch when it wants a value.
+ *
+ * Puts never leave the inlet proc, so transfer volume follows how often the
+ * outlet reads rather than how often the inlet writes.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class ExposeDuct {
+
+public:
+
+  using BackEndImpl = uit::LockAllRdmaBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::t::static_test<T>(), uitsl_t_message );
+
+  using packet_t = uitsl::RdmaVersionedPacket<T>;
+  inline static const packet_t pristine{};
+
+  size_t epoch{};
+
+  const uit::InterProcAddress address;
+
+  std::shared_ptr<BackEndImpl> back_end;
+
+  const int byte_offset;
+
+  uitsl::Request byte_offset_request;
+
+  uitsl::LockAllWindowManager& GetWindowManager() {
+    return back_end->GetWindowManager();
+  }
+
+public:
+
+  ExposeDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end_
+  ) : address(address_)
+  , back_end(back_end_)
+  , byte_offset(
+    address.GetInletProc() == uitsl::get_rank(address.GetComm())
+      ? uitsl::safe_cast<int>( back_end->GetWindowManager().Acquire(
+        emp::vector<std::byte>(
+          reinterpret_cast<const std::byte*>(&pristine),
+          reinterpret_cast<const std::byte*>(&pristine) + sizeof(packet_t)
+        ),
+        alignof(packet_t)
+      ) ) : -1
+  ) {
+    if (address.GetInletProc() == uitsl::get_rank(address.GetComm())) {
+      UITSL_Isend(
+        &byte_offset, // const void *buf
+        1, // int count
+        MPI_INT, // MPI_Datatype datatype
+        address.GetOutletProc(), // int dest
+        address.GetTag(), // int tag
+        address.GetComm(), // MPI_Comm comm
+        &byte_offset_request // MPI_Request * request
+      );
+    }
+  }
+
+  ~ExposeDuct() {
+    if ( !uitsl::test_null( byte_offset_request ) ) UITSL_Wait(
+      &byte_offset_request, MPI_STATUS_IGNORE
+    );
+  }
+
+  /**
+   * Overwrite the exposed slot with val.
+   *
+   * Never drops and never communicates.
+   *
+   * @param val value to put.
+   */
+  bool TryPut(const T& val) {
+    packet_t::Write(
+      reinterpret_cast<packet_t*>( GetWindowManager().GetBytes(byte_offset) ),
+      val,
+      ++epoch
+    );
+    // under the separate memory model, local writes only reach peers' gets
+    // once copied to the public window
+    if ( !GetWindowManager().IsUnified() ) GetWindowManager().Sync();
+    return true;
+  }
+
+  /**
+   * Puts are complete as soon as they are written.
+   */
+  bool TryFlush() const { return true; }
+
+  [[noreturn]] size_t TryConsumeGets(size_t) const {
+    emp_always_assert(false, "ConsumeGets called on ExposeDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] const T& Get() const {
+    emp_always_assert(false, "Get called on ExposeDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] T& Get() {
+    emp_always_assert(false, "Get called on ExposeDuct");
+    __builtin_unreachable();
+  }
+
+  static std::string GetType() { return "ExposeDuct"; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetType() << std::endl;
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << std::endl;
+    ss << uitsl::format_member("int byte_offset", byte_offset) << std::endl;
+    ss << uitsl::format_member("size_t epoch", epoch) << std::endl;
+    ss << uitsl::format_member("InterProcAddress address", address);
+    return ss.str();
+  }
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__EXPOSEDUCT_HPP_INCLUDE
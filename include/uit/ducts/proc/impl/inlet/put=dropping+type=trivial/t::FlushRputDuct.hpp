@@ -0,0 +1,188 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__FLUSHRPUTDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__FLUSHRPUTDUCT_HPP_INCLUDE
+
+#include <memory>
+#include <stddef.h>
+
+#include <mpi.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+#include "../../../../../../uitsl/distributed/LockAllWindowManager.hpp"
+#include "../../../../../../uitsl/distributed/RdmaVersionedPacket.hpp"
+#include "../../../../../../uitsl/meta/t::static_test.hpp"
+#include "../../../../../../uitsl/mpi/audited_routines.hpp"
+#include "../../../../../../uitsl/mpi/mpi_utils.hpp"
+#include "../../../../../../uitsl/mpi/Request.hpp"
+#include "../../../../../../uitsl/mpi/request_utils.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/LockAllRdmaBackEnd.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Writes each put straight into the outlet proc's slot of a shared RDMA
+ * window, without per-put locking.
+ *
+ * Puts are issued within the back end's long-lived `lock_all` epoch, so
+ * no per-put lock and unlock is needed. Puts are not batched, though: every
+ * put targets the same slot, and concurrent puts to the same target
+ * location are undefined. So, each put first waits for the previous one to
+ * complete at the target with one `MPI_Win_flush`. That round trip overlaps
+ * with whatever the caller does between puts.
+ *
+ * Never drops, but blocks on the previous put's flush. It sits with the
+ * put=dropping inlets because its outlet skips to the latest value, so
+ * values overwritten before they are read are lost all the same.
+ *
+ * Slots are `uitsl::RdmaVersionedPacket`s, so the outlet can discard reads
+ * that overlap a landing put. That requires the platform to write a put's
+ * bytes to target memory in ascending address order (see
+ * `uit::t::SyncWindowDuct`).
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class FlushRputDuct {
+
+public:
+
+  using BackEndImpl = uit::LockAllRdmaBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::t::static_test<T>(), uitsl_t_message );
+  using packet_t = uitsl::RdmaVersionedPacket<T>;
+
+  // send buffer must stay untouched until its put completes
+  packet_t buffer{};
+
+  // has a put been issued since the last flush?
+  bool pending_put{};
+
+  size_t epoch{};
+
+  const uit::InterProcAddress address;
+
+  std::shared_ptr<BackEndImpl> back_end;
+
+  uitsl::Request target_offset_request;
+  int target_offset;
+
+  uitsl::LockAllWindowManager& GetWindowManager() {
+    return back_end->GetWindowManager();
+  }
+
+  void Flush() {
+    GetWindowManager().Flush( address.GetOutletProc() );
+    pending_put = false;
+  }
+
+public:
+
+  FlushRputDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end_
+  ) : address(address_)
+  , back_end(back_end_)
+  {
+    if (uitsl::get_rank(address.GetComm()) == address.GetInletProc()) {
+      GetWindowManager().Activate();
+      UITSL_Irecv(
+        &target_offset, // void *buf
+        1, // int count
+        MPI_INT, // MPI_Datatype datatype
+        address.GetOutletProc(), // int source
+        address.GetTag(), // int tag
+        address.GetComm(), // MPI_Comm comm
+        &target_offset_request // MPI_Request *request
+      );
+    }
+  }
+
+  ~FlushRputDuct() {
+    if ( pending_put ) Flush();
+    if ( !uitsl::test_null( target_offset_request ) ) UITSL_Wait(
+      &target_offset_request, MPI_STATUS_IGNORE
+    );
+  }
+
+  /**
+   * Write val into the outlet's slot.
+   *
+   * Never drops, but blocks until the previous put completes at the target.
+   *
+   * @param val value to put.
+   */
+  bool TryPut(const T& val) {
+
+    // outlet sends its slot offset during setup
+    if ( !uitsl::test_null( target_offset_request ) ) UITSL_Wait(
+      &target_offset_request, MPI_STATUS_IGNORE
+    );
+
+    // previous put to the slot must land before the next is issued
+    if ( pending_put ) Flush();
+
+    packet_t::Write( &buffer, val, ++epoch );
+    GetWindowManager().Put(
+      address.GetOutletProc(),
+      reinterpret_cast<const std::byte*>( &buffer ),
+      sizeof(packet_t),
+      target_offset
+    );
+    pending_put = true;
+
+    return true;
+
+  }
+
+  /**
+   * Complete the outstanding put, if any, at the target.
+   */
+  bool TryFlush() {
+    if ( pending_put ) Flush();
+    return true;
+  }
+
+  [[noreturn]] size_t TryConsumeGets(size_t) const {
+    emp_always_assert(false, "ConsumeGets called on FlushRputDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] const T& Get() const {
+    emp_always_assert(false, "Get called on FlushRputDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] T& Get() {
+    emp_always_assert(false, "Get called on FlushRputDuct");
+    __builtin_unreachable();
+  }
+
+  static std::string GetType() { return "FlushRputDuct"; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetType() << std::endl;
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << std::endl;
+    ss << uitsl::format_member("bool pending_put", pending_put) << std::endl;
+    ss << uitsl::format_member("size_t epoch", epoch) << std::endl;
+    ss << uitsl::format_member("InterProcAddress address", address);
+    return ss.str();
+  }
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__FLUSHRPUTDUCT_HPP_INCLUDE
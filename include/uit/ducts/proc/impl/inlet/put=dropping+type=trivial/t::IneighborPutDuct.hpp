@@ -0,0 +1,111 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__INEIGHBORPUTDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__INEIGHBORPUTDUCT_HPP_INCLUDE
+
+#include <memory>
+#include <stddef.h>
+#include <string>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/optional.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "../../../../../../uitsl/meta/t::static_test.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/NeighborhoodBackEnd.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Stages the latest put value for the next neighborhood exchange.
+ *
+ * Puts never block and overwrite any value not yet exchanged. `TryFlush`
+ * marks this duct as done for the current step; see `NeighborhoodBackEnd`.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class IneighborPutDuct {
+
+public:
+
+  using BackEndImpl = uit::NeighborhoodBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::t::static_test<T>(), uitsl_t_message );
+
+  const uit::InterProcAddress address;
+
+  std::shared_ptr<BackEndImpl> back_end;
+
+  emp::optional<size_t> slot;
+
+  size_t GetSlot() {
+    if ( !slot.has_value() ) slot = back_end->LookupInletSlot( address );
+    return *slot;
+  }
+
+public:
+
+  IneighborPutDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end_
+  ) : address(address_)
+  , back_end(back_end_)
+  { back_end->RegisterInletSlot( address ); }
+
+  /**
+   * Stage val for the next neighborhood exchange, overwriting any value
+   * staged since the last exchange.
+   *
+   * @param val value to send.
+   * @return true, as staging never blocks.
+   */
+  bool TryPut(const T& val) { return back_end->TryPut( val, GetSlot() ); }
+
+  /**
+   * Mark this inlet done putting for the current step. The exchange is
+   * posted once every inlet sharing the back end has flushed.
+   *
+   * @return true, as marking never blocks.
+   */
+  bool TryFlush() { return back_end->TryFlush(); }
+
+  [[noreturn]] size_t TryConsumeGets(size_t) const {
+    emp_always_assert(false, "ConsumeGets called on IneighborPutDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] const T& Get() const {
+    emp_always_assert(false, "Get called on IneighborPutDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] T& Get() {
+    emp_always_assert(false, "Get called on IneighborPutDuct");
+    __builtin_unreachable();
+  }
+
+  static std::string GetName() { return "IneighborPutDuct"; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetName() << std::endl;
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << std::endl;
+    ss << uitsl::format_member("InterProcAddress address", address);
+    return ss.str();
+  }
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__INEIGHBORPUTDUCT_HPP_INCLUDE
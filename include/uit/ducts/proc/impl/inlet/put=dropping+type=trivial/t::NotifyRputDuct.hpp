@@ -0,0 +1,198 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__NOTIFYRPUTDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__NOTIFYRPUTDUCT_HPP_INCLUDE
+
+#include <memory>
+#include <stddef.h>
+
+#include <mpi.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/array.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+#include "../../../../../../uitsl/distributed/LockAllWindowManager.hpp"
+#include "../../../../../../uitsl/distributed/RdmaNotifiedPacket.hpp"
+#include "../../../../../../uitsl/meta/t::static_test.hpp"
+#include "../../../../../../uitsl/mpi/audited_routines.hpp"
+#include "../../../../../../uitsl/mpi/mpi_utils.hpp"
+#include "../../../../../../uitsl/mpi/Request.hpp"
+#include "../../../../../../uitsl/mpi/request_utils.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/LockAllRdmaBackEnd.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Puts each value into one of two alternating payload slots in the outlet's
+ * window, then publishes its epoch to a separate counter.
+ *
+ * The payload is flushed to the target before the counter is updated, and
+ * the counter is flushed before the other slot is reused. So an outlet that
+ * sees epoch e on the counter both before and after reading slot e % 2 has
+ * read a whole value. Two round trips per put buy a poll that only touches
+ * one cache line.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class NotifyRputDuct {
+
+public:
+
+  using BackEndImpl = uit::LockAllRdmaBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::t::static_test<T>(), uitsl_t_message );
+  using packet_t = uitsl::RdmaNotifiedPacket<emp::array<T, 2>>;
+
+  // origin buffers, reusable once flushed
+  T payload{};
+  size_t notification{};
+
+  bool pending_notification{};
+
+  size_t epoch{};
+
+  const uit::InterProcAddress address;
+
+  std::shared_ptr<BackEndImpl> back_end;
+
+  uitsl::Request target_offset_request;
+  int target_offset;
+
+  uitsl::LockAllWindowManager& GetWindowManager() {
+    return back_end->GetWindowManager();
+  }
+
+  MPI_Aint CalcPayloadDisp() const {
+    return target_offset + packet_t::GetPayloadOffset()
+      + (epoch % 2) * sizeof(T);
+  }
+
+  MPI_Aint CalcCounterDisp() const {
+    return target_offset + packet_t::GetCounterOffset();
+  }
+
+  void FlushNotification() {
+    GetWindowManager().Flush( address.GetOutletProc() );
+    pending_notification = false;
+  }
+
+public:
+
+  NotifyRputDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end_
+  ) : address(address_)
+  , back_end(back_end_)
+  {
+    if (uitsl::get_rank(address.GetComm()) == address.GetInletProc()) {
+      GetWindowManager().Activate();
+      UITSL_Irecv(
+        &target_offset, // void *buf
+        1, // int count
+        MPI_INT, // MPI_Datatype datatype
+        address.GetOutletProc(), // int source
+        address.GetTag(), // int tag
+        address.GetComm(), // MPI_Comm comm
+        &target_offset_request // MPI_Request *request
+      );
+    }
+  }
+
+  ~NotifyRputDuct() {
+    if ( pending_notification ) FlushNotification();
+    if ( !uitsl::test_null( target_offset_request ) ) UITSL_Wait(
+      &target_offset_request, MPI_STATUS_IGNORE
+    );
+  }
+
+  /**
+   * Write val into the outlet's window and notify the outlet.
+   *
+   * Never drops, but blocks on remote completion of the payload.
+   *
+   * @param val value to put.
+   */
+  bool TryPut(const T& val) {
+
+    // outlet sends its slot offset during setup
+    if ( !uitsl::test_null( target_offset_request ) ) UITSL_Wait(
+      &target_offset_request, MPI_STATUS_IGNORE
+    );
+
+    // last notification must land before its slot's twin is overwritten
+    if ( pending_notification ) FlushNotification();
+
+    ++epoch;
+    payload = val;
+    GetWindowManager().Put(
+      address.GetOutletProc(),
+      reinterpret_cast<const std::byte*>( &payload ),
+      sizeof(T),
+      CalcPayloadDisp()
+    );
+    GetWindowManager().Flush( address.GetOutletProc() );
+
+    notification = epoch;
+    GetWindowManager().template Accumulate<size_t>(
+      address.GetOutletProc(),
+      &notification,
+      1,
+      CalcCounterDisp(),
+      MPI_REPLACE
+    );
+    pending_notification = true;
+
+    return true;
+
+  }
+
+  /**
+   * Make the latest notification visible to the outlet.
+   */
+  bool TryFlush() {
+    if ( pending_notification ) FlushNotification();
+    return true;
+  }
+
+  [[noreturn]] size_t TryConsumeGets(size_t) const {
+    emp_always_assert(false, "ConsumeGets called on NotifyRputDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] const T& Get() const {
+    emp_always_assert(false, "Get called on NotifyRputDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] T& Get() {
+    emp_always_assert(false, "Get called on NotifyRputDuct");
+    __builtin_unreachable();
+  }
+
+  static std::string GetType() { return "NotifyRputDuct"; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetType() << std::endl;
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << std::endl;
+    ss << uitsl::format_member("size_t epoch", epoch) << std::endl;
+    ss << uitsl::format_member("InterProcAddress address", address);
+    return ss.str();
+  }
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__NOTIFYRPUTDUCT_HPP_INCLUDE
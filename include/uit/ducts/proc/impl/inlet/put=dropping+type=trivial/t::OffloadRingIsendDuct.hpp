@@ -0,0 +1,164 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__OFFLOADRINGISENDDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__OFFLOADRINGISENDDUCT_HPP_INCLUDE
+
+#include <memory>
+#include <stddef.h>
+#include <string>
+
+#include <mpi.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+#include "../../../../../../uitsl/datastructs/RingBuffer.hpp"
+#include "../../../../../../uitsl/datastructs/SpscRingBuffer.hpp"
+#include "../../../../../../uitsl/debug/err_audit.hpp"
+#include "../../../../../../uitsl/meta/t::static_test.hpp"
+#include "../../../../../../uitsl/mpi/audited_routines.hpp"
+#include "../../../../../../uitsl/mpi/ProgressEngine.hpp"
+#include "../../../../../../uitsl/mpi/ProgressThread.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/ProgressEngineBackEnd.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Ring send duct whose sends are posted and completed by the process's
+ * `uitsl::ProgressThread`.
+ *
+ * Puts copy into a lock-free queue and never call into MPI. The progress
+ * thread sends straight out of the queue and pops items once their sends
+ * complete, so puts are dropped while N sends are pending. Pairs with
+ * `uit::t::OffloadRingIrecvDuct`.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class OffloadRingIsendDuct {
+
+public:
+
+  using BackEndImpl = uit::ProgressEngineBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::t::static_test<T>(), uitsl_t_message );
+  constexpr inline static size_t N{ImplSpec::N};
+
+  // written by puts, sent from and popped by the progress thread
+  uitsl::SpscRingBuffer<T, N> queue;
+
+  // progress thread only, whether each posted send has completed
+  uitsl::RingBuffer<bool, N> done;
+
+  const uit::InterProcAddress address;
+
+  // keep progress thread alive for as long as it holds our requests
+  std::shared_ptr<BackEndImpl> back_end;
+  uitsl::ProgressThread& progress_thread;
+
+  void PostSendRequest(uitsl::ProgressEngine& engine) {
+    uitsl_err_audit(!   done.PushHead( false )   );
+
+    MPI_Request request;
+    UITSL_Isend(
+      &queue.Get( done.GetSize() - 1 ), // const void *buf
+      sizeof(T), // int count
+      MPI_BYTE, // MPI_Datatype datatype
+      address.GetOutletProc(), // int dest
+      address.GetTag(), // int tag
+      address.GetComm(), // MPI_Comm comm
+      &request // MPI_Request * request
+    );
+
+    // slots are not reused until popped, so the flag outlives the request
+    engine.Track( request, this, [&flag = done.GetHead()](){ flag = true; } );
+  }
+
+  /**
+   * Pop completed sends and post newly put items. Called from the progress
+   * thread.
+   */
+  bool Progress(uitsl::ProgressEngine& engine) {
+    bool busy{};
+    while ( done.GetSize() && done.GetTail() ) {
+      uitsl_err_audit(!   done.PopTail()   );
+      queue.Pop();
+      busy = true;
+    }
+    while ( done.GetSize() < queue.GetSize() ) {
+      PostSendRequest( engine );
+      busy = true;
+    }
+    return busy;
+  }
+
+public:
+
+  OffloadRingIsendDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end_
+  ) : address(address_)
+  , back_end(back_end_)
+  , progress_thread( back_end->GetProgressThread() ) {
+    progress_thread.Register(
+      this, [this](uitsl::ProgressEngine& engine){ return Progress(engine); }
+    );
+  }
+
+  ~OffloadRingIsendDuct() { progress_thread.Unregister( this ); }
+
+  /**
+   * Hand val off to the progress thread to send, or drop val if N sends are
+   * pending.
+   *
+   * @param val value to put.
+   */
+  bool TryPut(const T& val) { return queue.TryPush( val ); }
+
+  /**
+   * Sends are progressed in the background, so there is nothing to do.
+   */
+  bool TryFlush() const { return true; }
+
+  [[noreturn]] size_t TryConsumeGets(size_t) const {
+    emp_always_assert(false, "ConsumeGets called on OffloadRingIsendDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] const T& Get() const {
+    emp_always_assert(false, "Get called on OffloadRingIsendDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] T& Get() {
+    emp_always_assert(false, "Get called on OffloadRingIsendDuct");
+    __builtin_unreachable();
+  }
+
+  static std::string GetType() { return "OffloadRingIsendDuct"; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetType() << std::endl;
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << std::endl;
+    ss << uitsl::format_member(
+      "size_t pending sends", queue.GetSize()
+    ) << std::endl;
+    ss << uitsl::format_member("InterProcAddress address", address) << std::endl;
+    return ss.str();
+  }
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__OFFLOADRINGISENDDUCT_HPP_INCLUDE
@@ -0,0 +1,179 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__PROGRESSRINGISENDDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__PROGRESSRINGISENDDUCT_HPP_INCLUDE
+
+#include <memory>
+#include <stddef.h>
+#include <string>
+#include <tuple>
+
+#include <mpi.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+#include "../../../../../../uitsl/datastructs/RingBuffer.hpp"
+#include "../../../../../../uitsl/debug/err_audit.hpp"
+#include "../../../../../../uitsl/meta/t::static_test.hpp"
+#include "../../../../../../uitsl/mpi/audited_routines.hpp"
+#include "../../../../../../uitsl/mpi/ProgressEngine.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/ProgressEngineBackEnd.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Ring send duct whose send requests are owned by its thread's
+ * `uitsl::ProgressEngine` instead of being tested one by one.
+ *
+ * Completion callbacks mark ring slots done, and done slots are reclaimed
+ * from the tail. The engine is only polled when the ring fills or on
+ * flush. Pairs with `uit::t::ProgressRingIrecvDuct`.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class ProgressRingIsendDuct {
+
+public:
+
+  using BackEndImpl = uit::ProgressEngineBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::t::static_test<T>(), uitsl_t_message );
+  constexpr inline static size_t N{ImplSpec::N};
+
+  // value being sent and whether its send has completed
+  using buffer_t = uitsl::RingBuffer<std::tuple<T, bool>, N>;
+  buffer_t buffer{};
+
+  const uit::InterProcAddress address;
+
+  // keep engine alive for as long as it holds our requests
+  std::shared_ptr<BackEndImpl> back_end;
+  uitsl::ProgressEngine& engine;
+
+  // engine poll count as of our last visit
+  size_t last_poll{};
+
+  void PostSendRequest() {
+    auto& [val, done] = buffer.GetHead();
+    done = false;
+
+    MPI_Request request;
+    UITSL_Isend(
+      &val, // const void *buf
+      sizeof(T), // int count
+      MPI_BYTE, // MPI_Datatype datatype
+      address.GetOutletProc(), // int dest
+      address.GetTag(), // int tag
+      address.GetComm(), // MPI_Comm comm
+      &request // MPI_Request * request
+    );
+
+    // slots are not reused until done, so the flag outlives the request
+    engine.Track( request, this, [&done](){ done = true; } );
+  }
+
+  void FlushFinalizedSends() {
+    while ( buffer.GetSize() && std::get<bool>( buffer.GetTail() ) ) {
+      uitsl_err_audit(!   buffer.PopTail()   );
+    }
+  }
+
+  void DoPut(const T& val) {
+    emp_assert( buffer.GetSize() < N );
+
+    uitsl_err_audit(!   buffer.PushHead()   );
+
+    std::get<T>( buffer.GetHead() ) = val;
+
+    PostSendRequest();
+  }
+
+  bool IsReadyForPut() {
+    FlushFinalizedSends();
+    if ( buffer.GetSize() == N ) {
+      engine.PollIfStale( last_poll );
+      FlushFinalizedSends();
+    }
+    return buffer.GetSize() < N;
+  }
+
+public:
+
+  ProgressRingIsendDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end_
+  ) : address(address_)
+  , back_end(back_end_)
+  , engine( back_end->GetEngine( address.GetInletThread() ) )
+  { ; }
+
+  ~ProgressRingIsendDuct() {
+    engine.Poll();
+    FlushFinalizedSends();
+    engine.Cancel( this );
+  }
+
+  /**
+   * Copy val into the ring and send it, or drop val if the ring is full of
+   * pending sends.
+   *
+   * @param val value to put.
+   */
+  bool TryPut(const T& val) {
+    if (IsReadyForPut()) { DoPut(val); return true; }
+    else return false;
+  }
+
+  /**
+   * Give the engine a chance to progress pending sends.
+   */
+  bool TryFlush() {
+    engine.PollIfStale( last_poll );
+    FlushFinalizedSends();
+    return true;
+  }
+
+  [[noreturn]] size_t TryConsumeGets(size_t) const {
+    emp_always_assert(false, "ConsumeGets called on ProgressRingIsendDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] const T& Get() const {
+    emp_always_assert(false, "Get called on ProgressRingIsendDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] T& Get() {
+    emp_always_assert(false, "Get called on ProgressRingIsendDuct");
+    __builtin_unreachable();
+  }
+
+  static std::string GetType() { return "ProgressRingIsendDuct"; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetType() << std::endl;
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << std::endl;
+    ss << uitsl::format_member(
+      "size_t pending sends", buffer.GetSize()
+    ) << std::endl;
+    ss << uitsl::format_member("InterProcAddress address", address) << std::endl;
+    return ss.str();
+  }
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__PROGRESSRINGISENDDUCT_HPP_INCLUDE
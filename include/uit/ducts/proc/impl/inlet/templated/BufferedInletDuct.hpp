@@ -16,9 +16,11 @@
 #include "../../../../../../uitsl/mpi/mpi_utils.hpp"
 #include "../../../../../../uitsl/utility/print_utils.hpp"
 
+#include "../../../../../setup/FlushPolicy.hpp"
 #include "../../../../../setup/InterProcAddress.hpp"
 
 #include "impl/BufferSpec.hpp"
+#include "impl/FlushTrigger.hpp"
 
 namespace uit {
 
@@ -51,6 +53,15 @@ private:
   using buffer_t = typename BufferSpec::T;
   buffer_t buffer;
 
+  using flush_policy_t = uit::get_flush_policy_t<ImplSpec>;
+  uit::internal::FlushTrigger<flush_policy_t, T> flush_trigger;
+
+  void RecordPut() {
+    if ( flush_trigger.RecordPut( [this](){ return TryFlush(); } ) ) {
+      TryFlush();
+    }
+  }
+
 public:
 
   BufferedInletDuct(
@@ -67,6 +78,7 @@ public:
   bool TryPut(const T& val) {
     if (buffer.size() < B) {
       buffer.push_back(val);
+      RecordPut();
       return true;
     } else return false;
   }
@@ -80,6 +92,7 @@ public:
   bool TryPut(P&& val) {
     if (buffer.size() < B) {
       buffer.push_back( std::forward<P>(val) );
+      RecordPut();
       return true;
     } else return false;
   }
@@ -90,8 +103,10 @@ public:
    */
   bool TryFlush() {
     if ( buffer.size() ) {
+      // buffer is dropped if the backing inlet is full, so reset either way
       const bool res = inlet.TryPut( std::move(buffer) );
       buffer.clear();
+      flush_trigger.Reset();
       return res;
     }
     else return true;
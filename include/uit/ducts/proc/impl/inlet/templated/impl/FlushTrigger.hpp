@@ -0,0 +1,105 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_INLET_TEMPLATED_IMPL_FLUSHTRIGGER_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_INLET_TEMPLATED_IMPL_FLUSHTRIGGER_HPP_INCLUDE
+
+#include <stddef.h>
+#include <utility>
+
+#include "../../../../../../../uitsl/chrono/CoarseMonoClock.hpp"
+
+#include "../../../../../../setup/StepEndHooks.hpp"
+
+namespace uit {
+namespace internal {
+
+/**
+ * Tracks items staged since the last flush and decides, per a
+ * `uit::FlushPolicy`, when they should be flushed.
+ *
+ * Every check is compiled out for thresholds the policy leaves disabled, so
+ * under `uit::ManualFlushPolicy` `RecordPut` reduces to returning false.
+ *
+ * @tparam FlushPolicy flush policy to apply.
+ * @tparam value_type type of staged items, used for byte accounting.
+ */
+template<typename FlushPolicy, typename value_type>
+class FlushTrigger {
+
+  using clock_t = uitsl::CoarseMonoClock;
+
+  // number of puts since last flush
+  size_t num_staged{};
+
+  // when the first item since last flush was put
+  typename clock_t::time_point oldest_put;
+
+  uit::StepEndHook step_end_hook;
+
+public:
+
+  /**
+   * Account for a put.
+   *
+   * @param flush callable that flushes the owning inlet, registered with the
+   * calling thread's end-of-step hooks on first put if the policy asks.
+   * @return whether staged items should be flushed now.
+   */
+  template<typename Flush>
+  bool RecordPut(Flush&& flush) {
+    if constexpr ( FlushPolicy::IsManual ) return false;
+
+    if constexpr ( FlushPolicy::FlushAtStepEnd ) {
+      if ( !step_end_hook.IsArmed() ) {
+        step_end_hook.Arm( std::forward<Flush>(flush) );
+      }
+    }
+
+    ++num_staged;
+
+    if constexpr ( FlushPolicy::IsTimed ) {
+      if ( num_staged == 1 ) oldest_put = clock_t::now();
+      else if (
+        clock_t::now() - oldest_put >= FlushPolicy::GetMaxLatency()
+      ) return true;
+    }
+
+    return (
+      num_staged >= FlushPolicy::ItemThreshold
+      || num_staged * sizeof(value_type) >= FlushPolicy::ByteThreshold
+    );
+  }
+
+  /**
+   * Has any enabled threshold been met?
+   *
+   * Puts check this themselves, but an inlet that stops being put into
+   * should also check on `TryFlush`, so the latency threshold is enforced
+   * without another put.
+   */
+  bool IsOverdue() const {
+    if constexpr ( FlushPolicy::IsManual ) return false;
+    if ( num_staged == 0 ) return false;
+
+    if constexpr ( FlushPolicy::IsTimed ) {
+      if (
+        clock_t::now() - oldest_put >= FlushPolicy::GetMaxLatency()
+      ) return true;
+    }
+
+    return (
+      num_staged >= FlushPolicy::ItemThreshold
+      || num_staged * sizeof(value_type) >= FlushPolicy::ByteThreshold
+    );
+  }
+
+  /// Call after staged items have been flushed.
+  void Reset() { num_staged = 0; }
+
+  size_t GetNumStaged() const { return num_staged; }
+
+};
+
+} // namespace internal
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_INLET_TEMPLATED_IMPL_FLUSHTRIGGER_HPP_INCLUDE
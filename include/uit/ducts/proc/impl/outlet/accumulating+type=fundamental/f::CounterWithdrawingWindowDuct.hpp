@@ -0,0 +1,186 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_OUTLET_ACCUMULATING_TYPE_FUNDAMENTAL_F__COUNTERWITHDRAWINGWINDOWDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_OUTLET_ACCUMULATING_TYPE_FUNDAMENTAL_F__COUNTERWITHDRAWINGWINDOWDUCT_HPP_INCLUDE
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <stddef.h>
+
+#include <mpi.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../../../../../uitsl/debug/safe_cast.hpp"
+#include "../../../../../../uitsl/distributed/LockAllWindowManager.hpp"
+#include "../../../../../../uitsl/distributed/RdmaAccumulatorPacket.hpp"
+#include "../../../../../../uitsl/distributed/RdmaNotifiedPacket.hpp"
+#include "../../../../../../uitsl/meta/f::static_test.hpp"
+#include "../../../../../../uitsl/mpi/audited_routines.hpp"
+#include "../../../../../../uitsl/mpi/mpi_utils.hpp"
+#include "../../../../../../uitsl/mpi/Request.hpp"
+#include "../../../../../../uitsl/mpi/request_utils.hpp"
+#include "../../../../../../uitsl/parallel/cache_line.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/LockAllRdmaBackEnd.hpp"
+
+namespace uit {
+namespace f {
+
+/**
+ * Polls a counter that `uit::f::NotifyAccumulateDuct` bumps after each
+ * accumulate, and only withdraws the packet when the counter has moved.
+ *
+ * Withdrawal atomically swaps in a zeroed packet with `MPI_Get_accumulate`,
+ * so accumulates landing concurrently are never lost.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class CounterWithdrawingWindowDuct {
+
+public:
+
+  using BackEndImpl = uit::LockAllRdmaBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::f::static_test<T>(), uitsl_f_message );
+
+  using packet_t = uitsl::RdmaAccumulatorPacket<T>;
+  using notified_packet_t = uitsl::RdmaNotifiedPacket<packet_t>;
+  inline static const notified_packet_t pristine{};
+
+  packet_t cache{};
+  size_t last_count{};
+
+  const uit::InterProcAddress address;
+
+  std::shared_ptr<BackEndImpl> back_end;
+
+  const int byte_offset;
+
+  uitsl::Request byte_offset_request;
+
+  uitsl::LockAllWindowManager& GetWindowManager() {
+    return back_end->GetWindowManager();
+  }
+
+  size_t ReadCounter() {
+    GetWindowManager().Sync();
+    size_t res;
+    std::memcpy(
+      &res,
+      GetWindowManager().GetBytes(
+        byte_offset + notified_packet_t::GetCounterOffset()
+      ),
+      sizeof(res)
+    );
+    return res;
+  }
+
+public:
+
+  CounterWithdrawingWindowDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end_
+  ) : address(address_)
+  , back_end(back_end_)
+  , byte_offset(
+    address.GetOutletProc() == uitsl::get_rank(address.GetComm())
+      ? uitsl::safe_cast<int>( back_end->GetWindowManager().Acquire(
+        emp::vector<std::byte>(
+          reinterpret_cast<const std::byte*>(&pristine),
+          reinterpret_cast<const std::byte*>(&pristine)
+            + sizeof(notified_packet_t)
+        ),
+        uitsl::CACHE_LINE_SIZE
+      ) ) : -1
+  ) {
+    if (address.GetOutletProc() == uitsl::get_rank(address.GetComm())) {
+      UITSL_Isend(
+        &byte_offset, // const void *buf
+        1, // int count
+        MPI_INT, // MPI_Datatype datatype
+        address.GetInletProc(), // int dest
+        address.GetTag(), // int tag
+        address.GetComm(), // MPI_Comm comm
+        &byte_offset_request // MPI_Request * request
+      );
+    }
+  }
+
+  ~CounterWithdrawingWindowDuct() {
+    if ( !uitsl::test_null( byte_offset_request ) ) UITSL_Wait(
+      &byte_offset_request, MPI_STATUS_IGNORE
+    );
+  }
+
+  [[noreturn]] bool TryPut(const T&) {
+    emp_always_assert(false, "TryPut called on CounterWithdrawingWindowDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] bool TryFlush() const {
+    emp_always_assert(false, "Flush called on CounterWithdrawingWindowDuct");
+    __builtin_unreachable();
+  }
+
+  size_t TryConsumeGets(const size_t requested) {
+    emp_assert( requested == std::numeric_limits<size_t>::max() );
+
+    const size_t count = ReadCounter();
+    if ( count == last_count ) {
+      cache = packet_t{};
+      return 0;
+    }
+    last_count = count;
+
+    // swap zeros into own window
+    const auto& rank = address.GetOutletProc();
+    GetWindowManager().template GetAccumulate<T>(
+      rank,
+      pristine.payload.m_array,
+      cache.m_array,
+      2,
+      byte_offset + notified_packet_t::GetPayloadOffset(),
+      MPI_REPLACE
+    );
+    GetWindowManager().Flush( rank );
+
+    emp_assert( cache.epoch >= 0 );
+
+    return static_cast<size_t>( cache.epoch );
+  }
+
+  const T& Get() const { return cache.data; }
+
+  T& Get() { return cache.data; }
+
+  static std::string GetName() { return "CounterWithdrawingWindowDuct"; }
+
+  static constexpr bool CanStep() { return false; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetName() << std::endl;
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << std::endl;
+    ss << uitsl::format_member("int byte_offset", byte_offset) << std::endl;
+    ss << uitsl::format_member("size_t last_count", last_count) << std::endl;
+    ss << uitsl::format_member("InterProcAddress address", address);
+    return ss.str();
+  }
+
+};
+
+} // namespace f
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_OUTLET_ACCUMULATING_TYPE_FUNDAMENTAL_F__COUNTERWITHDRAWINGWINDOWDUCT_HPP_INCLUDE
@@ -0,0 +1,245 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_OUTLET_ACCUMULATING_TYPE_SPAN_S__CHUNKEDIRECVDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_OUTLET_ACCUMULATING_TYPE_SPAN_S__CHUNKEDIRECVDUCT_HPP_INCLUDE
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stddef.h>
+#include <string>
+#include <tuple>
+
+#include <mpi.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+#include "../../../../../../uitsl/datastructs/RingBuffer.hpp"
+#include "../../../../../../uitsl/debug/err_audit.hpp"
+#include "../../../../../../uitsl/debug/safe_cast.hpp"
+#include "../../../../../../uitsl/distributed/MsgAccumulatorBundle.hpp"
+#include "../../../../../../uitsl/distributed/MsgChunkLayout.hpp"
+#include "../../../../../../uitsl/meta/s::static_test.hpp"
+#include "../../../../../../uitsl/mpi/audited_routines.hpp"
+#include "../../../../../../uitsl/mpi/mpi_utils.hpp"
+#include "../../../../../../uitsl/mpi/Request.hpp"
+#include "../../../../../../uitsl/mpi/request_utils.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/RuntimeSizeBackEnd.hpp"
+
+namespace uit {
+namespace s {
+
+/**
+ * Accumulating receive duct that receives large spans as a pipeline of
+ * fixed-size chunks directly into place.
+ *
+ * Each chunk's items are added to the running sum as soon as that chunk
+ * lands, while later chunks are still arriving, so `Get` may reflect part
+ * of a message. The count returned by `TryConsumeGets` covers only fully
+ * received messages. Pairs with `uit::s::ChunkedIsendDuct` using the same
+ * ChunkBytes.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ * @tparam ChunkBytes target chunk size, rounded up to whole items.
+ */
+template<typename ImplSpec, size_t ChunkBytes=64 * 1024>
+class ChunkedIrecvDuct {
+
+public:
+
+  using BackEndImpl = uit::RuntimeSizeBackEnd<ImplSpec>;
+
+private:
+
+  const uit::InterProcAddress address;
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::s::static_test<T>(), uitsl_s_message );
+  using value_type = typename T::value_type;
+  constexpr inline static size_t N{ImplSpec::N};
+
+  // keep the trailing epoch within at most the last two chunks
+  static_assert( ChunkBytes >= sizeof(size_t) );
+
+  using bundle_t = uitsl::MsgAccumulatorBundle<value_type>;
+  bundle_t buffer;
+  bundle_t cache;
+
+  const uitsl::MsgChunkLayout<value_type> layout;
+
+  // chunk receives land in place, so a chunk's next receive may only be
+  // posted once its last one is consumed, and the chunks holding the
+  // trailing epoch must not be reposted before the epoch is read
+  const size_t max_in_flight;
+
+  // next chunk to post a receive for
+  size_t recv_chunk{};
+
+  using request_t = std::tuple<size_t, uitsl::Request>;
+  uitsl::RingBuffer<request_t, N> requests;
+
+  void PostChunkReceive() {
+    uitsl_err_audit(!   requests.PushHead()   );
+    auto& [chunk, request] = requests.GetHead();
+    emp_assert( uitsl::test_null( request ) );
+
+    chunk = recv_chunk;
+    UITSL_Irecv(
+      reinterpret_cast<std::byte*>( buffer.data() )
+        + layout.GetByteBegin( chunk ), // void *buf
+      uitsl::safe_cast<int>( layout.GetByteSize( chunk ) ), // int count
+      MPI_BYTE, // MPI_Datatype datatype
+      address.GetInletProc(), // int source
+      address.GetTag(), // int tag
+      address.GetComm(), // MPI_Comm comm
+      &request // MPI_Request *request
+    );
+    emp_assert( !uitsl::test_null( request ) );
+
+    recv_chunk = (recv_chunk + 1) % layout.GetNumChunks();
+  }
+
+  void PostChunkReceives() {
+    while ( requests.GetSize() < max_in_flight ) PostChunkReceive();
+  }
+
+  void ConsumeChunk(const size_t chunk) {
+    const size_t data_size = buffer.GetData().size();
+    const size_t begin = layout.GetItemBegin( chunk, data_size );
+    const size_t end = layout.GetItemEnd( chunk, data_size );
+    std::transform(
+      std::next( std::begin( buffer.GetData() ), begin ),
+      std::next( std::begin( buffer.GetData() ), end ),
+      std::next( std::begin( cache.GetData() ), begin ),
+      std::next( std::begin( cache.GetData() ), begin ),
+      std::plus<value_type>{}
+    );
+
+    // the final chunk completes the message and its epoch
+    if ( chunk + 1 == layout.GetNumChunks() ) {
+      cache.BumpEpoch( buffer.GetEpoch() );
+    }
+  }
+
+  // returns true if a chunk was received
+  bool TryReceiveChunk() {
+    auto& [chunk, request] = requests.GetTail();
+    emp_assert( !uitsl::test_null( request ) );
+
+    // chunks of one message match receives in posting order
+    if ( !uitsl::test_completion( request ) ) return false;
+
+    ConsumeChunk( chunk );
+    uitsl_err_audit(!   requests.PopTail()   );
+    PostChunkReceive();
+
+    return true;
+  }
+
+  void FlushReceives() {
+    // receives are only posted on the outlet proc
+    while ( requests.GetSize() && TryReceiveChunk() );
+  }
+
+  void CancelReceiveRequest() {
+    auto& request = std::get<uitsl::Request>( requests.GetTail() );
+    emp_assert( !uitsl::test_null( request ) );
+
+    UITSL_Cancel( &request );
+    UITSL_Request_free( &request );
+
+    emp_assert( uitsl::test_null( request ) );
+
+    uitsl_err_audit(!   requests.PopTail()   );
+  }
+
+public:
+
+  ChunkedIrecvDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end,
+    const BackEndImpl& rts = BackEndImpl{}
+  ) : address(address_)
+  , buffer( rts.HasSize() ? rts.GetSize() : back_end->GetSize() )
+  , cache( rts.HasSize() ? rts.GetSize() : back_end->GetSize() )
+  , layout( buffer.byte_size(), ChunkBytes )
+  , max_in_flight( std::clamp(
+    layout.GetNumChunks() - 1, size_t{1}, N
+  ) ) {
+    emp_assert( rts.HasSize() || back_end->HasSize() );
+    if ( uitsl::get_rank( address.GetComm() ) == address.GetOutletProc() ) {
+      PostChunkReceives();
+    }
+  }
+
+  ~ChunkedIrecvDuct() {
+    FlushReceives();
+    while ( requests.GetSize() ) CancelReceiveRequest();
+  }
+
+  [[noreturn]] bool TryPut(const T&) const {
+    emp_always_assert(false, "TryPut called on ChunkedIrecvDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] bool TryFlush() const {
+    emp_always_assert(false, "Flush called on ChunkedIrecvDuct");
+    __builtin_unreachable();
+  }
+
+  /**
+   * Reset the running sum, then add every chunk received since.
+   *
+   * @param num_requested must be max size_t, consuming all available.
+   * @return number of messages fully received.
+   */
+  size_t TryConsumeGets(const size_t num_requested) {
+
+    emp_assert( num_requested == std::numeric_limits<size_t>::max() );
+
+    cache.Reset();
+
+    FlushReceives();
+
+    return cache.GetEpoch();
+
+  }
+
+  /**
+   * Get the running sum of chunks received by the last `TryConsumeGets`.
+   */
+  const T& Get() const { return cache.GetData(); }
+
+  /**
+   * Get the running sum of chunks received by the last `TryConsumeGets`.
+   */
+  T& Get() { return cache.GetData(); }
+
+  static std::string GetName() { return "ChunkedIrecvDuct"; }
+
+  static constexpr bool CanStep() { return false; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetName() << std::endl;
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << std::endl;
+    ss << uitsl::format_member("size_t recv_chunk", recv_chunk) << std::endl;
+    ss << uitsl::format_member(
+      "size_t num_chunks", layout.GetNumChunks()
+    ) << std::endl;
+    ss << uitsl::format_member("InterProcAddress address", address) << std::endl;
+    return ss.str();
+  }
+
+};
+
+} // namespace s
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_OUTLET_ACCUMULATING_TYPE_SPAN_S__CHUNKEDIRECVDUCT_HPP_INCLUDE
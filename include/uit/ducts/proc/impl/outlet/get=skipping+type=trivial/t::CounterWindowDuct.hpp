@@ -0,0 +1,180 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_OUTLET_GET_SKIPPING_TYPE_TRIVIAL_T__COUNTERWINDOWDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_OUTLET_GET_SKIPPING_TYPE_TRIVIAL_T__COUNTERWINDOWDUCT_HPP_INCLUDE
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <stddef.h>
+
+#include <mpi.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/array.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../../../../../uitsl/debug/safe_cast.hpp"
+#include "../../../../../../uitsl/distributed/LockAllWindowManager.hpp"
+#include "../../../../../../uitsl/distributed/RdmaNotifiedPacket.hpp"
+#include "../../../../../../uitsl/meta/t::static_test.hpp"
+#include "../../../../../../uitsl/mpi/audited_routines.hpp"
+#include "../../../../../../uitsl/mpi/mpi_utils.hpp"
+#include "../../../../../../uitsl/mpi/Request.hpp"
+#include "../../../../../../uitsl/mpi/request_utils.hpp"
+#include "../../../../../../uitsl/parallel/cache_line.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/LockAllRdmaBackEnd.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Polls a counter that `uit::t::NotifyRputDuct` bumps after each put, and
+ * only reads the payload when the counter has moved.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class CounterWindowDuct {
+
+public:
+
+  using BackEndImpl = uit::LockAllRdmaBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::t::static_test<T>(), uitsl_t_message );
+
+  using packet_t = uitsl::RdmaNotifiedPacket<emp::array<T, 2>>;
+  inline static const packet_t pristine{};
+
+  T cache{};
+  size_t cur_epoch{};
+
+  const uit::InterProcAddress address;
+
+  std::shared_ptr<BackEndImpl> back_end;
+
+  const int byte_offset;
+
+  uitsl::Request byte_offset_request;
+
+  uitsl::LockAllWindowManager& GetWindowManager() {
+    return back_end->GetWindowManager();
+  }
+
+  size_t ReadCounter() {
+    GetWindowManager().Sync();
+    size_t res;
+    std::memcpy(
+      &res,
+      GetWindowManager().GetBytes(
+        byte_offset + packet_t::GetCounterOffset()
+      ),
+      sizeof(res)
+    );
+    return res;
+  }
+
+public:
+
+  CounterWindowDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end_
+  ) : address(address_)
+  , back_end(back_end_)
+  , byte_offset(
+    address.GetOutletProc() == uitsl::get_rank(address.GetComm())
+      ? uitsl::safe_cast<int>( back_end->GetWindowManager().Acquire(
+        emp::vector<std::byte>(
+          reinterpret_cast<const std::byte*>(&pristine),
+          reinterpret_cast<const std::byte*>(&pristine) + sizeof(packet_t)
+        ),
+        uitsl::CACHE_LINE_SIZE
+      ) ) : -1
+  ) {
+    if (address.GetOutletProc() == uitsl::get_rank(address.GetComm())) {
+      UITSL_Isend(
+        &byte_offset, // const void *buf
+        1, // int count
+        MPI_INT, // MPI_Datatype datatype
+        address.GetInletProc(), // int dest
+        address.GetTag(), // int tag
+        address.GetComm(), // MPI_Comm comm
+        &byte_offset_request // MPI_Request * request
+      );
+    }
+  }
+
+  ~CounterWindowDuct() {
+    if ( !uitsl::test_null( byte_offset_request ) ) UITSL_Wait(
+      &byte_offset_request, MPI_STATUS_IGNORE
+    );
+  }
+
+  [[noreturn]] bool TryPut(const T&) {
+    emp_always_assert(false, "TryPut called on CounterWindowDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] bool TryFlush() const {
+    emp_always_assert(false, "Flush called on CounterWindowDuct");
+    __builtin_unreachable();
+  }
+
+  size_t TryConsumeGets(const size_t requested) {
+    emp_assert( requested == std::numeric_limits<size_t>::max() );
+
+    const size_t epoch = ReadCounter();
+    if ( epoch == cur_epoch ) return 0;
+    emp_assert( epoch > cur_epoch, epoch, cur_epoch );
+
+    T latest;
+    std::memcpy(
+      reinterpret_cast<std::byte*>(&latest),
+      GetWindowManager().GetBytes(
+        byte_offset + packet_t::GetPayloadOffset() + (epoch % 2) * sizeof(T)
+      ),
+      sizeof(T)
+    );
+
+    // slot is reused for epoch + 2 only once the counter has moved past
+    // epoch, so the copy may be torn if it has; retry on a later poll
+    if ( ReadCounter() != epoch ) return 0;
+
+    const size_t elapsed_epochs = epoch - cur_epoch;
+    cache = latest;
+    cur_epoch = epoch;
+    return elapsed_epochs;
+  }
+
+  const T& Get() const { return cache; }
+
+  T& Get() { return cache; }
+
+  static std::string GetName() { return "CounterWindowDuct"; }
+
+  static constexpr bool CanStep() { return false; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetName() << std::endl;
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << std::endl;
+    ss << uitsl::format_member("int byte_offset", byte_offset) << std::endl;
+    ss << uitsl::format_member("size_t cur_epoch", cur_epoch) << std::endl;
+    ss << uitsl::format_member("InterProcAddress address", address);
+    return ss.str();
+  }
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_OUTLET_GET_SKIPPING_TYPE_TRIVIAL_T__COUNTERWINDOWDUCT_HPP_INCLUDE
@@ -0,0 +1,119 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_OUTLET_GET_SKIPPING_TYPE_TRIVIAL_T__INEIGHBORGETDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_OUTLET_GET_SKIPPING_TYPE_TRIVIAL_T__INEIGHBORGETDUCT_HPP_INCLUDE
+
+#include <limits>
+#include <memory>
+#include <stddef.h>
+#include <string>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/optional.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "../../../../../../uitsl/meta/t::static_test.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/NeighborhoodBackEnd.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Takes the latest value delivered by completed neighborhood exchanges.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class IneighborGetDuct {
+
+public:
+
+  using BackEndImpl = uit::NeighborhoodBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::t::static_test<T>(), uitsl_t_message );
+
+  const uit::InterProcAddress address;
+
+  std::shared_ptr<BackEndImpl> back_end;
+
+  emp::optional<size_t> slot;
+
+  T cur{};
+
+  size_t GetSlot() {
+    if ( !slot.has_value() ) slot = back_end->LookupOutletSlot( address );
+    return *slot;
+  }
+
+public:
+
+  IneighborGetDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end_
+  ) : address(address_)
+  , back_end(back_end_)
+  { back_end->RegisterOutletSlot( address ); }
+
+  [[noreturn]] bool TryPut(const T&) const {
+    emp_always_assert(false, "TryPut called on IneighborGetDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] bool TryFlush() const {
+    emp_always_assert(false, "Flush called on IneighborGetDuct");
+    __builtin_unreachable();
+  }
+
+  /**
+   * Jump to the latest value received for this outlet, progressing the
+   * back end's exchange if needed.
+   *
+   * @param num_requested must be std::numeric_limits<size_t>::max(), as
+   * this outlet can only skip to the latest value.
+   * @return number of puts made to this outlet's inlet since last call.
+   */
+  size_t TryConsumeGets(const size_t num_requested) {
+    emp_assert( num_requested == std::numeric_limits<size_t>::max() );
+    return back_end->TryConsumeGets( GetSlot(), cur );
+  }
+
+  /**
+   * Get latest value consumed.
+   *
+   * @return value-initialized T until a value has been received.
+   */
+  const T& Get() const { return cur; }
+
+  /**
+   * Get latest value consumed.
+   *
+   * @return value-initialized T until a value has been received.
+   */
+  T& Get() { return cur; }
+
+  static std::string GetName() { return "IneighborGetDuct"; }
+
+  static constexpr bool CanStep() { return false; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetName() << std::endl;
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << std::endl;
+    ss << uitsl::format_member("InterProcAddress address", address);
+    return ss.str();
+  }
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_OUTLET_GET_SKIPPING_TYPE_TRIVIAL_T__INEIGHBORGETDUCT_HPP_INCLUDE
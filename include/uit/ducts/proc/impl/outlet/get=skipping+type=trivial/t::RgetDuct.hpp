@@ -0,0 +1,186 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_OUTLET_GET_SKIPPING_TYPE_TRIVIAL_T__RGETDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_OUTLET_GET_SKIPPING_TYPE_TRIVIAL_T__RGETDUCT_HPP_INCLUDE
+
+#include <limits>
+#include <memory>
+#include <stddef.h>
+
+#include <mpi.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+#include "../../../../../../uitsl/distributed/LockAllWindowManager.hpp"
+#include "../../../../../../uitsl/distributed/RdmaVersionedPacket.hpp"
+#include "../../../../../../uitsl/meta/t::static_test.hpp"
+#include "../../../../../../uitsl/mpi/audited_routines.hpp"
+#include "../../../../../../uitsl/mpi/mpi_utils.hpp"
+#include "../../../../../../uitsl/mpi/Request.hpp"
+#include "../../../../../../uitsl/mpi/request_utils.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/LockAllRdmaBackEnd.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Fetches the latest value from the slot `uit::t::ExposeDuct` writes to,
+ * with `MPI_Rget`, only when a get is requested.
+ *
+ * Fetches that overlap a write are detected and discarded by comparing the
+ * slot's two epoch stamps. That requires the platform to copy a get's bytes
+ * in ascending address order; see `uitsl::RdmaVersionedPacket`.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ * @tparam Prefetch if set, issue the fetch for the next get as soon as the
+ * current one completes. Gets then no longer wait out a round trip, but
+ * return a value as old as the time since the previous get.
+ */
+template<typename ImplSpec, bool Prefetch=false>
+class RgetDuct {
+
+public:
+
+  using BackEndImpl = uit::LockAllRdmaBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::t::static_test<T>(), uitsl_t_message );
+
+  using packet_t = uitsl::RdmaVersionedPacket<T>;
+
+  T cache{};
+  size_t cur_epoch{};
+
+  // fetch target, must stay untouched while fetch_request is outstanding
+  packet_t fetched{};
+  uitsl::Request fetch_request;
+
+  const uit::InterProcAddress address;
+
+  std::shared_ptr<BackEndImpl> back_end;
+
+  uitsl::Request target_offset_request;
+  int target_offset;
+
+  uitsl::LockAllWindowManager& GetWindowManager() {
+    return back_end->GetWindowManager();
+  }
+
+  void PostFetch() {
+    emp_assert( uitsl::test_null( fetch_request ) );
+    GetWindowManager().Rget(
+      address.GetInletProc(),
+      reinterpret_cast<std::byte*>( &fetched ),
+      sizeof(packet_t),
+      target_offset,
+      &fetch_request
+    );
+  }
+
+  /// @return number of epochs elapsed since last fetched update.
+  size_t ConsumeFetch() {
+    // a fetch that overlapped a write is discarded, to retry on a later get
+    if ( !fetched.IsConsistent() || fetched.GetEpoch() <= cur_epoch ) {
+      return 0;
+    }
+
+    const size_t elapsed_epochs = fetched.GetEpoch() - cur_epoch;
+    cache = fetched.GetData();
+    cur_epoch = fetched.GetEpoch();
+    return elapsed_epochs;
+  }
+
+public:
+
+  RgetDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end_
+  ) : address(address_)
+  , back_end(back_end_)
+  {
+    if (uitsl::get_rank(address.GetComm()) == address.GetOutletProc()) {
+      GetWindowManager().Activate();
+      UITSL_Irecv(
+        &target_offset, // void *buf
+        1, // int count
+        MPI_INT, // MPI_Datatype datatype
+        address.GetInletProc(), // int source
+        address.GetTag(), // int tag
+        address.GetComm(), // MPI_Comm comm
+        &target_offset_request // MPI_Request *request
+      );
+    }
+  }
+
+  ~RgetDuct() {
+    if ( !uitsl::test_null( fetch_request ) ) UITSL_Wait(
+      &fetch_request, MPI_STATUS_IGNORE
+    );
+    if ( !uitsl::test_null( target_offset_request ) ) UITSL_Wait(
+      &target_offset_request, MPI_STATUS_IGNORE
+    );
+  }
+
+  [[noreturn]] bool TryPut(const T&) {
+    emp_always_assert(false, "TryPut called on RgetDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] bool TryFlush() const {
+    emp_always_assert(false, "Flush called on RgetDuct");
+    __builtin_unreachable();
+  }
+
+  /**
+   * Fetch the inlet's latest value, or pick up the prefetched one.
+   */
+  size_t TryConsumeGets(const size_t requested) {
+    emp_assert( requested == std::numeric_limits<size_t>::max() );
+
+    // inlet sends its slot offset during setup
+    if ( !uitsl::test_null( target_offset_request ) ) UITSL_Wait(
+      &target_offset_request, MPI_STATUS_IGNORE
+    );
+
+    if ( uitsl::test_null( fetch_request ) ) PostFetch();
+    UITSL_Wait( &fetch_request, MPI_STATUS_IGNORE );
+
+    const size_t res = ConsumeFetch();
+
+    if constexpr ( Prefetch ) PostFetch();
+
+    return res;
+  }
+
+  const T& Get() const { return cache; }
+
+  T& Get() { return cache; }
+
+  static std::string GetName() {
+    return Prefetch ? "PrefetchRgetDuct" : "RgetDuct";
+  }
+
+  static constexpr bool CanStep() { return false; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetName() << std::endl;
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << std::endl;
+    ss << uitsl::format_member("size_t cur_epoch", cur_epoch) << std::endl;
+    ss << uitsl::format_member("InterProcAddress address", address);
+    return ss.str();
+  }
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_OUTLET_GET_SKIPPING_TYPE_TRIVIAL_T__RGETDUCT_HPP_INCLUDE
@@ -0,0 +1,158 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_OUTLET_GET_SKIPPING_TYPE_TRIVIAL_T__SYNCWINDOWDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_OUTLET_GET_SKIPPING_TYPE_TRIVIAL_T__SYNCWINDOWDUCT_HPP_INCLUDE
+
+#include <limits>
+#include <memory>
+#include <stddef.h>
+
+#include <mpi.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../../../../../uitsl/debug/safe_cast.hpp"
+#include "../../../../../../uitsl/distributed/LockAllWindowManager.hpp"
+#include "../../../../../../uitsl/distributed/RdmaVersionedPacket.hpp"
+#include "../../../../../../uitsl/meta/t::static_test.hpp"
+#include "../../../../../../uitsl/mpi/audited_routines.hpp"
+#include "../../../../../../uitsl/mpi/mpi_utils.hpp"
+#include "../../../../../../uitsl/mpi/Request.hpp"
+#include "../../../../../../uitsl/mpi/request_utils.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/LockAllRdmaBackEnd.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Reads the latest packet written into this proc's slot of a shared RDMA
+ * window.
+ *
+ * The window stays in the back end's `lock_all` epoch, so reading only takes
+ * an `MPI_Win_sync` instead of a lock/unlock pair.
+ *
+ * A put may be landing while the slot is read. Reads whose leading and
+ * trailing epoch stamps disagree overlapped one and are discarded, to be
+ * retried on the next consume. Catching every such overlap requires that the
+ * platform write a put's bytes to target memory in ascending address order,
+ * which MPI does not guarantee but common RDMA transports do.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class SyncWindowDuct {
+
+public:
+
+  using BackEndImpl = uit::LockAllRdmaBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::t::static_test<T>(), uitsl_t_message );
+
+  using packet_t = uitsl::RdmaVersionedPacket<T>;
+
+  packet_t cache{};
+
+  const uit::InterProcAddress address;
+
+  std::shared_ptr<BackEndImpl> back_end;
+
+  const int byte_offset;
+
+  uitsl::Request byte_offset_request;
+
+public:
+
+  SyncWindowDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end_
+  ) : address(address_)
+  , back_end(back_end_)
+  , byte_offset(
+    address.GetOutletProc() == uitsl::get_rank(address.GetComm())
+      ? uitsl::safe_cast<int>( back_end->GetWindowManager().Acquire(
+        emp::vector<std::byte>(
+          reinterpret_cast<std::byte*>(&cache),
+          reinterpret_cast<std::byte*>(&cache) + sizeof(packet_t)
+        )
+      ) ) : -1
+  ) {
+    if (address.GetOutletProc() == uitsl::get_rank(address.GetComm())) {
+      UITSL_Isend(
+        &byte_offset, // const void *buf
+        1, // int count
+        MPI_INT, // MPI_Datatype datatype
+        address.GetInletProc(), // int dest
+        address.GetTag(), // int tag
+        address.GetComm(), // MPI_Comm comm
+        &byte_offset_request // MPI_Request * request
+      );
+    }
+  }
+
+  ~SyncWindowDuct() {
+    if ( !uitsl::test_null( byte_offset_request ) ) UITSL_Wait(
+      &byte_offset_request, MPI_STATUS_IGNORE
+    );
+  }
+
+  [[noreturn]] bool TryPut(const T&) {
+    emp_always_assert(false, "TryPut called on SyncWindowDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] bool TryFlush() const {
+    emp_always_assert(false, "Flush called on SyncWindowDuct");
+    __builtin_unreachable();
+  }
+
+  size_t TryConsumeGets(const size_t requested) {
+    emp_assert( requested == std::numeric_limits<size_t>::max() );
+
+    auto& window_manager = back_end->GetWindowManager();
+    window_manager.Sync();
+
+    const packet_t latest = packet_t::Read( reinterpret_cast<const packet_t*>(
+      window_manager.GetBytes( byte_offset )
+    ) );
+
+    // torn by a put still landing
+    if ( !latest.IsConsistent() ) return 0;
+    if ( latest.GetEpoch() <= cache.GetEpoch() ) return 0;
+
+    const size_t elapsed_epochs = latest.GetEpoch() - cache.GetEpoch();
+    cache = latest;
+    return elapsed_epochs;
+  }
+
+  const T& Get() const { return cache.GetData(); }
+
+  T& Get() { return cache.GetData(); }
+
+  static std::string GetName() { return "SyncWindowDuct"; }
+
+  static constexpr bool CanStep() { return false; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetName() << std::endl;
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << std::endl;
+    ss << uitsl::format_member("int byte_offset", byte_offset) << std::endl;
+    ss << uitsl::format_member("InterProcAddress address", address);
+    return ss.str();
+  }
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_OUTLET_GET_SKIPPING_TYPE_TRIVIAL_T__SYNCWINDOWDUCT_HPP_INCLUDE
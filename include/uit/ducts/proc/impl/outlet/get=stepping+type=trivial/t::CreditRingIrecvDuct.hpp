@@ -0,0 +1,387 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_OUTLET_GET_STEPPING_TYPE_TRIVIAL_T__CREDITRINGIRECVDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_OUTLET_GET_STEPPING_TYPE_TRIVIAL_T__CREDITRINGIRECVDUCT_HPP_INCLUDE
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <stddef.h>
+#include <utility>
+
+#include <mpi.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "../../../../../../uitsl/datastructs/RingBuffer.hpp"
+#include "../../../../../../uitsl/datastructs/SiftingArray.hpp"
+#include "../../../../../../uitsl/debug/err_audit.hpp"
+#include "../../../../../../uitsl/meta/t::static_test.hpp"
+#include "../../../../../../uitsl/mpi/audited_routines.hpp"
+#include "../../../../../../uitsl/mpi/mpi_types.hpp"
+#include "../../../../../../uitsl/mpi/mpi_utils.hpp"
+#include "../../../../../../uitsl/mpi/Request.hpp"
+#include "../../../../../../uitsl/mpi/request_utils.hpp"
+#include "../../../../../../uitsl/mpi/status_utils.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/CreditBackEnd.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Ring receive duct that grants the inlet one credit per receive it posts.
+ *
+ * Credits for reposted receives are batched into a single count message once
+ * half the ring has been consumed, so the inlet never sends to an unposted
+ * receive. Pairs with `uit::internal::TrivialCreditRingImmediateSendDuct`.
+ *
+ * On destruction, the duct keeps receiving, discarding, and granting credit
+ * until the inlet's empty end-of-data message arrives. Only the receives
+ * posted after that message, which no send can match, are cancelled.
+ * Receives posted before it are left to complete, and a zero grant tells
+ * the inlet no more credit is coming. The `uit::CreditBackEnd` finishes
+ * this handshake after the duct is gone.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class CreditRingIrecvDuct {
+
+public:
+
+  using BackEndImpl = uit::CreditBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::t::static_test<T>(), uitsl_t_message );
+  constexpr inline static size_t N{ImplSpec::N};
+
+  // communication state, which outlives the duct until teardown completes
+  class Channel {
+
+    // one extra in the data buffer to hold the current get
+    uitsl::RingBuffer<T, N + 1> data;
+    uitsl::SiftingArray<MPI_Request, N> requests;
+
+    // receives posted but not yet granted to the inlet as credit
+    size_t pending_credits{};
+    constexpr inline static size_t credit_batch{ (N + 1) / 2 };
+
+    size_t credit_send_buffer;
+    uitsl::Request credit_request;
+
+    // set once the inlet's empty end-of-data message arrives
+    bool fin_received{};
+
+    // set once the zero grant telling the inlet no more credit is coming
+    // has been sent
+    bool credits_closed{};
+
+    const uit::InterProcAddress address;
+
+    void PostCreditSend() {
+      emp_assert(
+        uitsl::test_null( credit_request )
+        || uitsl::test_completion( credit_request )
+      );
+      UITSL_Isend(
+        &credit_send_buffer, // const void *buf
+        1, // int count
+        uitsl::datatype_from_type<size_t>(), // MPI_Datatype datatype
+        address.GetInletProc(), // int dest
+        address.GetTag(), // int tag
+        address.GetComm(), // MPI_Comm comm
+        &credit_request // MPI_Request *request
+      );
+    }
+
+    void TryGrantCredits(const size_t min_batch=credit_batch) {
+      if ( fin_received ) return;
+      if ( pending_credits == 0 || pending_credits < min_batch ) return;
+      if (
+        !uitsl::test_null( credit_request )
+        && !uitsl::test_completion( credit_request )
+      ) return;
+
+      credit_send_buffer = pending_credits;
+      pending_credits = 0;
+      PostCreditSend();
+    }
+
+    void TryCloseCredits() {
+      emp_assert( fin_received );
+      if ( credits_closed ) return;
+      if (
+        !uitsl::test_null( credit_request )
+        && !uitsl::test_completion( credit_request )
+      ) return;
+
+      credit_send_buffer = 0;
+      PostCreditSend();
+      credits_closed = true;
+    }
+
+    void PostReceiveRequest() {
+      uitsl_err_audit(!
+        data.PushHead()
+      );
+      requests.PushBack( MPI_REQUEST_NULL );
+
+      emp_assert( uitsl::test_null( requests.Back() ) );
+      UITSL_Irecv(
+        &data.GetHead(),
+        sizeof(T),
+        MPI_BYTE,
+        address.GetInletProc(),
+        address.GetTag(),
+        address.GetComm(),
+        &requests.Back()
+      );
+      emp_assert( !uitsl::test_null( requests.Back() ) );
+
+      ++pending_credits;
+
+    }
+
+    void CancelReceiveRequest() {
+      emp_assert( !uitsl::test_null( requests.Back() ) );
+
+      UITSL_Cancel(  &requests.Back() );
+      UITSL_Request_free( &requests.Back() );
+
+      emp_assert( uitsl::test_null( requests.Back() ) );
+
+      uitsl_err_audit(!  data.PopHead()  );
+      uitsl_err_audit(!  requests.PopBack()  );
+
+    }
+
+    // discard the slot the end-of-data message landed in, along with the
+    // receives posted after it, which no send remains to match
+    void RetireFin(const size_t fin_index) {
+      emp_assert( fin_index < requests.GetSize() );
+      emp_assert( uitsl::test_null( requests.Get( fin_index ) ) );
+
+      while ( requests.GetSize() > fin_index + 1 ) CancelReceiveRequest();
+
+      uitsl_err_audit(!  data.PopHead()  );
+      uitsl_err_audit(!  requests.PopBack()  );
+
+      fin_received = true;
+    }
+
+    // requests stay in posting order, so they always back the newest data
+    // slots; receives that completed ahead of an older, still-transferring
+    // receive wait their turn as null requests
+    void RetireCompletedRequests() {
+      const auto first_pending = std::find_if(
+        std::begin(requests),
+        std::end(requests),
+        [](const auto& req){ return !uitsl::test_null( req ); }
+      );
+      const size_t num_completed = std::distance(
+        std::begin(requests), first_pending
+      );
+      std::move( first_pending, std::end(requests), std::begin(requests) );
+      for (size_t i{}; i < num_completed; ++i) requests.PopBack();
+    }
+
+    void TestRequests() {
+
+      // MPICH Testsome returns negative outcount for zero count calls
+      // so let's boogie out early to avoid drama
+      if (requests.GetSize() == 0) return;
+
+      // completed requests are only retired from the front
+      emp_assert( !uitsl::test_null( requests.Front() ) );
+
+      thread_local emp::array<int, N> out_indices;
+      thread_local emp::array<MPI_Status, N> statuses;
+      int num_received;
+
+      UITSL_Testsome(
+        requests.GetSize(), // int count
+        requests.GetData(), // MPI_Request array_of_requests[]
+        &num_received, // int *outcount
+        out_indices.data(), // int *indices
+        statuses.data() // MPI_Status array_of_statuses[]
+      );
+
+      emp_assert( num_received >= 0 );
+      emp_assert( static_cast<size_t>(num_received) <= requests.GetSize() );
+
+      for (int i{}; i < num_received; ++i) {
+        if ( uitsl::get_count( statuses[i], MPI_BYTE ) == 0 ) {
+          RetireFin( out_indices[i] );
+          break;
+        }
+      }
+
+    }
+
+    void TryFulfillReceiveRequests() {
+      TestRequests();
+      RetireCompletedRequests();
+    }
+
+  public:
+
+    explicit Channel(const uit::InterProcAddress& address_)
+    : address(address_) {
+
+      data.PushHead( T{} ); // value-initialized initial Get item
+      if (uitsl::get_rank(address.GetComm()) != address.GetOutletProc()) return;
+
+      for (size_t i = 0; i < N; ++i) PostReceiveRequest();
+      emp_assert( std::none_of(
+        std::begin(requests),
+        std::end(requests),
+        [](const auto& req){ return uitsl::test_null( req ); }
+      ) );
+      // receives are posted, so the inlet may now send
+      TryGrantCredits();
+    }
+
+    size_t CountUnconsumedGets() {
+      TryFulfillReceiveRequests();
+      return data.GetSize() - requests.GetSize() - 1;
+    }
+
+    size_t TryConsumeGets(const size_t num_requested) {
+
+      size_t requested_countdown{ num_requested };
+      size_t batch_countdown{ CountUnconsumedGets() };
+      bool full_batch = (batch_countdown == N);
+
+      while ( batch_countdown && requested_countdown ) {
+
+        --batch_countdown;
+        --requested_countdown;
+        uitsl_err_audit(!   data.PopTail()   );
+        if ( !fin_received ) PostReceiveRequest();
+
+        if (full_batch && batch_countdown == 0) {
+          batch_countdown = CountUnconsumedGets();
+          full_batch = (batch_countdown == N);
+        }
+      }
+
+      TryGrantCredits();
+
+      const size_t num_consumed = num_requested - requested_countdown;
+      return num_consumed;
+    }
+
+    /**
+     * Advance the teardown handshake without blocking.
+     *
+     * Until the inlet's end-of-data message arrives, received items are
+     * discarded and every reposted receive is granted right away, so the
+     * inlet always regains the credit it needs to send that message.
+     *
+     * @return true once the handshake has completed.
+     */
+    bool TryTeardown() {
+      TryConsumeGets( CountUnconsumedGets() );
+      if ( !fin_received ) { TryGrantCredits( 1 ); return false; }
+
+      TryCloseCredits();
+      // receives that matched before end-of-data may still be transferring
+      return credits_closed
+        && requests.GetSize() == 0
+        && uitsl::test_completion( credit_request );
+    }
+
+    T& Get() { return data.GetTail(); }
+
+    const T& Get() const { return data.GetTail(); }
+
+    size_t GetPendingCredits() const { return pending_credits; }
+
+    const uit::InterProcAddress& GetAddress() const { return address; }
+
+  };
+
+  std::shared_ptr<Channel> channel;
+
+  std::shared_ptr<BackEndImpl> back_end;
+
+public:
+
+  CreditRingIrecvDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end_
+  ) : channel( std::make_shared<Channel>( address_ ) )
+  , back_end( back_end_ ) {
+    emp_always_assert(
+      address_.GetInletProc() != address_.GetOutletProc(),
+      "credit ring ducts tell data from credits by direction",
+      address_.ToString()
+    );
+  }
+
+  ~CreditRingIrecvDuct() {
+    const auto& address = channel->GetAddress();
+    if (uitsl::get_rank(address.GetComm()) != address.GetOutletProc()) return;
+    back_end->Retire(
+      [channel = std::move(channel)](){ return channel->TryTeardown(); }
+    );
+  }
+
+  [[noreturn]] bool TryPut(const T&) const {
+    emp_always_assert(false, "TryPut called on CreditRingIrecvDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] bool TryFlush() const {
+    emp_always_assert(false, "Flush called on CreditRingIrecvDuct");
+    __builtin_unreachable();
+  }
+
+  /**
+   * Consume up to num_requested received items, reposting a receive and
+   * accruing a credit for each.
+   *
+   * @param num_requested number of items to consume.
+   * @return number items consumed.
+   */
+  size_t TryConsumeGets(const size_t num_requested) {
+    return channel->TryConsumeGets( num_requested );
+  }
+
+  /**
+   * Get the oldest unconsumed item.
+   */
+  const T& Get() const { return std::as_const( *channel ).Get(); }
+
+  /**
+   * Get the oldest unconsumed item.
+   */
+  T& Get() { return channel->Get(); }
+
+  static std::string GetName() { return "CreditRingIrecvDuct"; }
+
+  static constexpr bool CanStep() { return true; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetName() << std::endl;
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << std::endl;
+    ss << uitsl::format_member("size_t pending_credits", channel->GetPendingCredits()) << std::endl;
+    ss << uitsl::format_member("InterProcAddress address", channel->GetAddress()) << std::endl;
+    return ss.str();
+  }
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_OUTLET_GET_STEPPING_TYPE_TRIVIAL_T__CREDITRINGIRECVDUCT_HPP_INCLUDE
@@ -0,0 +1,180 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_OUTLET_GET_STEPPING_TYPE_TRIVIAL_T__OFFLOADRINGIRECVDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_OUTLET_GET_STEPPING_TYPE_TRIVIAL_T__OFFLOADRINGIRECVDUCT_HPP_INCLUDE
+
+#include <algorithm>
+#include <memory>
+#include <stddef.h>
+#include <string>
+#include <tuple>
+
+#include <mpi.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+#include "../../../../../../uitsl/datastructs/RingBuffer.hpp"
+#include "../../../../../../uitsl/datastructs/SpscRingBuffer.hpp"
+#include "../../../../../../uitsl/debug/err_audit.hpp"
+#include "../../../../../../uitsl/meta/t::static_test.hpp"
+#include "../../../../../../uitsl/mpi/audited_routines.hpp"
+#include "../../../../../../uitsl/mpi/mpi_utils.hpp"
+#include "../../../../../../uitsl/mpi/ProgressEngine.hpp"
+#include "../../../../../../uitsl/mpi/ProgressThread.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/ProgressEngineBackEnd.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Ring receive duct whose receives are posted and completed by the
+ * process's `uitsl::ProgressThread`.
+ *
+ * The progress thread moves received items, in order, into a lock-free
+ * queue and reposts their receives. Gets and steps only touch that queue
+ * and never call into MPI. While the queue is full, completed receives are
+ * held and not reposted. Pairs with `uit::t::OffloadRingIsendDuct`.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class OffloadRingIrecvDuct {
+
+public:
+
+  using BackEndImpl = uit::ProgressEngineBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::t::static_test<T>(), uitsl_t_message );
+  constexpr inline static size_t N{ImplSpec::N};
+
+  // progress thread only, value being received and whether it has arrived
+  uitsl::RingBuffer<std::tuple<T, bool>, N> posted;
+
+  // filled by the progress thread, front is the current get
+  // one extra to hold the current get alongside N received items
+  uitsl::SpscRingBuffer<T, N + 1> delivered;
+
+  const uit::InterProcAddress address;
+
+  // keep progress thread alive for as long as it holds our requests
+  std::shared_ptr<BackEndImpl> back_end;
+  uitsl::ProgressThread& progress_thread;
+
+  void PostReceiveRequest(uitsl::ProgressEngine& engine) {
+    uitsl_err_audit(!   posted.PushHead()   );
+    auto& [val, received] = posted.GetHead();
+    received = false;
+
+    MPI_Request request;
+    UITSL_Irecv(
+      &val, // void *buf
+      sizeof(T), // int count
+      MPI_BYTE, // MPI_Datatype datatype
+      address.GetInletProc(), // int source
+      address.GetTag(), // int tag
+      address.GetComm(), // MPI_Comm comm
+      &request // MPI_Request *request
+    );
+
+    // slots are not reused until delivered, so the flag outlives the request
+    engine.Track( request, this, [&received](){ received = true; } );
+  }
+
+  /**
+   * Deliver the received run at the tail and repost receives. Called from
+   * the progress thread.
+   *
+   * Receives match in posting order but may be reported out of order, so
+   * only the received run at the tail is delivered.
+   */
+  bool Progress(uitsl::ProgressEngine& engine) {
+    bool busy{};
+    while (
+      posted.GetSize()
+      && std::get<bool>( posted.GetTail() )
+      && delivered.TryPush( std::get<T>( posted.GetTail() ) )
+    ) {
+      uitsl_err_audit(!   posted.PopTail()   );
+      busy = true;
+    }
+    while ( posted.GetSize() < N ) {
+      PostReceiveRequest( engine );
+      busy = true;
+    }
+    return busy;
+  }
+
+  size_t CountUnconsumedGets() const { return delivered.GetSize() - 1; }
+
+public:
+
+  OffloadRingIrecvDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end_
+  ) : address(address_)
+  , back_end(back_end_)
+  , progress_thread( back_end->GetProgressThread() ) {
+
+    delivered.TryPush( T{} ); // value-initialized initial Get item
+    if (uitsl::get_rank(address.GetComm()) != address.GetOutletProc()) return;
+    progress_thread.Register(
+      this, [this](uitsl::ProgressEngine& engine){ return Progress(engine); }
+    );
+  }
+
+  ~OffloadRingIrecvDuct() { progress_thread.Unregister( this ); }
+
+  [[noreturn]] bool TryPut(const T&) const {
+    emp_always_assert(false, "TryPut called on OffloadRingIrecvDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] bool TryFlush() const {
+    emp_always_assert(false, "Flush called on OffloadRingIrecvDuct");
+    __builtin_unreachable();
+  }
+
+  /**
+   * Step past up to num_requested delivered items.
+   *
+   * @param num_requested number of items to step past.
+   * @return number items consumed.
+   */
+  size_t TryConsumeGets(const size_t num_requested) {
+    const size_t num_consumed = std::min(
+      CountUnconsumedGets(), num_requested
+    );
+    for (size_t i{}; i < num_consumed; ++i) delivered.Pop();
+    return num_consumed;
+  }
+
+  const T& Get() const { return delivered.GetFront(); }
+
+  T& Get() { return delivered.GetFront(); }
+
+  static std::string GetName() { return "OffloadRingIrecvDuct"; }
+
+  static constexpr bool CanStep() { return true; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetName() << std::endl;
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << std::endl;
+    ss << uitsl::format_member("InterProcAddress address", address) << std::endl;
+    return ss.str();
+  }
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_OUTLET_GET_STEPPING_TYPE_TRIVIAL_T__OFFLOADRINGIRECVDUCT_HPP_INCLUDE
@@ -0,0 +1,179 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_OUTLET_GET_STEPPING_TYPE_TRIVIAL_T__PROGRESSRINGIRECVDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_OUTLET_GET_STEPPING_TYPE_TRIVIAL_T__PROGRESSRINGIRECVDUCT_HPP_INCLUDE
+
+#include <algorithm>
+#include <memory>
+#include <stddef.h>
+#include <string>
+#include <tuple>
+
+#include <mpi.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+#include "../../../../../../uitsl/datastructs/RingBuffer.hpp"
+#include "../../../../../../uitsl/debug/err_audit.hpp"
+#include "../../../../../../uitsl/meta/t::static_test.hpp"
+#include "../../../../../../uitsl/mpi/audited_routines.hpp"
+#include "../../../../../../uitsl/mpi/mpi_utils.hpp"
+#include "../../../../../../uitsl/mpi/ProgressEngine.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/ProgressEngineBackEnd.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Ring receive duct whose receive requests are owned by its thread's
+ * `uitsl::ProgressEngine` instead of being tested one by one.
+ *
+ * Each visit polls the engine only if no other duct on the thread has
+ * since, so a step over many ducts costs one `MPI_Testsome`. Completion
+ * callbacks mark ring slots received. Pairs with
+ * `uit::t::ProgressRingIsendDuct`.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class ProgressRingIrecvDuct {
+
+public:
+
+  using BackEndImpl = uit::ProgressEngineBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::t::static_test<T>(), uitsl_t_message );
+  constexpr inline static size_t N{ImplSpec::N};
+
+  // one extra in the data buffer to hold the current get
+  // value and whether its receive has completed
+  uitsl::RingBuffer<std::tuple<T, bool>, N + 1> data;
+
+  const uit::InterProcAddress address;
+
+  // keep engine alive for as long as it holds our requests
+  std::shared_ptr<BackEndImpl> back_end;
+  uitsl::ProgressEngine& engine;
+
+  // engine poll count as of our last visit
+  size_t last_poll{};
+
+  void PostReceiveRequest() {
+    uitsl_err_audit(!   data.PushHead()   );
+    auto& [val, received] = data.GetHead();
+    received = false;
+
+    MPI_Request request;
+    UITSL_Irecv(
+      &val, // void *buf
+      sizeof(T), // int count
+      MPI_BYTE, // MPI_Datatype datatype
+      address.GetInletProc(), // int source
+      address.GetTag(), // int tag
+      address.GetComm(), // MPI_Comm comm
+      &request // MPI_Request *request
+    );
+
+    // slots are not reused until consumed, so the flag outlives the request
+    engine.Track( request, this, [&received](){ received = true; } );
+  }
+
+  /**
+   * Count received items behind the current get.
+   *
+   * Receives match in posting order but may be reported out of order, so
+   * only the received run directly behind the current get counts.
+   */
+  size_t CountUnconsumedGets() {
+    engine.PollIfStale( last_poll );
+    size_t res{};
+    while (
+      res + 1 < data.GetSize() && std::get<bool>( data.Get(res + 1) )
+    ) ++res;
+    return res;
+  }
+
+public:
+
+  ProgressRingIrecvDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end_
+  ) : address(address_)
+  , back_end(back_end_)
+  , engine( back_end->GetEngine( address.GetOutletThread() ) ) {
+
+    data.PushHead( {T{}, true} ); // value-initialized initial Get item
+    if (uitsl::get_rank(address.GetComm()) != address.GetOutletProc()) return;
+    for (size_t i = 0; i < N; ++i) PostReceiveRequest();
+  }
+
+  ~ProgressRingIrecvDuct() {
+    while ( CountUnconsumedGets() ) TryConsumeGets( CountUnconsumedGets() );
+    engine.Cancel( this );
+  }
+
+  [[noreturn]] bool TryPut(const T&) const {
+    emp_always_assert(false, "TryPut called on ProgressRingIrecvDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] bool TryFlush() const {
+    emp_always_assert(false, "Flush called on ProgressRingIrecvDuct");
+    __builtin_unreachable();
+  }
+
+  /**
+   * Step past up to num_requested received items, reposting a receive for
+   * each.
+   *
+   * @param num_requested number of items to step past.
+   * @return number items consumed.
+   */
+  size_t TryConsumeGets(const size_t num_requested) {
+
+    size_t num_consumed{};
+
+    // a full batch may mean more arrived behind it, so count again
+    size_t batch;
+    do {
+      batch = std::min( CountUnconsumedGets(), num_requested - num_consumed );
+      for (size_t i{}; i < batch; ++i) {
+        uitsl_err_audit(!   data.PopTail()   );
+        PostReceiveRequest();
+      }
+      num_consumed += batch;
+    } while ( batch == N && num_consumed < num_requested );
+
+    return num_consumed;
+  }
+
+  const T& Get() const { return std::get<T>( data.GetTail() ); }
+
+  T& Get() { return std::get<T>( data.GetTail() ); }
+
+  static std::string GetName() { return "ProgressRingIrecvDuct"; }
+
+  static constexpr bool CanStep() { return true; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetName() << std::endl;
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << std::endl;
+    ss << uitsl::format_member("InterProcAddress address", address) << std::endl;
+    return ss.str();
+  }
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_OUTLET_GET_STEPPING_TYPE_TRIVIAL_T__PROGRESSRINGIRECVDUCT_HPP_INCLUDE
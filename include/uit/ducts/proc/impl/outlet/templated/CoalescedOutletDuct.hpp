@@ -0,0 +1,126 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_OUTLET_TEMPLATED_COALESCEDOUTLETDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_OUTLET_TEMPLATED_COALESCEDOUTLETDUCT_HPP_INCLUDE
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <stddef.h>
+
+#include <mpi.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/optional.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "../../../../../../uitsl/mpi/mpi_utils.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/CoalescedBackEnd.hpp"
+
+namespace uit {
+
+/**
+ * Outlet that gets from its thread's share of the frames combined across the
+ * threads of the sending proc, see `uit::CoalescedBackEnd`.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<template<typename> typename BackingDuct, typename ImplSpec>
+class CoalescedOutletDuct {
+
+public:
+
+  using BackEndImpl = uit::CoalescedBackEnd<ImplSpec, BackingDuct>;
+
+private:
+
+  using T = typename ImplSpec::T;
+
+  uit::InterProcAddress address;
+
+  std::shared_ptr<BackEndImpl> back_end;
+
+  using aggregator_t = typename BackEndImpl::outlet_aggregator_t;
+  emp::optional<std::reference_wrapper<aggregator_t>> aggregator;
+
+  void SetupAggregator() {
+    aggregator = back_end->GetOutletAggregator(address);
+  }
+
+public:
+
+  CoalescedOutletDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end_
+  ) : address(address_)
+  , back_end(back_end_)
+  { back_end->RegisterOutletSlot(address); }
+
+  [[noreturn]] bool TryPut(const T&) const {
+    emp_always_assert(false, "TryPut called on CoalescedOutletDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] bool TryFlush() const {
+    emp_always_assert(false, "Flush called on CoalescedOutletDuct");
+    __builtin_unreachable();
+  }
+
+  /**
+   * Step past up to num_requested received values.
+   *
+   * @param num_requested number of values to step past.
+   * @return number items consumed.
+   */
+  size_t TryConsumeGets(const size_t num_requested) {
+
+    if (!aggregator.has_value()) SetupAggregator();
+    return aggregator->get().TryConsumeGets(num_requested, address.GetTag());
+
+  }
+
+  /**
+   * Get the current value.
+   *
+   * @return current value.
+   */
+  const T& Get() const {
+    if (!aggregator.has_value()) {
+      const_cast<CoalescedOutletDuct*>(this)->SetupAggregator();
+    }
+    return std::as_const(aggregator->get()).Get(address.GetTag());
+  }
+
+  /**
+   * Get the current value.
+   *
+   * @return current value.
+   */
+  T& Get() {
+    if (!aggregator.has_value()) SetupAggregator();
+    return aggregator->get().Get(address.GetTag());
+  }
+
+  static std::string GetName() { return "CoalescedOutletDuct"; }
+
+  static constexpr bool CanStep() {
+    return BackingDuct<ImplSpec>::OutletImpl::CanStep();
+  }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetName() << std::endl;
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << std::endl;
+    return ss.str();
+  }
+
+};
+
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_OUTLET_TEMPLATED_COALESCEDOUTLETDUCT_HPP_INCLUDE
@@ -0,0 +1,40 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_SKIPPING_TYPE_TRIVIAL_INLET_EXPOSE_OUTLET_PREFETCHRGET_T__IEOPRDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_PUT_DROPPING_GET_SKIPPING_TYPE_TRIVIAL_INLET_EXPOSE_OUTLET_PREFETCHRGET_T__IEOPRDUCT_HPP_INCLUDE
+
+#include <type_traits>
+
+#include "../impl/inlet/put=dropping+type=trivial/t::ExposeDuct.hpp"
+#include "../impl/outlet/get=skipping+type=trivial/t::RgetDuct.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Pull-model RDMA duct like `uit::t::IeOrDuct`, but each get picks up a
+ * fetch issued at the previous get, trading freshness for latency.
+ *
+ * Shares `uit::t::IeOrDuct`'s platform requirement.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+struct IeOprDuct {
+
+  using InletImpl = uit::t::ExposeDuct<ImplSpec>;
+  using OutletImpl = uit::t::RgetDuct<ImplSpec, true>;
+
+  static_assert(std::is_same<
+    typename InletImpl::BackEndImpl,
+    typename OutletImpl::BackEndImpl
+  >::value);
+
+  using BackEndImpl = typename InletImpl::BackEndImpl;
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_SKIPPING_TYPE_TRIVIAL_INLET_EXPOSE_OUTLET_PREFETCHRGET_T__IEOPRDUCT_HPP_INCLUDE
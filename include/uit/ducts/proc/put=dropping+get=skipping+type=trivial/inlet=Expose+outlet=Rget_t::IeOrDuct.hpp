@@ -0,0 +1,42 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_SKIPPING_TYPE_TRIVIAL_INLET_EXPOSE_OUTLET_RGET_T__IEORDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_PUT_DROPPING_GET_SKIPPING_TYPE_TRIVIAL_INLET_EXPOSE_OUTLET_RGET_T__IEORDUCT_HPP_INCLUDE
+
+#include <type_traits>
+
+#include "../impl/inlet/put=dropping+type=trivial/t::ExposeDuct.hpp"
+#include "../impl/outlet/get=skipping+type=trivial/t::RgetDuct.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Pull-model RDMA duct: the outlet fetches the inlet's latest value on each
+ * get, so nothing crosses the network for values that are never read. Suits
+ * edges where puts far outnumber gets.
+ *
+ * Only safe on platforms whose RDMA gets copy in ascending address order,
+ * as `uitsl::RdmaVersionedPacket` requires.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+struct IeOrDuct {
+
+  using InletImpl = uit::t::ExposeDuct<ImplSpec>;
+  using OutletImpl = uit::t::RgetDuct<ImplSpec>;
+
+  static_assert(std::is_same<
+    typename InletImpl::BackEndImpl,
+    typename OutletImpl::BackEndImpl
+  >::value);
+
+  using BackEndImpl = typename InletImpl::BackEndImpl;
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_SKIPPING_TYPE_TRIVIAL_INLET_EXPOSE_OUTLET_RGET_T__IEORDUCT_HPP_INCLUDE
@@ -0,0 +1,39 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_SKIPPING_TYPE_TRIVIAL_INLET_FLUSHRPUT_OUTLET_SYNCWINDOW_T__IFROSWDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_PUT_DROPPING_GET_SKIPPING_TYPE_TRIVIAL_INLET_FLUSHRPUT_OUTLET_SYNCWINDOW_T__IFROSWDUCT_HPP_INCLUDE
+
+#include <type_traits>
+
+#include "../impl/inlet/put=dropping+type=trivial/t::FlushRputDuct.hpp"
+#include "../impl/outlet/get=skipping+type=trivial/t::SyncWindowDuct.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * RDMA duct over a single window per communicator, held open in one
+ * `lock_all` epoch. See `uit::t::IrrOwDuct` for the per-peer-window
+ * equivalent.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+struct IfrOswDuct {
+
+  using InletImpl = uit::t::FlushRputDuct<ImplSpec>;
+  using OutletImpl = uit::t::SyncWindowDuct<ImplSpec>;
+
+  static_assert(std::is_same<
+    typename InletImpl::BackEndImpl,
+    typename OutletImpl::BackEndImpl
+  >::value);
+
+  using BackEndImpl = typename InletImpl::BackEndImpl;
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_SKIPPING_TYPE_TRIVIAL_INLET_FLUSHRPUT_OUTLET_SYNCWINDOW_T__IFROSWDUCT_HPP_INCLUDE
@@ -0,0 +1,38 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_SKIPPING_TYPE_TRIVIAL_INLET_INEIGHBORPUT_OUTLET_INEIGHBORGET_T__IIPOIGDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_PUT_DROPPING_GET_SKIPPING_TYPE_TRIVIAL_INLET_INEIGHBORPUT_OUTLET_INEIGHBORGET_T__IIPOIGDUCT_HPP_INCLUDE
+
+#include <type_traits>
+
+#include "../impl/inlet/put=dropping+type=trivial/t::IneighborPutDuct.hpp"
+#include "../impl/outlet/get=skipping+type=trivial/t::IneighborGetDuct.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Latest-value exchange of every inter-process duct in a mesh with one
+ * `MPI_Ineighbor_alltoallv` per step.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+struct IipOigDuct {
+
+  using InletImpl = uit::t::IneighborPutDuct<ImplSpec>;
+  using OutletImpl = uit::t::IneighborGetDuct<ImplSpec>;
+
+  static_assert(std::is_same<
+    typename InletImpl::BackEndImpl,
+    typename OutletImpl::BackEndImpl
+  >::value);
+
+  using BackEndImpl = typename InletImpl::BackEndImpl;
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_SKIPPING_TYPE_TRIVIAL_INLET_INEIGHBORPUT_OUTLET_INEIGHBORGET_T__IIPOIGDUCT_HPP_INCLUDE
@@ -0,0 +1,38 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_SKIPPING_TYPE_TRIVIAL_INLET_NOTIFYRPUT_OUTLET_COUNTERWINDOW_T__INROCWDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_PUT_DROPPING_GET_SKIPPING_TYPE_TRIVIAL_INLET_NOTIFYRPUT_OUTLET_COUNTERWINDOW_T__INROCWDUCT_HPP_INCLUDE
+
+#include <type_traits>
+
+#include "../impl/inlet/put=dropping+type=trivial/t::NotifyRputDuct.hpp"
+#include "../impl/outlet/get=skipping+type=trivial/t::CounterWindowDuct.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * RDMA duct whose outlet polls a notification counter instead of the whole
+ * packet. See `uit::t::IfrOswDuct` for the unnotified equivalent.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+struct InrOcwDuct {
+
+  using InletImpl = uit::t::NotifyRputDuct<ImplSpec>;
+  using OutletImpl = uit::t::CounterWindowDuct<ImplSpec>;
+
+  static_assert(std::is_same<
+    typename InletImpl::BackEndImpl,
+    typename OutletImpl::BackEndImpl
+  >::value);
+
+  using BackEndImpl = typename InletImpl::BackEndImpl;
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_SKIPPING_TYPE_TRIVIAL_INLET_NOTIFYRPUT_OUTLET_COUNTERWINDOW_T__INROCWDUCT_HPP_INCLUDE
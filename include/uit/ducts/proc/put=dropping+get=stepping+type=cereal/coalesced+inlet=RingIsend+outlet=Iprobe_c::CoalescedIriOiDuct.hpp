@@ -0,0 +1,46 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_STEPPING_TYPE_CEREAL_COALESCED_INLET_RINGISEND_OUTLET_IPROBE_C__COALESCEDIRIOIDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_PUT_DROPPING_GET_STEPPING_TYPE_CEREAL_COALESCED_INLET_RINGISEND_OUTLET_IPROBE_C__COALESCEDIRIOIDUCT_HPP_INCLUDE
+
+#include <type_traits>
+
+#include "../impl/inlet/templated/CoalescedInletDuct.hpp"
+#include "../impl/outlet/templated/CoalescedOutletDuct.hpp"
+
+#include "inlet=RingIsend+outlet=Iprobe_c::IriOiDuct.hpp"
+
+namespace uit {
+namespace c {
+
+/**
+ * Cereal ring send/probe duct aggregated per thread and then combined
+ * across the threads of each proc, so that one message goes between each
+ * pair of procs per flush round.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class CoalescedIriOiDuct {
+
+  template<typename Spec>
+  using BackingDuct = uit::c::IriOiDuct<Spec>;
+
+public:
+
+  using InletImpl = uit::CoalescedInletDuct<BackingDuct, ImplSpec>;
+  using OutletImpl = uit::CoalescedOutletDuct<BackingDuct, ImplSpec>;
+
+  static_assert(std::is_same<
+    typename InletImpl::BackEndImpl,
+    typename OutletImpl::BackEndImpl
+  >::value);
+
+  using BackEndImpl = typename InletImpl::BackEndImpl;
+
+};
+
+} // namespace c
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_STEPPING_TYPE_CEREAL_COALESCED_INLET_RINGISEND_OUTLET_IPROBE_C__COALESCEDIRIOIDUCT_HPP_INCLUDE
@@ -0,0 +1,38 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_STEPPING_TYPE_TRIVIAL_INLET_CREDITRINGIRSEND_OUTLET_CREDITRINGIRECV_T__ICRIROCRIDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_PUT_DROPPING_GET_STEPPING_TYPE_TRIVIAL_INLET_CREDITRINGIRSEND_OUTLET_CREDITRINGIRECV_T__ICRIROCRIDUCT_HPP_INCLUDE
+
+#include <type_traits>
+
+#include "../impl/inlet/put=dropping+type=trivial/t::CreditRingIrsendDuct.hpp"
+#include "../impl/outlet/get=stepping+type=trivial/t::CreditRingIrecvDuct.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Credit-limited ring duct like `uit::t::IcriOcriDuct`. Credit guarantees a
+ * posted receive for every send, so it can use ready-mode sends.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+struct IcrirOcriDuct {
+
+  using InletImpl = uit::t::CreditRingIrsendDuct<ImplSpec>;
+  using OutletImpl = uit::t::CreditRingIrecvDuct<ImplSpec>;
+
+  static_assert(std::is_same<
+    typename InletImpl::BackEndImpl,
+    typename OutletImpl::BackEndImpl
+  >::value);
+
+  using BackEndImpl = typename InletImpl::BackEndImpl;
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_STEPPING_TYPE_TRIVIAL_INLET_CREDITRINGIRSEND_OUTLET_CREDITRINGIRECV_T__ICRIROCRIDUCT_HPP_INCLUDE
@@ -0,0 +1,39 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_STEPPING_TYPE_TRIVIAL_INLET_CREDITRINGISEND_OUTLET_CREDITRINGIRECV_T__ICRIOCRIDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_PUT_DROPPING_GET_STEPPING_TYPE_TRIVIAL_INLET_CREDITRINGISEND_OUTLET_CREDITRINGIRECV_T__ICRIOCRIDUCT_HPP_INCLUDE
+
+#include <type_traits>
+
+#include "../impl/inlet/put=dropping+type=trivial/t::CreditRingIsendDuct.hpp"
+#include "../impl/outlet/get=stepping+type=trivial/t::CreditRingIrecvDuct.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Ring duct whose inlet only sends within credit the outlet grants as it
+ * consumes, so fast inlets drop puts locally instead of flooding the
+ * outlet's unexpected-message queue.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+struct IcriOcriDuct {
+
+  using InletImpl = uit::t::CreditRingIsendDuct<ImplSpec>;
+  using OutletImpl = uit::t::CreditRingIrecvDuct<ImplSpec>;
+
+  static_assert(std::is_same<
+    typename InletImpl::BackEndImpl,
+    typename OutletImpl::BackEndImpl
+  >::value);
+
+  using BackEndImpl = typename InletImpl::BackEndImpl;
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_STEPPING_TYPE_TRIVIAL_INLET_CREDITRINGISEND_OUTLET_CREDITRINGIRECV_T__ICRIOCRIDUCT_HPP_INCLUDE
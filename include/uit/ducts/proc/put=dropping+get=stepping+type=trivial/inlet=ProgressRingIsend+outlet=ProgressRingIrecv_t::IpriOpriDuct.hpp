@@ -0,0 +1,58 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_STEPPING_TYPE_TRIVIAL_INLET_PROGRESSRINGISEND_OUTLET_PROGRESSRINGIRECV_T__IPRIOPRIDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_PUT_DROPPING_GET_STEPPING_TYPE_TRIVIAL_INLET_PROGRESSRINGISEND_OUTLET_PROGRESSRINGIRECV_T__IPRIOPRIDUCT_HPP_INCLUDE
+
+#include <type_traits>
+
+#include "../../../setup/ProgressPolicy.hpp"
+
+#include "../impl/inlet/put=dropping+type=trivial/t::OffloadRingIsendDuct.hpp"
+#include "../impl/inlet/put=dropping+type=trivial/t::ProgressRingIsendDuct.hpp"
+#include "../impl/outlet/get=stepping+type=trivial/t::OffloadRingIrecvDuct.hpp"
+#include "../impl/outlet/get=stepping+type=trivial/t::ProgressRingIrecvDuct.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Ring duct whose requests are owned by a per-thread progress engine, so
+ * all of a thread's ducts are tested by one `MPI_Testsome` per step.
+ *
+ * If `ImplSpec` selects `uit::ThreadProgressPolicy`, a background thread
+ * owns the requests instead and inlets and outlets only touch shared
+ * memory (see `uit::t::OffloadRingIsendDuct`).
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+struct IpriOpriDuct {
+
+  constexpr inline static bool offload{
+    uit::get_progress_policy_t<ImplSpec>::UseProgressThread
+  };
+
+  using InletImpl = std::conditional_t<
+    offload,
+    uit::t::OffloadRingIsendDuct<ImplSpec>,
+    uit::t::ProgressRingIsendDuct<ImplSpec>
+  >;
+  using OutletImpl = std::conditional_t<
+    offload,
+    uit::t::OffloadRingIrecvDuct<ImplSpec>,
+    uit::t::ProgressRingIrecvDuct<ImplSpec>
+  >;
+
+  static_assert(std::is_same<
+    typename InletImpl::BackEndImpl,
+    typename OutletImpl::BackEndImpl
+  >::value);
+
+  using BackEndImpl = typename InletImpl::BackEndImpl;
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_STEPPING_TYPE_TRIVIAL_INLET_PROGRESSRINGISEND_OUTLET_PROGRESSRINGIRECV_T__IPRIOPRIDUCT_HPP_INCLUDE
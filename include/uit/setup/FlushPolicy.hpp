@@ -0,0 +1,104 @@
+#pragma once
+#ifndef UIT_SETUP_FLUSHPOLICY_HPP_INCLUDE
+#define UIT_SETUP_FLUSHPOLICY_HPP_INCLUDE
+
+#include <chrono>
+#include <limits>
+#include <stddef.h>
+#include <type_traits>
+
+namespace uit {
+
+/**
+ * Specifies when buffered and aggregated inlets flush on their own.
+ *
+ * Thresholds are checked after every put; staged data is flushed as soon as
+ * any enabled threshold is met. Explicit calls to `TryFlush` still flush.
+ * Nothing polls in the background: an inlet that stops being put into only
+ * flushes on its next `TryFlush` or, with `FlushAtStepEnd`, at step end.
+ *
+ * @tparam ItemThreshold Flush once this many items are staged.
+ * @tparam ByteThreshold Flush once `sizeof(T)` times the number of staged
+ * items reaches this many bytes.
+ * @tparam MaxLatencyMs Flush on put or `TryFlush` once the oldest staged item
+ * has waited this many milliseconds. Checked against a coarse monotonic
+ * clock, so resolution is a few milliseconds.
+ * @tparam FlushAtStepEnd Register the inlet with the calling thread's
+ * end-of-step hooks (see `uit::try_end_step`) on its first put.
+ */
+template<
+  size_t ItemThreshold_=std::numeric_limits<size_t>::max(),
+  size_t ByteThreshold_=std::numeric_limits<size_t>::max(),
+  size_t MaxLatencyMs_=std::numeric_limits<size_t>::max(),
+  bool FlushAtStepEnd_=false
+>
+struct FlushPolicy {
+
+  constexpr inline static size_t ItemThreshold{ ItemThreshold_ };
+
+  constexpr inline static size_t ByteThreshold{ ByteThreshold_ };
+
+  constexpr inline static size_t MaxLatencyMs{ MaxLatencyMs_ };
+
+  constexpr inline static bool FlushAtStepEnd{ FlushAtStepEnd_ };
+
+  constexpr inline static bool IsTimed{
+    MaxLatencyMs != std::numeric_limits<size_t>::max()
+  };
+
+  /// Is automatic flushing disabled entirely?
+  constexpr inline static bool IsManual{
+    ItemThreshold == std::numeric_limits<size_t>::max()
+    && ByteThreshold == std::numeric_limits<size_t>::max()
+    && !IsTimed
+    && !FlushAtStepEnd
+  };
+
+  static std::chrono::milliseconds GetMaxLatency() {
+    return std::chrono::milliseconds{ MaxLatencyMs };
+  }
+
+};
+
+/// Only flush when `TryFlush` is called (default).
+using ManualFlushPolicy = uit::FlushPolicy<>;
+
+template<size_t Items>
+using ItemFlushPolicy = uit::FlushPolicy<Items>;
+
+template<size_t Bytes>
+using ByteFlushPolicy = uit::FlushPolicy<
+  std::numeric_limits<size_t>::max(), Bytes
+>;
+
+template<size_t Ms>
+using DeadlineFlushPolicy = uit::FlushPolicy<
+  std::numeric_limits<size_t>::max(), std::numeric_limits<size_t>::max(), Ms
+>;
+
+using StepEndFlushPolicy = uit::FlushPolicy<
+  std::numeric_limits<size_t>::max(),
+  std::numeric_limits<size_t>::max(),
+  std::numeric_limits<size_t>::max(),
+  true
+>;
+
+namespace internal {
+
+template<typename Spec, typename=void>
+struct get_flush_policy { using type = uit::ManualFlushPolicy; };
+
+template<typename Spec>
+struct get_flush_policy<Spec, std::void_t<typename Spec::FlushPolicy>> {
+  using type = typename Spec::FlushPolicy;
+};
+
+} // namespace internal
+
+/// Flush policy of Spec, or `ManualFlushPolicy` if it does not specify one.
+template<typename Spec>
+using get_flush_policy_t = typename internal::get_flush_policy<Spec>::type;
+
+} // namespace uit
+
+#endif // #ifndef UIT_SETUP_FLUSHPOLICY_HPP_INCLUDE
@@ -3,7 +3,9 @@
 #define UIT_SETUP_IMPLSPEC_HPP_INCLUDE
 
 #include "defaults.hpp"
+#include "FlushPolicy.hpp"
 #include "ImplSelect.hpp"
+#include "ProgressPolicy.hpp"
 
 namespace uit {
 
@@ -13,12 +15,16 @@ template<
   typename T_,
   typename ImplSelect,
   size_t N_,
-  size_t B_
+  size_t B_,
+  typename FlushPolicy_,
+  typename ProgressPolicy_
 >
 class ImplSpecKernel {
 
   /// TODO.
-  using THIS_T = ImplSpecKernel<T_, ImplSelect, N_, B_>;
+  using THIS_T = ImplSpecKernel<
+    T_, ImplSelect, N_, B_, FlushPolicy_, ProgressPolicy_
+  >;
 
 public:
 
@@ -31,6 +37,12 @@ public:
   /// TODO.
   constexpr inline static size_t B{ B_ };
 
+  /// When buffered or aggregated inlets flush on their own.
+  using FlushPolicy = FlushPolicy_;
+
+  /// Who drives MPI progress for proc ducts that support offloading.
+  using ProgressPolicy = ProgressPolicy_;
+
   /// TODO.
   using IntraDuct = typename ImplSelect::template IntraDuct<THIS_T>;
 
@@ -65,6 +77,11 @@ public:
  * @tparam N Buffer size.
  * @tparam B For buffered or aggregated ducts,
  * maximum number of items to buffer.
+ * @tparam SpoutCacheSize Number of values cached by spout wrappers.
+ * @tparam FlushPolicy For buffered or aggregated ducts, when to flush
+ * without an explicit call to `TryFlush` (see `uit::FlushPolicy`).
+ * @tparam ProgressPolicy For proc ducts that support it, whether a
+ * background thread drives MPI progress (see `uit::ProgressPolicy`).
  *
  */
 template<
@@ -73,12 +90,14 @@ template<
   template<typename> typename SpoutWrapper=uit::DefaultSpoutWrapper,
   size_t N=uit::DEFAULT_BUFFER,
   size_t B=std::numeric_limits<size_t>::max(),
-  size_t SpoutCacheSize_=2
+  size_t SpoutCacheSize_=2,
+  typename FlushPolicy_=uit::ManualFlushPolicy,
+  typename ProgressPolicy_=uit::InlineProgressPolicy
 >
 class ImplSpec
 : public internal::ImplSpecKernel<
   typename SpoutWrapper<T>::T,
-  ImplSelect, N, B
+  ImplSelect, N, B, FlushPolicy_, ProgressPolicy_
 > {
 
   using wrapper_t = SpoutWrapper<T>;
@@ -2,7 +2,9 @@
 #ifndef UIT_SETUP_INTERPROCADDRESS_HPP_INCLUDE
 #define UIT_SETUP_INTERPROCADDRESS_HPP_INCLUDE
 
+#include <memory>
 #include <tuple>
+#include <utility>
 
 #include <mpi.h>
 
@@ -26,6 +28,9 @@ class InterProcAddress {
   int tag;
   MPI_Comm comm;
 
+  // keeps comm from being freed while anything still holds this address
+  std::shared_ptr<const void> comm_owner;
+
 public:
 
   InterProcAddress(
@@ -34,13 +39,15 @@ public:
     const uitsl::thread_id_t outlet_thread_=0,
     const uitsl::thread_id_t inlet_thread_=0,
     const int tag_=0,
-    const MPI_Comm comm_=MPI_COMM_WORLD
+    const MPI_Comm comm_=MPI_COMM_WORLD,
+    std::shared_ptr<const void> comm_owner_=nullptr
   ) : outlet_proc(outlet_proc_)
   , inlet_proc(inlet_proc_)
   , outlet_thread(outlet_thread_)
   , inlet_thread(inlet_thread_)
   , tag(tag_)
   , comm(comm_)
+  , comm_owner(std::move(comm_owner_))
   { ; }
 
   uitsl::proc_id_t GetOutletProc() const { return outlet_proc; }
@@ -0,0 +1,51 @@
+#pragma once
+#ifndef UIT_SETUP_PROGRESSPOLICY_HPP_INCLUDE
+#define UIT_SETUP_PROGRESSPOLICY_HPP_INCLUDE
+
+#include <type_traits>
+
+namespace uit {
+
+/**
+ * Specifies who drives MPI progress for proc ducts that support offloading.
+ *
+ * @tparam UseProgressThread If true, a background thread per process posts
+ * sends and drains completed receives for registered ducts, so inlets and
+ * outlets only touch shared memory. Requires MPI initialized with
+ * `MPI_THREAD_MULTIPLE` (see `uitsl::MpiMultithreadGuard`). If false, ducts
+ * drive progress from their own puts and gets (default).
+ */
+template<bool UseProgressThread_=false>
+struct ProgressPolicy {
+
+  constexpr inline static bool UseProgressThread{ UseProgressThread_ };
+
+};
+
+/// Ducts drive progress from their own calls (default).
+using InlineProgressPolicy = uit::ProgressPolicy<>;
+
+/// A background thread drives progress.
+using ThreadProgressPolicy = uit::ProgressPolicy<true>;
+
+namespace internal {
+
+template<typename Spec, typename=void>
+struct get_progress_policy { using type = uit::InlineProgressPolicy; };
+
+template<typename Spec>
+struct get_progress_policy<Spec, std::void_t<typename Spec::ProgressPolicy>> {
+  using type = typename Spec::ProgressPolicy;
+};
+
+} // namespace internal
+
+/// Progress policy of Spec, or `InlineProgressPolicy` if it does not specify
+/// one.
+template<typename Spec>
+using get_progress_policy_t
+  = typename internal::get_progress_policy<Spec>::type;
+
+} // namespace uit
+
+#endif // #ifndef UIT_SETUP_PROGRESSPOLICY_HPP_INCLUDE
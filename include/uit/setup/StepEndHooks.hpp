@@ -0,0 +1,117 @@
+#pragma once
+#ifndef UIT_SETUP_STEPENDHOOKS_HPP_INCLUDE
+#define UIT_SETUP_STEPENDHOOKS_HPP_INCLUDE
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stddef.h>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+namespace uit {
+
+namespace internal {
+
+/**
+ * Per-thread collection of flush callbacks run by `uit::try_end_step`.
+ *
+ * Inlets register from the thread that puts into them but may be destroyed
+ * from another thread, so access is guarded by a mutex.
+ */
+class StepEndRegistry {
+
+  std::mutex mutex;
+
+  // keyed by registration order so flushes happen in a deterministic order
+  std::map<size_t, std::function<bool()>> hooks;
+
+  size_t next_key{};
+
+public:
+
+  size_t Register(std::function<bool()> hook) {
+    const std::lock_guard guard{ mutex };
+    hooks.emplace( next_key, std::move(hook) );
+    return next_key++;
+  }
+
+  void Deregister(const size_t key) {
+    const std::lock_guard guard{ mutex };
+    [[maybe_unused]] const size_t num_erased = hooks.erase( key );
+    emp_assert( num_erased == 1 );
+  }
+
+  size_t GetSize() {
+    const std::lock_guard guard{ mutex };
+    return hooks.size();
+  }
+
+  /// Run every hook, returning whether all of them succeeded.
+  bool Run() {
+    const std::lock_guard guard{ mutex };
+    bool res{ true };
+    for (auto& [key, hook] : hooks) res &= hook();
+    return res;
+  }
+
+  static std::shared_ptr<StepEndRegistry> GetThreadLocal() {
+    thread_local auto registry = std::make_shared<StepEndRegistry>();
+    return registry;
+  }
+
+};
+
+} // namespace internal
+
+/**
+ * Registration of a flush callback with a thread's end-of-step hooks.
+ *
+ * Deregisters on destruction. Copies start out unarmed, so a copied inlet
+ * re-registers itself on its own first put.
+ */
+class StepEndHook {
+
+  std::shared_ptr<internal::StepEndRegistry> registry;
+
+  size_t key{};
+
+public:
+
+  StepEndHook() = default;
+
+  StepEndHook(const StepEndHook&) : StepEndHook() { ; }
+
+  StepEndHook& operator=(const StepEndHook&) { return *this; }
+
+  ~StepEndHook() { if ( IsArmed() ) registry->Deregister( key ); }
+
+  bool IsArmed() const { return registry != nullptr; }
+
+  /// Register hook with the calling thread's end-of-step hooks.
+  void Arm(std::function<bool()> hook) {
+    emp_assert( !IsArmed() );
+    registry = internal::StepEndRegistry::GetThreadLocal();
+    key = registry->Register( std::move(hook) );
+  }
+
+};
+
+/**
+ * Flush every inlet that has been put into from the calling thread under a
+ * flush policy with `FlushAtStepEnd` set.
+ *
+ * @return true if every flush succeeded.
+ */
+inline bool try_end_step() {
+  return internal::StepEndRegistry::GetThreadLocal()->Run();
+}
+
+/// Block until every end-of-step flush on the calling thread succeeds.
+inline void end_step() { while ( !try_end_step() ); }
+
+} // namespace uit
+
+#endif // #ifndef UIT_SETUP_STEPENDHOOKS_HPP_INCLUDE
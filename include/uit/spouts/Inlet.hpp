@@ -87,7 +87,11 @@ private:
    *
    * @param val
    */
-  bool DoTryPut(const T& val) { return duct->TryPut(val); }
+  bool DoTryPut(const T& val) {
+    const bool res = duct->TryPut(val);
+    successful_put_count += res;
+    return res;
+  }
 
   /**
    * TODO.
@@ -95,7 +99,11 @@ private:
    * @param val
    */
   template<typename P>
-  bool DoTryPut(P&& val) { return duct->TryPut(std::forward<P>(val)); }
+  bool DoTryPut(P&& val) {
+    const bool res = duct->TryPut(std::forward<P>(val));
+    successful_put_count += res;
+    return res;
+  }
 
 public:
 
@@ -0,0 +1,154 @@
+#pragma once
+#ifndef UITSL_DATASTRUCTS_GATHERSPAN_HPP_INCLUDE
+#define UITSL_DATASTRUCTS_GATHERSPAN_HPP_INCLUDE
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <stddef.h>
+#include <type_traits>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+namespace uitsl {
+
+/**
+ * Span whose contents may be a list of borrowed, non-contiguous segments
+ * rather than owned contiguous storage.
+ *
+ * Senders describe a message as segments, e.g., a header and several arrays
+ * in one struct, so a gathering send can transmit them in place without
+ * packing. Receivers fill owned storage through `resize` and `data`, as
+ * with any span type.
+ *
+ * Once segments are added, the span's contents are the concatenation of its
+ * segments and any owned storage is released. Copying or moving a segmented
+ * span gathers its segments into the new span's owned storage, so spans
+ * held by ducts never borrow. Only gathering sends read segments in place.
+ *
+ * @tparam V element type of owned storage.
+ */
+template<typename V>
+class GatherSpan {
+
+  static_assert( std::is_trivially_copyable<V>::value );
+
+public:
+
+  using value_type = V;
+
+  using segment_t = std::pair<const std::byte*, size_t>;
+
+private:
+
+  emp::vector<V> storage;
+
+  // borrowed (pointer, num bytes) pairs
+  emp::vector<segment_t> segments;
+
+  emp::vector<V> Flatten() const {
+    emp::vector<V> res( size() );
+    std::byte* dest = reinterpret_cast<std::byte*>( res.data() );
+    for (size_t i{}; i < GetNumSegments(); ++i) {
+      const auto [ptr, num_bytes] = GetSegment(i);
+      dest = std::copy( ptr, ptr + num_bytes, dest );
+    }
+    return res;
+  }
+
+public:
+
+  GatherSpan() = default;
+
+  GatherSpan(const GatherSpan& other)
+  : storage( other.IsContiguous() ? other.storage : other.Flatten() )
+  { ; }
+
+  GatherSpan(GatherSpan&& other)
+  : storage( other.IsContiguous() ? std::move(other.storage) : other.Flatten() )
+  { ; }
+
+  GatherSpan& operator=(const GatherSpan& other) {
+    if ( this == &other ) return *this;
+    segments.clear();
+    if ( other.IsContiguous() ) storage = other.storage;
+    else storage = other.Flatten();
+    return *this;
+  }
+
+  GatherSpan& operator=(GatherSpan&& other) {
+    if ( this == &other ) return *this;
+    segments.clear();
+    if ( other.IsContiguous() ) storage = std::move(other.storage);
+    else storage = other.Flatten();
+    return *this;
+  }
+
+  explicit GatherSpan(const size_t n) : storage(n) { ; }
+
+  GatherSpan(std::initializer_list<V> init) : storage(init) { ; }
+
+  /**
+   * Append count elements starting at ptr to contents, without copying them.
+   */
+  template<typename U>
+  void AddSegment(const U* ptr, const size_t count) {
+    static_assert( std::is_trivially_copyable<U>::value );
+    if ( segments.empty() ) storage.clear();
+    segments.emplace_back(
+      reinterpret_cast<const std::byte*>( ptr ), count * sizeof(U)
+    );
+  }
+
+  bool IsContiguous() const { return segments.empty(); }
+
+  /// Number of segments, counting owned storage as a single segment.
+  size_t GetNumSegments() const {
+    return IsContiguous() ? 1 : segments.size();
+  }
+
+  /// Get (pointer, num bytes) of segment idx.
+  segment_t GetSegment(const size_t idx) const {
+    emp_assert( idx < GetNumSegments(), idx, GetNumSegments() );
+    return IsContiguous() ? segment_t{
+      reinterpret_cast<const std::byte*>( storage.data() ),
+      storage.size() * sizeof(V)
+    } : segments[idx];
+  }
+
+  size_t GetNumBytes() const {
+    size_t res{};
+    for (size_t i{}; i < GetNumSegments(); ++i) res += GetSegment(i).second;
+    return res;
+  }
+
+  /// Number of elements in contents.
+  size_t size() const {
+    emp_assert( GetNumBytes() % sizeof(V) == 0 );
+    return GetNumBytes() / sizeof(V);
+  }
+
+  /// Resize owned storage, dropping any segments.
+  void resize(const size_t n) { segments.clear(); storage.resize(n); }
+
+  V* data() { emp_assert( IsContiguous() ); return storage.data(); }
+
+  const V* data() const { emp_assert( IsContiguous() ); return storage.data(); }
+
+  bool operator==(const GatherSpan& other) const {
+    return Flatten() == other.Flatten();
+  }
+
+  bool operator!=(const GatherSpan& other) const { return !operator==(other); }
+
+  bool operator<(const GatherSpan& other) const {
+    return Flatten() < other.Flatten();
+  }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_DATASTRUCTS_GATHERSPAN_HPP_INCLUDE
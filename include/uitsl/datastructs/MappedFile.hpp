@@ -0,0 +1,86 @@
+#pragma once
+#ifndef UITSL_DATASTRUCTS_MAPPEDFILE_HPP_INCLUDE
+#define UITSL_DATASTRUCTS_MAPPEDFILE_HPP_INCLUDE
+
+#include <cstddef>
+#include <fcntl.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../third-party/Empirical/include/emp/polyfill/span.hpp"
+
+#include "../debug/err_audit.hpp"
+
+namespace uitsl {
+
+/**
+ * Read-only memory mapping of a whole file, unmapped on destruction.
+ *
+ * Pages are faulted in on first touch, so nothing is read up front and procs
+ * on the same node share one copy through the page cache.
+ */
+class MappedFile {
+
+  const std::byte* data{};
+  size_t size{};
+
+public:
+
+  explicit MappedFile(const std::string& filename) {
+
+    const int fd = open( filename.c_str(), O_RDONLY );
+    emp_always_assert( fd >= 0, filename );
+
+    struct stat info;
+    uitsl_err_audit( fstat( fd, &info ) );
+    size = info.st_size;
+
+    // zero-length mappings are invalid
+    if ( size ) {
+      void* const res = mmap(
+        nullptr, // void *addr
+        size, // size_t length
+        PROT_READ, // int prot
+        MAP_PRIVATE, // int flags
+        fd, // int fd
+        0 // off_t offset
+      );
+      emp_always_assert( res != MAP_FAILED, filename );
+      data = reinterpret_cast<const std::byte*>( res );
+    }
+
+    // mapping stays valid after the descriptor is closed
+    uitsl_err_audit( close( fd ) );
+
+  }
+
+  ~MappedFile() {
+    if ( data ) uitsl_err_audit(munmap(
+      const_cast<std::byte*>( data ), // void *addr
+      size // size_t length
+    ));
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  MappedFile(MappedFile&& other) noexcept
+  : data( std::exchange(other.data, nullptr) )
+  , size( std::exchange(other.size, 0) )
+  { ; }
+
+  const std::byte* GetData() const { return data; }
+
+  size_t GetSize() const { return size; }
+
+  std::span<const std::byte> GetSpan() const { return { data, size }; }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_DATASTRUCTS_MAPPEDFILE_HPP_INCLUDE
@@ -0,0 +1,106 @@
+#pragma once
+#ifndef UITSL_DATASTRUCTS_SPSCRINGBUFFER_HPP_INCLUDE
+#define UITSL_DATASTRUCTS_SPSCRINGBUFFER_HPP_INCLUDE
+
+#include <atomic>
+#include <stddef.h>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/base/array.hpp"
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+#include "../parallel/cache_line.hpp"
+
+namespace uitsl {
+
+/**
+ * Bounded lock-free queue between one producer thread and one consumer
+ * thread.
+ *
+ * The producer calls `TryPush`. The consumer calls `Get`, `GetFront`, `Pop`,
+ * and `IsEmpty`. Items stay in place until popped, so the consumer may work
+ * on several of them, e.g., send straight out of the buffer. `GetSize` may
+ * be called from either side, but is only exact on the consumer side.
+ *
+ * @tparam T item type.
+ * @tparam N capacity.
+ */
+template<typename T, size_t N>
+class SpscRingBuffer {
+
+  // one spare slot tells full from empty
+  constexpr inline static size_t num_slots{ N + 1 };
+
+  emp::array<T, num_slots> buffer{};
+
+  // next slot to write, only advanced by the producer
+  alignas(uitsl::CACHE_LINE_SIZE) std::atomic<size_t> head{};
+
+  // next slot to read, only advanced by the consumer
+  alignas(uitsl::CACHE_LINE_SIZE) std::atomic<size_t> tail{};
+
+  static size_t Next(const size_t idx) { return (idx + 1) % num_slots; }
+
+public:
+
+  /**
+   * Copy val onto the back of the queue, unless full.
+   *
+   * @return true if val was pushed.
+   */
+  template<typename P>
+  bool TryPush(P&& val) {
+    const size_t cur_head = head.load( std::memory_order_relaxed );
+    const size_t next_head = Next( cur_head );
+    if ( next_head == tail.load( std::memory_order_acquire ) ) return false;
+
+    buffer[cur_head] = std::forward<P>(val);
+    head.store( next_head, std::memory_order_release );
+    return true;
+  }
+
+  bool IsEmpty() const {
+    return tail.load( std::memory_order_relaxed )
+      == head.load( std::memory_order_acquire );
+  }
+
+  /// Item idx places behind the front, which must exist.
+  T& Get(const size_t idx) {
+    emp_assert( idx < GetSize() );
+    return buffer[ (tail.load( std::memory_order_relaxed ) + idx) % num_slots ];
+  }
+
+  /// Item idx places behind the front, which must exist.
+  const T& Get(const size_t idx) const {
+    emp_assert( idx < GetSize() );
+    return buffer[ (tail.load( std::memory_order_relaxed ) + idx) % num_slots ];
+  }
+
+  /// Front item, which must exist.
+  T& GetFront() { return Get(0); }
+
+  /// Front item, which must exist.
+  const T& GetFront() const { return Get(0); }
+
+  /// Remove the front item, which must exist.
+  void Pop() {
+    emp_assert( !IsEmpty() );
+    tail.store(
+      Next( tail.load( std::memory_order_relaxed ) ),
+      std::memory_order_release
+    );
+  }
+
+  size_t GetSize() const {
+    const size_t cur_tail = tail.load( std::memory_order_acquire );
+    const size_t cur_head = head.load( std::memory_order_acquire );
+    return (cur_head + num_slots - cur_tail) % num_slots;
+  }
+
+  constexpr size_t GetCapacity() const { return N; }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_DATASTRUCTS_SPSCRINGBUFFER_HPP_INCLUDE
@@ -0,0 +1,304 @@
+#pragma once
+#ifndef UITSL_DISTRIBUTED_LOCKALLWINDOWMANAGER_HPP_INCLUDE
+#define UITSL_DISTRIBUTED_LOCKALLWINDOWMANAGER_HPP_INCLUDE
+
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <numeric>
+#include <stddef.h>
+
+#include <mpi.h>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../math/divide_utils.hpp"
+#include "../mpi/audited_routines.hpp"
+#include "../mpi/comm_utils.hpp"
+#include "../mpi/group_utils.hpp"
+#include "../mpi/mpi_types.hpp"
+#include "../parallel/cache_line.hpp"
+#include "../mpi/proc_id_t.hpp"
+
+namespace uitsl {
+
+/**
+ * Single RDMA window spanning a whole communicator, held in one long-lived
+ * passive-target epoch.
+ *
+ * Unlike `uitsl::RdmaWindowManager`, which creates a window (and
+ * communicator) per peer and locks around every operation, setup is one
+ * collective `MPI_Win_allocate` and one `MPI_Win_lock_all`. Operations are
+ * issued within that epoch, and each is completed by a `Flush` of its target
+ * rank rather than by closing the epoch.
+ *
+ * Each proc acquires slots in its own portion of the window during setup.
+ * Peers write into those slots with `Put` using the returned offset.
+ *
+ * Only procs that call `Acquire` or `Activate` before `Initialize` join the
+ * window. Procs with no RDMA ducts then never block in the collective
+ * `MPI_Win_free`, whenever their back end happens to be destroyed.
+ */
+class LockAllWindowManager {
+
+  std::mutex mutex;
+
+  bool active{};
+
+  emp::vector<std::byte> initialization_bytes;
+
+  MPI_Comm window_comm{ MPI_COMM_NULL };
+
+  // rank in comm passed to Initialize -> rank in window_comm
+  emp::vector<int> window_ranks;
+
+  std::byte *buffer{};
+
+  MPI_Win window{ MPI_WIN_NULL };
+
+  bool unified{};
+
+public:
+
+  ~LockAllWindowManager() {
+    if ( IsInitialized() ) {
+      UITSL_Win_unlock_all( window );
+      // all procs must make this call
+      UITSL_Win_free( &window );
+    }
+    if ( window_comm != MPI_COMM_NULL ) UITSL_Comm_free( &window_comm );
+  }
+
+  bool IsInitialized() const { return window != MPI_WIN_NULL; }
+
+  /// Join the window without reserving a slot, to put into peers' slots.
+  void Activate() {
+    const std::lock_guard guard{ mutex };
+    emp_assert( !IsInitialized() );
+    active = true;
+  }
+
+  /**
+   * Reserve a slot in this proc's portion of the window.
+   *
+   * @param alignment byte alignment of slot, e.g., a cache line to keep a
+   * frequently polled slot apart from its neighbors.
+   * @return byte offset of slot, to be sent to peers that will write to it.
+   */
+  size_t Acquire(
+    const emp::vector<std::byte>& initial_bytes,
+    const size_t alignment=alignof(std::max_align_t)
+  ) {
+    const std::lock_guard guard{ mutex };
+    emp_assert( !IsInitialized() );
+    active = true;
+
+    // offsets are relative to the window base, which MPI_Win_allocate in
+    // practice aligns to at least a cache line
+    emp_assert( alignment <= uitsl::CACHE_LINE_SIZE );
+    const size_t address = uitsl::div_ceil(
+      initialization_bytes.size(), alignment
+    ) * alignment;
+    initialization_bytes.resize( address );
+    initialization_bytes.insert(
+      std::end(initialization_bytes),
+      std::begin(initial_bytes),
+      std::end(initial_bytes)
+    );
+    return address;
+  }
+
+  /// Allocate window and open epoch. Collective over comm.
+  void Initialize(const MPI_Comm comm=MPI_COMM_WORLD) {
+    const std::lock_guard guard{ mutex };
+    emp_assert( !IsInitialized() );
+
+    UITSL_Comm_split(
+      comm, // MPI_Comm comm
+      active ? 0 : MPI_UNDEFINED, // int color
+      0, // int key
+      &window_comm // MPI_Comm *newcomm
+    );
+    if ( !active ) return;
+
+    emp::vector<int> base_ranks( uitsl::get_nprocs( comm ) );
+    std::iota( std::begin(base_ranks), std::end(base_ranks), 0 );
+    window_ranks.resize( base_ranks.size() );
+    MPI_Group base_group = uitsl::comm_to_group( comm );
+    MPI_Group window_group = uitsl::comm_to_group( window_comm );
+    UITSL_Group_translate_ranks(
+      base_group, // MPI_Group group1
+      base_ranks.size(), // int n
+      base_ranks.data(), // const int ranks1[]
+      window_group, // MPI_Group group2
+      window_ranks.data() // int ranks2[]
+    );
+    UITSL_Group_free( &base_group );
+    UITSL_Group_free( &window_group );
+
+    UITSL_Win_allocate(
+      initialization_bytes.size(), // MPI_Aint size
+      1, // int disp_unit
+      MPI_INFO_NULL, // MPI_Info info
+      window_comm, // MPI_Comm comm
+      &buffer, // void *baseptr
+      &window // MPI_Win *win
+    );
+
+    std::memcpy(
+      buffer,
+      initialization_bytes.data(),
+      initialization_bytes.size()
+    );
+
+    int *model;
+    int flag;
+    UITSL_Win_get_attr(
+      window, // MPI_Win win
+      MPI_WIN_MODEL, // int win_keyval
+      &model, // void *attribute_val
+      &flag // int *flag
+    );
+    unified = flag && *model == MPI_WIN_UNIFIED;
+
+    UITSL_Win_lock_all(
+      MPI_MODE_NOCHECK, // int assert: no conflicting locks are ever taken
+      window // MPI_Win win
+    );
+
+    // ensure that initial bytes are in place before any peer puts
+    UITSL_Barrier( window_comm );
+
+    emp_assert( IsInitialized() );
+  }
+
+  /// Get this proc's slot, after calling `Sync` to see completed puts.
+  std::byte *GetBytes(const size_t byte_offset) {
+    emp_assert( IsInitialized() );
+    return std::next( buffer, byte_offset );
+  }
+
+  /// Whether public and private copies of the window are the same memory,
+  /// so local stores become visible to peers without `Sync`.
+  bool IsUnified() const {
+    emp_assert( IsInitialized() );
+    return unified;
+  }
+
+  /// Synchronize public and private copies of this proc's portion of window.
+  void Sync() {
+    emp_assert( IsInitialized() );
+    UITSL_Win_sync( window );
+  }
+
+  /// Rank is in the comm passed to `Initialize`. Origin buffer must not be
+  /// modified until the next `Flush(rank)`.
+  void Put(
+    const proc_id_t rank,
+    const std::byte *origin_addr,
+    const size_t num_bytes,
+    const MPI_Aint target_disp
+  ) {
+    emp_assert( IsInitialized() );
+    UITSL_Put(
+      origin_addr, // const void *origin_addr
+      num_bytes, // int origin_count
+      MPI_BYTE, // MPI_Datatype origin_datatype
+      window_ranks[rank], // int target_rank
+      target_disp, // MPI_Aint target_disp
+      num_bytes, // int target_count
+      MPI_BYTE, // MPI_Datatype target_datatype
+      window // MPI_Win win
+    );
+  }
+
+  /// Fetch bytes from rank's portion of the window into origin_addr, which
+  /// is only valid once request completes.
+  void Rget(
+    const proc_id_t rank,
+    std::byte *origin_addr,
+    const size_t num_bytes,
+    const MPI_Aint target_disp,
+    MPI_Request *request
+  ) {
+    emp_assert( IsInitialized() );
+    UITSL_Rget(
+      origin_addr, // void *origin_addr
+      num_bytes, // int origin_count
+      MPI_BYTE, // MPI_Datatype origin_datatype
+      window_ranks[rank], // int target_rank
+      target_disp, // MPI_Aint target_disp
+      num_bytes, // int target_count
+      MPI_BYTE, // MPI_Datatype target_datatype
+      window, // MPI_Win win
+      request // MPI_Request *request
+    );
+  }
+
+  /// Element-wise atomic with respect to other accumulates on the same
+  /// bytes. Origin buffer must not be modified until the next
+  /// `Flush(rank)`.
+  template<typename T>
+  void Accumulate(
+    const proc_id_t rank,
+    const T *origin_addr,
+    const size_t count,
+    const MPI_Aint target_disp,
+    const MPI_Op op
+  ) {
+    emp_assert( IsInitialized() );
+    UITSL_Accumulate(
+      origin_addr, // const void *origin_addr
+      count, // int origin_count
+      uitsl::datatype_from_type<T>(), // MPI_Datatype origin_datatype
+      window_ranks[rank], // int target_rank
+      target_disp, // MPI_Aint target_disp
+      count, // int target_count
+      uitsl::datatype_from_type<T>(), // MPI_Datatype target_datatype
+      op, // MPI_Op op
+      window // MPI_Win win
+    );
+  }
+
+  /// Atomically fetch target contents into result_addr and combine origin
+  /// into them. Result is only valid after the next `Flush(rank)`.
+  template<typename T>
+  void GetAccumulate(
+    const proc_id_t rank,
+    const T *origin_addr,
+    T *result_addr,
+    const size_t count,
+    const MPI_Aint target_disp,
+    const MPI_Op op
+  ) {
+    emp_assert( IsInitialized() );
+    UITSL_Get_accumulate(
+      origin_addr, // const void *origin_addr
+      count, // int origin_count
+      uitsl::datatype_from_type<T>(), // MPI_Datatype origin_datatype
+      result_addr, // void *result_addr
+      count, // int result_count
+      uitsl::datatype_from_type<T>(), // MPI_Datatype result_datatype
+      window_ranks[rank], // int target_rank
+      target_disp, // MPI_Aint target_disp
+      count, // int target_count
+      uitsl::datatype_from_type<T>(), // MPI_Datatype target_datatype
+      op, // MPI_Op op
+      window // MPI_Win win
+    );
+  }
+
+  /// Complete, at origin and at target, every outstanding operation on rank.
+  void Flush(const proc_id_t rank) {
+    emp_assert( IsInitialized() );
+    UITSL_Win_flush( window_ranks[rank], window );
+  }
+
+  size_t GetSize() const { return initialization_bytes.size(); }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_DISTRIBUTED_LOCKALLWINDOWMANAGER_HPP_INCLUDE
@@ -0,0 +1,73 @@
+#pragma once
+#ifndef UITSL_DISTRIBUTED_MSGCHUNKLAYOUT_HPP_INCLUDE
+#define UITSL_DISTRIBUTED_MSGCHUNKLAYOUT_HPP_INCLUDE
+
+#include <algorithm>
+#include <stddef.h>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+#include "../math/divide_utils.hpp"
+
+namespace uitsl {
+
+/**
+ * Splits a message of num_bytes bytes into fixed-size chunks, for sending
+ * and receiving a large message piecewise in place.
+ *
+ * Chunks hold a whole number of T items, so each chunk's items can be used
+ * as soon as that chunk lands. Only the final chunk may be short.
+ *
+ * @tparam T item type.
+ */
+template<typename T>
+class MsgChunkLayout {
+
+  size_t num_bytes;
+
+  size_t chunk_bytes;
+
+public:
+
+  MsgChunkLayout(const size_t num_bytes_, const size_t target_chunk_bytes)
+  : num_bytes( num_bytes_ )
+  , chunk_bytes(
+    uitsl::div_ceil( std::max( target_chunk_bytes, size_t{1} ), sizeof(T) )
+    * sizeof(T)
+  ) { ; }
+
+  /// At least one chunk, even for an empty message.
+  size_t GetNumChunks() const {
+    return std::max( uitsl::div_ceil( num_bytes, chunk_bytes ), size_t{1} );
+  }
+
+  size_t GetChunkBytes() const { return chunk_bytes; }
+
+  size_t GetChunkItems() const { return chunk_bytes / sizeof(T); }
+
+  /// Byte offset of chunk idx within the message.
+  size_t GetByteBegin(const size_t idx) const {
+    emp_assert( idx < GetNumChunks(), idx, GetNumChunks() );
+    return std::min( idx * chunk_bytes, num_bytes );
+  }
+
+  /// Number of bytes in chunk idx.
+  size_t GetByteSize(const size_t idx) const {
+    return std::min( chunk_bytes, num_bytes - GetByteBegin(idx) );
+  }
+
+  /// Index of first item in chunk idx, clamped to num_items.
+  size_t GetItemBegin(const size_t idx, const size_t num_items) const {
+    return std::min( idx * GetChunkItems(), num_items );
+  }
+
+  /// Index one past the last whole item in chunk idx, clamped to num_items.
+  size_t GetItemEnd(const size_t idx, const size_t num_items) const {
+    return std::min( (idx + 1) * GetChunkItems(), num_items );
+  }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_DISTRIBUTED_MSGCHUNKLAYOUT_HPP_INCLUDE
@@ -0,0 +1,39 @@
+#pragma once
+#ifndef UITSL_DISTRIBUTED_RDMANOTIFIEDPACKET_HPP_INCLUDE
+#define UITSL_DISTRIBUTED_RDMANOTIFIEDPACKET_HPP_INCLUDE
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../parallel/cache_line.hpp"
+
+namespace uitsl {
+
+/**
+ * Window slot layout for RDMA ducts that signal new data through a counter.
+ *
+ * The counter gets its own cache line, so a consumer polling it does not
+ * touch, or contend with writes to, the payload.
+ */
+template<typename Payload>
+struct RdmaNotifiedPacket {
+
+  static_assert(std::is_trivially_copyable<Payload>::value);
+
+  alignas(uitsl::CACHE_LINE_SIZE) size_t counter{};
+
+  alignas(uitsl::CACHE_LINE_SIZE) Payload payload{};
+
+  static constexpr size_t GetCounterOffset() {
+    return offsetof(RdmaNotifiedPacket, counter);
+  }
+
+  static constexpr size_t GetPayloadOffset() {
+    return offsetof(RdmaNotifiedPacket, payload);
+  }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_DISTRIBUTED_RDMANOTIFIEDPACKET_HPP_INCLUDE
@@ -0,0 +1,75 @@
+#pragma once
+#ifndef UITSL_DISTRIBUTED_RDMAVERSIONEDPACKET_HPP_INCLUDE
+#define UITSL_DISTRIBUTED_RDMAVERSIONEDPACKET_HPP_INCLUDE
+
+#include <atomic>
+#include <stddef.h>
+#include <type_traits>
+
+namespace uitsl {
+
+/**
+ * Window slot layout for RDMA ducts whose consumer fetches a slot that its
+ * owner may be rewriting at the same time.
+ *
+ * The owner stamps the epoch before and after writing data. A fetched copy
+ * whose stamps disagree overlapped a write and should be discarded.
+ *
+ * Platform requirement: RDMA transfers must copy lower addresses first, so
+ * the trailing stamp (written last) is read before data and the leading
+ * stamp (written first) after it. MPI does not guarantee any order within a
+ * transfer. Where the requirement does not hold, a torn copy can pass as
+ * consistent, so ducts built on this layout are only safe on such platforms
+ * (e.g., shared memory and RDMA NICs that DMA sequentially).
+ */
+template<typename T>
+class RdmaVersionedPacket {
+
+  static_assert(std::is_trivially_copyable<T>::value);
+
+  // written last, read first
+  size_t tail_epoch{};
+
+  T data{};
+
+  // written first, read last
+  size_t head_epoch{};
+
+public:
+
+  /// Overwrite dest in place, e.g., in the owner's portion of a window.
+  static void Write(
+    RdmaVersionedPacket* dest, const T& data, const size_t epoch
+  ) {
+    dest->head_epoch = epoch;
+    std::atomic_thread_fence( std::memory_order_release );
+    dest->data = data;
+    std::atomic_thread_fence( std::memory_order_release );
+    dest->tail_epoch = epoch;
+  }
+
+  /// Copy src in place, e.g., out of the owner's portion of a window,
+  /// reading stamps in the opposite order `Write` writes them.
+  static RdmaVersionedPacket Read(const RdmaVersionedPacket* src) {
+    RdmaVersionedPacket res;
+    res.tail_epoch = src->tail_epoch;
+    std::atomic_thread_fence( std::memory_order_acquire );
+    res.data = src->data;
+    std::atomic_thread_fence( std::memory_order_acquire );
+    res.head_epoch = src->head_epoch;
+    return res;
+  }
+
+  bool IsConsistent() const { return head_epoch == tail_epoch; }
+
+  const T& GetData() const { return data; }
+
+  T& GetData() { return data; }
+
+  size_t GetEpoch() const { return head_epoch; }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_DISTRIBUTED_RDMAVERSIONEDPACKET_HPP_INCLUDE
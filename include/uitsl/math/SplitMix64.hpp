@@ -0,0 +1,59 @@
+#pragma once
+#ifndef UITSL_MATH_SPLITMIX64_HPP_INCLUDE
+#define UITSL_MATH_SPLITMIX64_HPP_INCLUDE
+
+#include <stdint.h>
+
+namespace uitsl {
+
+/**
+ * Small, fast pseudorandom generator whose streams can be keyed by a seed and
+ * any number of counters, such as node IDs.
+ *
+ * Keying a stream by what it is for, instead of drawing from one shared
+ * generator, gives the same numbers no matter how work is split between
+ * threads.
+ */
+class SplitMix64 {
+
+  uint64_t state;
+
+public:
+
+  /// Hash a single word, the finalizer of the generator.
+  static constexpr uint64_t Mix(uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+  }
+
+  template<typename... Keys>
+  explicit constexpr SplitMix64(const uint64_t seed, const Keys... keys)
+  : state( seed ) {
+    ((state = Mix( state + 0x9e3779b97f4a7c15ull ) ^ keys), ...);
+  }
+
+  constexpr uint64_t operator()() {
+    state += 0x9e3779b97f4a7c15ull;
+    return Mix( state );
+  }
+
+  /// Uniform in [0, 1).
+  constexpr double GetDouble() {
+    return ( operator()() >> 11 ) * 0x1.0p-53;
+  }
+
+  /// Uniform in [0, bound), bound must be positive.
+  constexpr uint64_t GetUInt(const uint64_t bound) {
+    // reject the low draws that would bias the modulo
+    const uint64_t threshold = -bound % bound;
+    uint64_t draw = operator()();
+    while ( draw < threshold ) draw = operator()();
+    return draw % bound;
+  }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_MATH_SPLITMIX64_HPP_INCLUDE
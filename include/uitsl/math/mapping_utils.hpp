@@ -2,8 +2,12 @@
 #ifndef UITSL_MATH_MAPPING_UTILS_HPP_INCLUDE
 #define UITSL_MATH_MAPPING_UTILS_HPP_INCLUDE
 
+#include <algorithm>
 #include <cmath>
+#include <iterator>
+#include <stddef.h>
 
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
 #include "../../../third-party/Empirical/include/emp/base/vector.hpp"
 
 namespace uitsl {
@@ -44,7 +48,80 @@ inline Point linear_decode(size_t r, const Dims& dims) {
     return decoded;
 }
 
-// TODO: add a Hilbert curve variant
+/**
+ * This function interleaves the bits of a point's coordinates, taking one
+ * bit from each dimension in turn from most significant to least
+ * The first dimension supplies the least significant bit of each group,
+ * as it varies fastest in linear_encode
+ * @param p point to interleave
+ * @param bits number of bits per coordinate
+ * @return interleaved bits
+*/
+inline size_t interleave_bits(const Point& p, const size_t bits) {
+    size_t interleaved = 0;
+    for (size_t b = bits; b--; ) {
+        for (size_t i = p.size(); i--; ) {
+            interleaved = (interleaved << 1) | ((p[i] >> b) & 1);
+        }
+    }
+    return interleaved;
+}
+
+/**
+ * This function maps a point in a 2^bits wide N-dimensional cube to its
+ * position along a Morton (Z-order) curve through the cube
+ * @param p point to map
+ * @param bits number of bits per coordinate
+ * @return position along curve
+*/
+inline size_t morton_encode(const Point& p, const size_t bits) {
+    emp_assert(p.size() * bits <= 64, p.size(), bits);
+    return interleave_bits(p, bits);
+}
+
+/**
+ * This function maps a point in a 2^bits wide N-dimensional cube to its
+ * position along a Hilbert curve through the cube, so that consecutive
+ * positions are always neighboring points
+ * Uses Skilling's transform, "Programming the Hilbert curve" (2004)
+ * @param p point to map
+ * @param bits number of bits per coordinate
+ * @return position along curve
+*/
+inline size_t hilbert_encode(const Point& point, const size_t bits) {
+    emp_assert(point.size() * bits <= 64, point.size(), bits);
+    if (bits == 0 || point.empty()) return 0;
+
+    Point p(point);
+
+    const size_t n = p.size();
+    const size_t m = size_t{1} << (bits - 1);
+
+    // undo excess work
+    for (size_t q = m; q > 1; q >>= 1) {
+        const size_t mask = q - 1;
+        for (size_t i = 0; i < n; ++i) {
+            if (p[i] & q) p[0] ^= mask;
+            else {
+                const size_t t = (p[0] ^ p[i]) & mask;
+                p[0] ^= t;
+                p[i] ^= t;
+            }
+        }
+    }
+
+    // gray encode
+    for (size_t i = 1; i < n; ++i) p[i] ^= p[i - 1];
+    size_t t = 0;
+    for (size_t q = m; q > 1; q >>= 1) {
+        if (p[n - 1] & q) t ^= q - 1;
+    }
+    for (size_t i = 0; i < n; ++i) p[i] ^= t;
+
+    // Skilling's transpose lists the most significant bit first in p[0]
+    std::reverse(std::begin(p), std::end(p));
+    return interleave_bits(p, bits);
+}
 
 } // namespace uitsl
 
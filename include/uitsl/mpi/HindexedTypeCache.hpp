@@ -0,0 +1,100 @@
+#pragma once
+#ifndef UITSL_MPI_HINDEXEDTYPECACHE_HPP_INCLUDE
+#define UITSL_MPI_HINDEXEDTYPECACHE_HPP_INCLUDE
+
+#include <map>
+#include <stddef.h>
+#include <utility>
+
+#include <mpi.h>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../debug/safe_cast.hpp"
+
+#include "audited_routines.hpp"
+
+namespace uitsl {
+
+/**
+ * Committed `MPI_Type_create_hindexed` byte datatypes, keyed by shape.
+ *
+ * A shape lists (displacement, num bytes) blocks, with displacements
+ * relative to the buffer address passed to the send. Senders that gather
+ * the same fields of the same structs each time see the same shape, so
+ * datatypes are built and committed once rather than per message.
+ *
+ * When full, the cache frees every datatype. Freeing is safe while sends
+ * using a datatype are pending.
+ */
+class HindexedTypeCache {
+
+public:
+
+  using shape_t = emp::vector<std::pair<MPI_Aint, int>>;
+
+private:
+
+  std::map<shape_t, MPI_Datatype> cache;
+
+  size_t capacity;
+
+  static MPI_Datatype MakeDatatype(const shape_t& shape) {
+    emp::vector<int> block_lengths;
+    emp::vector<MPI_Aint> displacements;
+    for (const auto& [displacement, num_bytes] : shape) {
+      displacements.push_back( displacement );
+      block_lengths.push_back( num_bytes );
+    }
+
+    MPI_Datatype res;
+    UITSL_Type_create_hindexed(
+      uitsl::safe_cast<int>( shape.size() ), // int count
+      block_lengths.data(), // const int array_of_blocklengths[]
+      displacements.data(), // const MPI_Aint array_of_displacements[]
+      MPI_BYTE, // MPI_Datatype oldtype
+      &res // MPI_Datatype *newtype
+    );
+    UITSL_Type_commit( &res );
+    return res;
+  }
+
+public:
+
+  explicit HindexedTypeCache(const size_t capacity_=64)
+  : capacity(capacity_)
+  { emp_assert( capacity ); }
+
+  ~HindexedTypeCache() { Clear(); }
+
+  // datatypes are freed on destruction
+  HindexedTypeCache(const HindexedTypeCache&) = delete;
+
+  HindexedTypeCache& operator=(const HindexedTypeCache&) = delete;
+
+  /**
+   * Get the committed datatype for shape, building it if not cached.
+   */
+  MPI_Datatype Lookup(const shape_t& shape) {
+    if (const auto it = cache.find( shape ); it != std::end( cache )) {
+      return it->second;
+    }
+
+    if ( cache.size() == capacity ) Clear();
+
+    return cache.emplace( shape, MakeDatatype( shape ) ).first->second;
+  }
+
+  size_t GetSize() const { return cache.size(); }
+
+  void Clear() {
+    for (auto& [shape, datatype] : cache) UITSL_Type_free( &datatype );
+    cache.clear();
+  }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_MPI_HINDEXEDTYPECACHE_HPP_INCLUDE
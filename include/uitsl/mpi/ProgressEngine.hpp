@@ -0,0 +1,210 @@
+#pragma once
+#ifndef UITSL_MPI_PROGRESSENGINE_HPP_INCLUDE
+#define UITSL_MPI_PROGRESSENGINE_HPP_INCLUDE
+
+#include <algorithm>
+#include <functional>
+#include <stddef.h>
+#include <utility>
+
+#include <mpi.h>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../debug/safe_cast.hpp"
+
+#include "audited_routines.hpp"
+#include "request_utils.hpp"
+
+namespace uitsl {
+
+/**
+ * Owns the outstanding requests of every duct served by one thread in a
+ * single contiguous array, so one `MPI_Testsome` call per poll tests them
+ * all.
+ *
+ * Each tracked request carries a completion callback, which runs once its
+ * request completes, after the array has been compacted. Ducts visited in
+ * turn call `PollIfStale`, so a round of visits over many ducts costs one
+ * `MPI_Testsome` instead of one test per duct.
+ *
+ * Not thread safe. Every duct sharing an engine must be used from the same
+ * thread.
+ */
+class ProgressEngine {
+
+public:
+
+  using callback_t = std::function<void()>;
+
+private:
+
+  emp::vector<MPI_Request> requests;
+
+  // parallel to requests
+  emp::vector<const void*> owners;
+  emp::vector<callback_t> callbacks;
+
+  // scratch space reused between polls
+  emp::vector<int> out_indices;
+  emp::vector<callback_t> completed;
+
+  size_t poll_count{};
+
+  // completions found by the last poll, a sign of traffic in flight
+  size_t last_num_completed{};
+
+  // rotates through requests tested one at a time between polls
+  size_t cursor{};
+
+  void Erase(const size_t idx) {
+    emp_assert( idx < requests.size() );
+    std::swap( requests[idx], requests.back() );
+    std::swap( owners[idx], owners.back() );
+    std::swap( callbacks[idx], callbacks.back() );
+    requests.pop_back();
+    owners.pop_back();
+    callbacks.pop_back();
+  }
+
+  // one MPI_Testsome over every tracked request, then dispatch completions
+  size_t TestAll() {
+
+    // MPICH Testsome returns negative outcount for zero count calls
+    // so let's boogie out early to avoid drama
+    if ( requests.empty() ) return 0;
+
+    out_indices.resize( requests.size() );
+    int num_completed;
+    UITSL_Testsome(
+      uitsl::safe_cast<int>( requests.size() ), // int count
+      requests.data(), // MPI_Request array_of_requests[]
+      &num_completed, // int *outcount
+      out_indices.data(), // int *indices
+      MPI_STATUSES_IGNORE // MPI_Status array_of_statuses[]
+    );
+    emp_assert( num_completed != MPI_UNDEFINED );
+    emp_assert( uitsl::safe_cast<size_t>(num_completed) <= requests.size() );
+
+    // erase back to front so swapped-in entries have already been visited
+    std::sort(
+      std::begin( out_indices ),
+      std::next( std::begin( out_indices ), num_completed ),
+      std::greater<int>{}
+    );
+
+    emp_assert( completed.empty() );
+    for (int i{}; i < num_completed; ++i) {
+      const size_t idx = out_indices[i];
+      emp_assert( uitsl::test_null( requests[idx] ) );
+      completed.push_back( std::move( callbacks[idx] ) );
+      Erase( idx );
+    }
+
+    // callbacks may track new requests
+    for (auto& callback : completed) callback();
+    completed.clear();
+
+    return num_completed;
+
+  }
+
+public:
+
+  /**
+   * Take over request, which must be active, and call callback once it
+   * completes.
+   *
+   * @param request handle to take over, set to `MPI_REQUEST_NULL`.
+   * @param owner tag for cancelling all of a duct's requests together.
+   * @param callback run on completion, from within `Poll`.
+   */
+  void Track(
+    MPI_Request& request, const void* owner, callback_t callback
+  ) {
+    emp_assert( !uitsl::test_null( request ) );
+    requests.push_back( std::exchange( request, MPI_REQUEST_NULL ) );
+    owners.push_back( owner );
+    callbacks.push_back( std::move(callback) );
+  }
+
+  /**
+   * Test every tracked request with one `MPI_Testsome` call, then run the
+   * callbacks of those that completed.
+   *
+   * @return number of requests completed.
+   */
+  size_t Poll() {
+    ++poll_count;
+    last_num_completed = TestAll();
+    return last_num_completed;
+  }
+
+  /**
+   * Test a single tracked request, in rotation, running its callback if it
+   * completed.
+   *
+   * Costs the same regardless of how many requests are tracked, but still
+   * drives MPI progress, which may only advance a few messages per call.
+   *
+   * @return number of requests completed.
+   */
+  size_t PollOne() {
+    if ( requests.empty() ) return 0;
+
+    cursor = (cursor + 1) % requests.size();
+    int flag;
+    UITSL_Test( &requests[cursor], &flag, MPI_STATUS_IGNORE );
+    if ( !flag ) return 0;
+
+    emp_assert( uitsl::test_null( requests[cursor] ) );
+    callback_t callback{ std::move( callbacks[cursor] ) };
+    Erase( cursor );
+    callback();
+    return 1;
+  }
+
+  /**
+   * Poll unless the engine has been polled since this caller last saw it.
+   *
+   * While the last poll found traffic, callers that skip polling test one
+   * request instead, so MPI keeps progressing between polls without each
+   * caller scanning every request.
+   *
+   * @param last_seen caller's poll count as of its last visit, updated.
+   * @return number of requests completed.
+   */
+  size_t PollIfStale(size_t& last_seen) {
+    size_t res{};
+    if ( last_seen == poll_count ) res = Poll();
+    else if ( last_num_completed ) res = PollOne();
+    last_seen = poll_count;
+    return res;
+  }
+
+  /**
+   * Cancel and free every request tracked for owner without running its
+   * callbacks.
+   */
+  void Cancel(const void* owner) {
+    for (size_t idx{}; idx < requests.size(); ) {
+      if ( owners[idx] == owner ) {
+        UITSL_Cancel( &requests[idx] );
+        UITSL_Request_free( &requests[idx] );
+        Erase( idx );
+      } else ++idx;
+    }
+  }
+
+  /// Number of requests currently tracked.
+  size_t GetSize() const { return requests.size(); }
+
+  /// Number of polls performed, including those with nothing to test.
+  size_t GetPollCount() const { return poll_count; }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_MPI_PROGRESSENGINE_HPP_INCLUDE
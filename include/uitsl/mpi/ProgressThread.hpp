@@ -0,0 +1,141 @@
+#pragma once
+#ifndef UITSL_MPI_PROGRESSTHREAD_HPP_INCLUDE
+#define UITSL_MPI_PROGRESSTHREAD_HPP_INCLUDE
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stddef.h>
+#include <thread>
+#include <unordered_map>
+
+#include <mpi.h>
+
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+
+#include "audited_routines.hpp"
+#include "ProgressEngine.hpp"
+
+namespace uitsl {
+
+/**
+ * Background thread that drives MPI progress on behalf of registered
+ * clients, so that they may go long stretches without calling into MPI.
+ *
+ * Each round, the thread calls every client's progress function, which may
+ * post and track requests on the thread's `uitsl::ProgressEngine`, then
+ * polls the engine. Clients exchange data with the thread through their own
+ * lock-free queues. Rounds that do no work yield.
+ *
+ * Requires MPI initialized with `MPI_THREAD_MULTIPLE`.
+ */
+class ProgressThread {
+
+public:
+
+  /// Returns whether any work was done.
+  using progress_t = std::function<bool(uitsl::ProgressEngine&)>;
+
+private:
+
+  uitsl::ProgressEngine engine;
+
+  std::unordered_map<const void*, progress_t> clients;
+
+  // held for a whole round, so unregistered clients are never called after
+  std::mutex mutex;
+
+  std::atomic<bool> quit{};
+
+  std::thread thread;
+
+  bool DoRound() {
+    const std::lock_guard guard{ mutex };
+    bool busy{};
+    for (auto& [owner, progress] : clients) busy |= progress( engine );
+    busy |= engine.Poll();
+    return busy;
+  }
+
+  void Run() {
+    while ( !quit.load( std::memory_order_relaxed ) ) {
+      if ( !DoRound() ) std::this_thread::yield();
+    }
+  }
+
+public:
+
+  ProgressThread() {
+    int provided;
+    UITSL_Query_thread( &provided );
+    // the thread calls into MPI concurrently with its clients
+    emp_always_assert(
+      provided >= MPI_THREAD_MULTIPLE,
+      "ProgressThread requires MPI_THREAD_MULTIPLE", provided
+    );
+    thread = std::thread( [this](){ Run(); } );
+  }
+
+  ~ProgressThread() {
+    quit.store( true, std::memory_order_relaxed );
+    thread.join();
+  }
+
+  ProgressThread(const ProgressThread&) = delete;
+  ProgressThread& operator=(const ProgressThread&) = delete;
+
+  /**
+   * Call progress from the thread every round until owner is unregistered.
+   */
+  void Register(const void* owner, progress_t progress) {
+    const std::lock_guard guard{ mutex };
+    clients.emplace( owner, std::move(progress) );
+  }
+
+  /**
+   * Stop calling owner's progress function and cancel its tracked requests.
+   *
+   * Owner's progress function gets one last call and the engine one last
+   * poll first, so work handed off just before unregistering is posted.
+   * After return, the thread no longer touches owner's data.
+   */
+  void Unregister(const void* owner) {
+    const std::lock_guard guard{ mutex };
+    const auto it = clients.find( owner );
+    if ( it == std::end( clients ) ) return;
+    it->second( engine );
+    engine.Poll();
+    clients.erase( it );
+    engine.Cancel( owner );
+  }
+
+  size_t GetNumClients() {
+    const std::lock_guard guard{ mutex };
+    return clients.size();
+  }
+
+  /**
+   * Get this process's progress thread, starting it if needed.
+   *
+   * The thread stops once every handle has been released, which must happen
+   * before MPI is finalized.
+   */
+  static std::shared_ptr<ProgressThread> Acquire() {
+    static std::mutex acquire_mutex;
+    static std::weak_ptr<ProgressThread> instance;
+
+    const std::lock_guard guard{ acquire_mutex };
+    auto res = instance.lock();
+    if ( !res ) {
+      res = std::make_shared<ProgressThread>();
+      instance = res;
+    }
+    return res;
+  }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_MPI_PROGRESSTHREAD_HPP_INCLUDE
@@ -2,12 +2,15 @@
 #ifndef UITSL_MPI_COMM_UTILS_HPP_INCLUDE
 #define UITSL_MPI_COMM_UTILS_HPP_INCLUDE
 
+#include <functional>
+#include <map>
 #include <set>
 #include <sstream>
 
 #include <mpi.h>
 
 #include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
 
 #include "../utility/print_utils.hpp"
 
@@ -110,6 +113,76 @@ inline proc_id_t translate_comm_rank(
   );
 }
 
+namespace internal {
+
+// number hosts, each given by the comm of ranks on it, in order of their
+// lowest rank within comm
+inline emp::vector<size_t> number_hosts(
+  MPI_Comm host_comm, const MPI_Comm& comm
+) {
+
+  const int leader{ uitsl::translate_comm_rank( 0, host_comm, comm ) };
+  UITSL_Comm_free( &host_comm );
+
+  emp::vector<int> leaders( uitsl::get_nprocs(comm) );
+  UITSL_Allgather(
+    &leader, // const void *sendbuf
+    1, // int sendcount
+    MPI_INT, // MPI_Datatype sendtype
+    leaders.data(), // void *recvbuf
+    1, // int recvcount
+    MPI_INT, // MPI_Datatype recvtype
+    comm // MPI_Comm comm
+  );
+
+  std::map<int, size_t> host_ids;
+  emp::vector<size_t> res;
+  for (const int rank_leader : leaders) {
+    res.push_back(
+      host_ids.emplace( rank_leader, host_ids.size() ).first->second
+    );
+  }
+  return res;
+
+}
+
+} // namespace internal
+
+/// Which ranks of comm share a host (i.e., could share memory)?
+/// Collective over comm.
+/// @return host of each rank of comm, numbered from zero in order of each
+/// host's lowest rank.
+inline emp::vector<size_t> get_host_ids(const MPI_Comm& comm=MPI_COMM_WORLD) {
+  #ifdef __EMSCRIPTEN__
+    return emp::vector<size_t>( 1 );
+  #else
+    MPI_Comm host_comm;
+    UITSL_Comm_split_type(
+      comm, // MPI_Comm comm
+      MPI_COMM_TYPE_SHARED, // int split_type
+      get_rank(comm), // int key
+      MPI_INFO_NULL, // MPI_Info info
+      &host_comm // MPI_Comm *newcomm
+    );
+    return internal::number_hosts( host_comm, comm );
+  #endif
+}
+
+/// Simulate which ranks of comm share a host, e.g., to test host-aware code
+/// on one machine. Collective over comm.
+/// @param colorer gives ranks on the same simulated host the same color.
+/// @return host of each rank of comm, numbered as by get_host_ids.
+inline emp::vector<size_t> get_host_ids(
+  const std::function<int(const int)> colorer,
+  const MPI_Comm& comm=MPI_COMM_WORLD
+) {
+  #ifdef __EMSCRIPTEN__
+    return emp::vector<size_t>( 1 );
+  #else
+    return internal::number_hosts( uitsl::split_comm( colorer, comm ), comm );
+  #endif
+}
+
 inline bool is_multiprocess(const MPI_Comm& comm=MPI_COMM_WORLD) {
   return uitsl::get_nprocs(comm) > 1;
 }
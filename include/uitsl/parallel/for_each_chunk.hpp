@@ -0,0 +1,44 @@
+#pragma once
+#ifndef UITSL_PARALLEL_FOR_EACH_CHUNK_HPP_INCLUDE
+#define UITSL_PARALLEL_FOR_EACH_CHUNK_HPP_INCLUDE
+
+#include <stddef.h>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+#include "ThreadTeam.hpp"
+
+namespace uitsl {
+
+/**
+ * Split [0, num_items) into num_chunks contiguous, nearly even chunks and
+ * call task(begin, end, chunk) for each on its own thread, returning once
+ * all are done.
+ *
+ * Chunk boundaries only depend on num_items and num_chunks, so per-chunk
+ * results can be concatenated in chunk order deterministically.
+ */
+template<typename Task>
+void for_each_chunk(
+  const size_t num_items, const size_t num_chunks, Task&& task
+) {
+
+  emp_assert( num_chunks );
+
+  uitsl::ThreadTeam team;
+  for (size_t chunk{}; chunk < num_chunks; ++chunk) team.Add(
+    [&task, chunk, num_items, num_chunks](){
+      task(
+        num_items * chunk / num_chunks,
+        num_items * (chunk + 1) / num_chunks,
+        chunk
+      );
+    }
+  );
+  team.Join();
+
+}
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_PARALLEL_FOR_EACH_CHUNK_HPP_INCLUDE
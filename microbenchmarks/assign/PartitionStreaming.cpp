@@ -0,0 +1,230 @@
+#include <functional>
+#include <ratio>
+
+#include <benchmark/benchmark.h>
+#include <mpi.h>
+
+#include "uitsl/debug/benchmark_utils.hpp"
+#include "uitsl/mpi/MpiGuard.hpp"
+#include "uitsl/mpi/mpi_utils.hpp"
+#include "uitsl/nonce/ScopeGuard.hpp"
+
+#include "netuit/arrange/ImplicitToroidalGridTopology.hpp"
+#include "netuit/arrange/ToroidalGridTopologyFactory.hpp"
+#include "netuit/assign/GenerateMetisAssignments.hpp"
+#include "netuit/assign/PartitionStreaming.hpp"
+#include "netuit/topology/CsrTopology.hpp"
+
+const uitsl::MpiGuard guard;
+
+constexpr size_t num_parts = 64;
+
+// for the full proc and thread assignment pipelines
+constexpr size_t threads_per_proc = 4;
+
+void log_report(
+  benchmark::State& state,
+  const size_t num_nodes,
+  const netuit::PartitionReport& report
+) {
+  state.counters.insert({
+    {
+      "Nodes",
+      benchmark::Counter( num_nodes, benchmark::Counter::kAvgThreads )
+    },
+    {
+      "Cut Edges",
+      benchmark::Counter(
+        report.num_cut_edges, benchmark::Counter::kAvgThreads
+      )
+    },
+    {
+      "Comm Volume",
+      benchmark::Counter(
+        report.comm_volume, benchmark::Counter::kAvgThreads
+      )
+    },
+    {
+      "Imbalance",
+      benchmark::Counter(
+        report.imbalance.front(), benchmark::Counter::kAvgThreads
+      )
+    }
+  });
+}
+
+// state.range(0): number of nodes
+template<netuit::StreamingObjective Objective>
+static void Streaming(benchmark::State& state) {
+
+  const size_t num_nodes = state.range(0);
+  const netuit::ImplicitToroidalGridTopology topology{ num_nodes };
+
+  emp::vector<uint32_t> parts;
+
+  // benchmark
+  for (auto _ : state) {
+    parts = netuit::PartitionStreaming( num_parts, topology, Objective );
+    benchmark::DoNotOptimize( parts.data() );
+    state.PauseTiming();
+    UITSL_Barrier( MPI_COMM_WORLD );
+    state.ResumeTiming();
+  }
+
+  // log results
+  log_report( state, num_nodes, netuit::EvaluatePartitionDistributed(
+    topology, [&parts](const size_t node){ return parts[node]; }, num_parts
+  ) );
+
+}
+
+// state.range(0): number of nodes
+static void Metis(benchmark::State& state) {
+
+  const size_t num_nodes = state.range(0);
+  const netuit::CsrTopology topology{
+    netuit::ToroidalGridTopologyFactory{}( num_nodes )
+  };
+
+  emp::vector<int32_t> parts;
+
+  // benchmark
+  for (auto _ : state) {
+    // every proc partitions the whole graph, as GenerateMetisAssignments does
+    parts = netuit::PartitionMetis( num_parts, topology );
+    benchmark::DoNotOptimize( parts.data() );
+    state.PauseTiming();
+    UITSL_Barrier( MPI_COMM_WORLD );
+    state.ResumeTiming();
+  }
+
+  // log results
+  log_report( state, num_nodes, netuit::EvaluatePartitionDistributed(
+    topology, [&parts](const size_t node){ return parts[node]; }, num_parts
+  ) );
+
+}
+
+// state.range(0): number of nodes
+template<netuit::StreamingObjective Objective>
+static void StreamingAssignments(benchmark::State& state) {
+
+  const size_t num_nodes = state.range(0);
+  const netuit::ImplicitToroidalGridTopology topology{ num_nodes };
+
+  std::function<uitsl::proc_id_t(size_t)> proc_assignment;
+
+  // benchmark
+  for (auto _ : state) {
+    proc_assignment = netuit::GenerateStreamingAssignmentFunctors(
+      num_parts, threads_per_proc, topology, Objective
+    ).first;
+    state.PauseTiming();
+    UITSL_Barrier( MPI_COMM_WORLD );
+    state.ResumeTiming();
+  }
+
+  // log results
+  log_report( state, num_nodes, netuit::EvaluatePartitionDistributed(
+    topology,
+    [&proc_assignment](const size_t node){ return proc_assignment(node); },
+    num_parts
+  ) );
+
+}
+
+// state.range(0): number of nodes
+static void MetisAssignments(benchmark::State& state) {
+
+  const size_t num_nodes = state.range(0);
+  const netuit::CsrTopology topology{
+    netuit::ToroidalGridTopologyFactory{}( num_nodes )
+  };
+
+  std::function<uitsl::proc_id_t(size_t)> proc_assignment;
+
+  // benchmark
+  for (auto _ : state) {
+    proc_assignment = netuit::GenerateMetisAssignmentFunctors(
+      num_parts, threads_per_proc, topology
+    ).first;
+    state.PauseTiming();
+    UITSL_Barrier( MPI_COMM_WORLD );
+    state.ResumeTiming();
+  }
+
+  // log results
+  log_report( state, num_nodes, netuit::EvaluatePartitionDistributed(
+    topology,
+    [&proc_assignment](const size_t node){ return proc_assignment(node); },
+    num_parts
+  ) );
+
+}
+
+const uitsl::ScopeGuard register_benchmarks( [](){
+
+  // grids with 2^12, 2^16, 2^20, and 2^24 nodes
+  auto ldg = benchmark::RegisterBenchmark(
+    "Streaming<ldg>", Streaming<netuit::StreamingObjective::ldg>
+  );
+  uitsl::report_confidence( ldg );
+  ldg->RangeMultiplier( 16 )->Range(
+    4096, 16 * std::mega::num
+  )->Iterations( 1 )->Unit( benchmark::kMillisecond );
+
+  auto fennel = benchmark::RegisterBenchmark(
+    "Streaming<fennel>", Streaming<netuit::StreamingObjective::fennel>
+  );
+  uitsl::report_confidence( fennel );
+  fennel->RangeMultiplier( 16 )->Range(
+    4096, 16 * std::mega::num
+  )->Iterations( 1 )->Unit( benchmark::kMillisecond );
+
+  auto metis = benchmark::RegisterBenchmark( "Metis", Metis );
+  uitsl::report_confidence( metis );
+  metis->RangeMultiplier( 16 )->Range(
+    4096, std::mega::num
+  )->Iterations( 1 )->Unit( benchmark::kMillisecond );
+
+  // whole proc and thread assignment pipelines, compared by proc-level cut
+  auto ldg_assignments = benchmark::RegisterBenchmark(
+    "StreamingAssignments<ldg>",
+    StreamingAssignments<netuit::StreamingObjective::ldg>
+  );
+  uitsl::report_confidence( ldg_assignments );
+  ldg_assignments->RangeMultiplier( 16 )->Range(
+    4096, std::mega::num
+  )->Iterations( 1 )->Unit( benchmark::kMillisecond );
+
+  auto fennel_assignments = benchmark::RegisterBenchmark(
+    "StreamingAssignments<fennel>",
+    StreamingAssignments<netuit::StreamingObjective::fennel>
+  );
+  uitsl::report_confidence( fennel_assignments );
+  fennel_assignments->RangeMultiplier( 16 )->Range(
+    4096, std::mega::num
+  )->Iterations( 1 )->Unit( benchmark::kMillisecond );
+
+  auto metis_assignments = benchmark::RegisterBenchmark(
+    "MetisAssignments", MetisAssignments
+  );
+  uitsl::report_confidence( metis_assignments );
+  metis_assignments->RangeMultiplier( 16 )->Range(
+    4096, std::mega::num
+  )->Iterations( 1 )->Unit( benchmark::kMillisecond );
+
+} );
+
+int main(int argc, char** argv) {
+
+  // suppress json output for non-root procs
+  int one{1};
+  benchmark::Initialize(
+    uitsl::is_root() ? &argc : &one,
+    argv
+  );
+
+  benchmark::RunSpecifiedBenchmarks();
+
+}
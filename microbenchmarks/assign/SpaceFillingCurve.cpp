@@ -0,0 +1,217 @@
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <mpi.h>
+
+#include "../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "uitsl/debug/benchmark_utils.hpp"
+#include "uitsl/debug/safe_cast.hpp"
+#include "uitsl/math/is_perfect_hypercube.hpp"
+#include "uitsl/mpi/MpiGuard.hpp"
+#include "uitsl/mpi/mpi_utils.hpp"
+#include "uitsl/nonce/ScopeGuard.hpp"
+#include "uitsl/utility/assign_utils.hpp"
+
+#include "uit/ducts/intra/put=dropping+get=stepping+type=any/a::SerialPendingDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=stepping+type=trivial/inlet=RingIsend+outlet=RingIrecv_t::IriOriDuct.hpp"
+#include "uit/ducts/thread/put=dropping+get=stepping+type=any/a::AtomicPendingDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+#include "netuit/arrange/ToroidalGridTopologyFactory.hpp"
+#include "netuit/assign/AssignContiguously.hpp"
+#include "netuit/assign/AssignPerfectHypercube.hpp"
+#include "netuit/assign/AssignRoundRobin.hpp"
+#include "netuit/assign/AssignSpaceFillingCurve.hpp"
+#include "netuit/assign/EvaluatePartition.hpp"
+#include "netuit/mesh/Mesh.hpp"
+#include "netuit/topology/CsrTopology.hpp"
+
+const uitsl::MpiGuard guard;
+
+using Spec = uit::ImplSpec<
+  int,
+  uit::ImplSelect<
+    uit::a::SerialPendingDuct,
+    uit::a::AtomicPendingDuct,
+    uit::t::IriOriDuct
+  >
+>;
+
+using proc_assignment_t = std::function<uitsl::proc_id_t(size_t)>;
+
+using assigner_factory_t = std::function<
+  proc_assignment_t(size_t side_length, size_t num_procs)
+>;
+
+// state.range(0): side length of square toroidal grid
+// state.range(1): units of compute work per node per step
+static void SpaceFillingCurve(
+  benchmark::State& state, const assigner_factory_t& make_assignment
+) {
+
+  const size_t side_length = state.range(0);
+  const size_t num_nodes = side_length * side_length;
+  const size_t compute_work = state.range(1);
+  const size_t num_procs = uitsl::get_nprocs();
+
+  const auto proc_assignment = make_assignment( side_length, num_procs );
+
+  const auto topology = netuit::ToroidalGridTopologyFactory{}( num_nodes );
+  const auto report = netuit::EvaluatePartition(
+    netuit::CsrTopology{ topology }, proc_assignment, num_procs
+  );
+
+  // set up
+  netuit::Mesh<Spec> mesh{
+    topology,
+    uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+    proc_assignment
+  };
+  auto submesh = mesh.GetSubmesh();
+
+  int step{};
+  size_t num_fresh{};
+  size_t num_gets{};
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+  // benchmark
+  for (auto _ : state) {
+
+    for (auto& node : submesh) {
+      uitsl::do_compute_work( compute_work );
+      for (auto& output : node.GetOutputs()) {
+        output.TryPut( step );
+        output.TryFlush();
+      }
+    }
+
+    for (auto& node : submesh) for (auto& input : node.GetInputs()) {
+      num_fresh += input.Jump() != 0;
+      ++num_gets;
+      benchmark::DoNotOptimize( input.Get() );
+    }
+
+    ++step;
+
+  }
+
+  // log results
+  state.counters.insert({
+    {
+      "Nodes",
+      benchmark::Counter( num_nodes, benchmark::Counter::kAvgThreads )
+    },
+    {
+      "Cut Edges",
+      benchmark::Counter(
+        report.num_cut_edges, benchmark::Counter::kAvgThreads
+      )
+    },
+    {
+      "Fresh Get Fraction",
+      benchmark::Counter(
+        num_gets ? num_fresh / static_cast<double>(num_gets) : 0.0,
+        benchmark::Counter::kAvgThreads
+      )
+    },
+    {
+      "Processes",
+      benchmark::Counter(
+        uitsl::get_nprocs(),
+        benchmark::Counter::kAvgThreads
+      )
+    }
+  });
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+}
+
+void register_space_filling_curve(
+  const std::string& assigner_name,
+  const assigner_factory_t& factory,
+  const std::vector<int64_t>& side_lengths={16, 32, 64}
+) {
+
+  auto res = benchmark::RegisterBenchmark(
+    emp::to_string("SpaceFillingCurve/", assigner_name).c_str(),
+    SpaceFillingCurve,
+    factory
+  )->ArgsProduct({ side_lengths, {0, 100} });
+
+  uitsl::report_confidence(res);
+
+  // every proc must step its mesh the same number of times
+  res->Iterations( std::kilo::num );
+
+}
+
+const uitsl::ScopeGuard register_benchmarks( [](){
+
+  register_space_filling_curve(
+    "AssignContiguously",
+    [](const size_t side_length, const size_t num_procs){
+      return netuit::AssignContiguously<uitsl::proc_id_t>{
+        num_procs, side_length * side_length
+      };
+    }
+  );
+
+  register_space_filling_curve(
+    "AssignRoundRobin",
+    [](size_t, const size_t num_procs){
+      return netuit::AssignRoundRobin<uitsl::proc_id_t>{ num_procs };
+    },
+    // nearly every edge crosses procs, so larger grids open too many
+    // proc ducts to step reliably
+    {16}
+  );
+
+  // only tiles the grid evenly for square numbers of procs
+  if (
+    uitsl::is_perfect_hypercube( uitsl::get_nprocs(), 2 )
+  ) register_space_filling_curve(
+    "AssignPerfectHypercube",
+    [](const size_t side_length, const size_t num_procs){
+      return netuit::AssignPerfectHypercube<uitsl::proc_id_t>{
+        2, side_length * side_length, num_procs
+      };
+    }
+  );
+
+  register_space_filling_curve(
+    "AssignHilbertCurve",
+    [](const size_t side_length, const size_t num_procs){
+      return netuit::AssignHilbertCurve<uitsl::proc_id_t>{
+        { side_length, side_length }, num_procs
+      };
+    }
+  );
+
+  register_space_filling_curve(
+    "AssignMortonCurve",
+    [](const size_t side_length, const size_t num_procs){
+      return netuit::AssignMortonCurve<uitsl::proc_id_t>{
+        { side_length, side_length }, num_procs
+      };
+    }
+  );
+
+} );
+
+int main(int argc, char** argv) {
+
+  // suppress json output for non-root procs
+  int one{1};
+  benchmark::Initialize(
+    uitsl::is_root() ? &argc : &one,
+    argv
+  );
+
+  benchmark::RunSpecifiedBenchmarks();
+
+}
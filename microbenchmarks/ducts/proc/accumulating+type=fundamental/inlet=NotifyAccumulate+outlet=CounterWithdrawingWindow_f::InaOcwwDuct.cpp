@@ -0,0 +1,10 @@
+#include "uit/ducts/proc/accumulating+type=fundamental/inlet=NotifyAccumulate+outlet=CounterWithdrawingWindow_f::InaOcwwDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+using ImplSel = uit::ImplSelect<
+  uit::a::SerialPendingDuct,
+  uit::a::AtomicPendingDuct,
+  uit::f::InaOcwwDuct
+>;
+
+#include "../ProcDuct.hpp"
@@ -0,0 +1,10 @@
+#include "uit/ducts/proc/put=dropping+get=skipping+type=trivial/inlet=Expose+outlet=PrefetchRget_t::IeOprDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+using ImplSel = uit::ImplSelect<
+  uit::a::SerialPendingDuct,
+  uit::a::AtomicPendingDuct,
+  uit::t::IeOprDuct
+>;
+
+#include "../ProcDuct.hpp"
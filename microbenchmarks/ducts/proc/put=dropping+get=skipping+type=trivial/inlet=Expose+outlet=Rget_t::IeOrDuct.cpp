@@ -0,0 +1,10 @@
+#include "uit/ducts/proc/put=dropping+get=skipping+type=trivial/inlet=Expose+outlet=Rget_t::IeOrDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+using ImplSel = uit::ImplSelect<
+  uit::a::SerialPendingDuct,
+  uit::a::AtomicPendingDuct,
+  uit::t::IeOrDuct
+>;
+
+#include "../ProcDuct.hpp"
@@ -0,0 +1,10 @@
+#include "uit/ducts/proc/put=dropping+get=skipping+type=trivial/inlet=FlushRput+outlet=SyncWindow_t::IfrOswDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+using ImplSel = uit::ImplSelect<
+  uit::a::SerialPendingDuct,
+  uit::a::AtomicPendingDuct,
+  uit::t::IfrOswDuct
+>;
+
+#include "../ProcDuct.hpp"
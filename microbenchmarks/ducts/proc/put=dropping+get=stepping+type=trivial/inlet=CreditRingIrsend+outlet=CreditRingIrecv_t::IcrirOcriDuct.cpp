@@ -0,0 +1,10 @@
+#include "uit/ducts/proc/put=dropping+get=stepping+type=trivial/inlet=CreditRingIrsend+outlet=CreditRingIrecv_t::IcrirOcriDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+using ImplSel = uit::ImplSelect<
+  uit::a::SerialPendingDuct,
+  uit::a::AtomicPendingDuct,
+  uit::t::IcrirOcriDuct
+>;
+
+#include "../ProcDuct.hpp"
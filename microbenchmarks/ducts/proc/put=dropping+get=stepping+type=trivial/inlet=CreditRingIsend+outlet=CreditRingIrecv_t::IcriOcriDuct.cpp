@@ -0,0 +1,10 @@
+#include "uit/ducts/proc/put=dropping+get=stepping+type=trivial/inlet=CreditRingIsend+outlet=CreditRingIrecv_t::IcriOcriDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+using ImplSel = uit::ImplSelect<
+  uit::a::SerialPendingDuct,
+  uit::a::AtomicPendingDuct,
+  uit::t::IcriOcriDuct
+>;
+
+#include "../ProcDuct.hpp"
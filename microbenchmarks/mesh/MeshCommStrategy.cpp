@@ -0,0 +1,169 @@
+#include <ratio>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <mpi.h>
+
+#include "../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "uitsl/debug/benchmark_utils.hpp"
+#include "uitsl/debug/safe_cast.hpp"
+#include "uitsl/mpi/MpiMultithreadGuard.hpp"
+#include "uitsl/mpi/mpi_utils.hpp"
+#include "uitsl/nonce/ScopeGuard.hpp"
+#include "uitsl/parallel/ThreadTeam.hpp"
+
+#include "uit/ducts/intra/put=dropping+get=stepping+type=any/a::SerialPendingDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=stepping+type=trivial/inlet=RingIsend+outlet=RingIrecv_t::IriOriDuct.hpp"
+#include "uit/ducts/thread/put=dropping+get=stepping+type=any/a::AtomicPendingDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+#include "netuit/arrange/ToroidalGridTopologyFactory.hpp"
+#include "netuit/mesh/Mesh.hpp"
+
+const uitsl::MpiMultithreadGuard guard;
+
+using Spec = uit::ImplSpec<
+  int,
+  uit::ImplSelect<
+    uit::a::SerialPendingDuct,
+    uit::a::AtomicPendingDuct,
+    uit::t::IriOriDuct
+  >
+>;
+
+constexpr size_t side_length = 32;
+constexpr size_t steps_per_iteration = 10;
+
+// state.range(0): number of threads per proc
+template<netuit::MeshCommStrategy CommStrategy>
+static void MeshCommStrategy(benchmark::State& state) {
+
+  const size_t num_threads = state.range(0);
+  const size_t num_procs = uitsl::get_nprocs();
+
+  // procs own column stripes and threads own row stripes within them,
+  // so every thread has inter-process edges on both sides
+  netuit::Mesh<Spec> mesh{
+    netuit::ToroidalGridTopologyFactory{}( side_length * side_length ),
+    [num_threads](const size_t node_id) {
+      return node_id / side_length * num_threads / side_length;
+    },
+    [num_procs](const size_t node_id) {
+      return node_id % side_length * num_procs / side_length;
+    },
+    std::make_shared<Spec::ProcBackEnd>(),
+    MPI_COMM_WORLD,
+    CommStrategy
+  };
+
+  emp::vector<netuit::Mesh<Spec>::submesh_t> submeshes;
+  for (size_t thread{}; thread < num_threads; ++thread) {
+    submeshes.push_back( mesh.GetSubmesh(thread) );
+  }
+
+  size_t num_fresh{};
+  size_t num_gets{};
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+  // benchmark
+  for (auto _ : state) {
+
+    uitsl::ThreadTeam team;
+    emp::vector<size_t> thread_fresh( num_threads );
+    for (size_t thread{}; thread < num_threads; ++thread) team.Add(
+      [&submesh = submeshes[thread], &fresh = thread_fresh[thread]](){
+        for (size_t step{}; step < steps_per_iteration; ++step) {
+          for (auto& node : submesh) for (auto& output : node.GetOutputs()) {
+            output.TryPut( step );
+            output.TryFlush();
+          }
+          for (auto& node : submesh) for (auto& input : node.GetInputs()) {
+            fresh += input.Jump() != 0;
+          }
+        }
+      }
+    );
+    team.Join();
+
+    for (const auto fresh : thread_fresh) num_fresh += fresh;
+    for (const auto& submesh : submeshes) for (const auto& node : submesh) {
+      num_gets += node.GetNumInputs() * steps_per_iteration;
+    }
+
+  }
+
+  // log results
+  state.counters.insert({
+    {
+      "Threads",
+      benchmark::Counter( num_threads, benchmark::Counter::kAvgThreads )
+    },
+    {
+      "Processes",
+      benchmark::Counter( num_procs, benchmark::Counter::kAvgThreads )
+    },
+    {
+      "Duct Comms",
+      benchmark::Counter(
+        mesh.GetNumDuctComms(), benchmark::Counter::kAvgThreads
+      )
+    },
+    {
+      "Steps",
+      benchmark::Counter(
+        state.iterations() * steps_per_iteration,
+        benchmark::Counter::kIsRate
+      )
+    },
+    {
+      "Fresh Get Fraction",
+      benchmark::Counter(
+        num_gets ? num_fresh / static_cast<double>(num_gets) : 0.0,
+        benchmark::Counter::kAvgThreads
+      )
+    }
+  });
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+}
+
+template<netuit::MeshCommStrategy CommStrategy>
+void register_mesh_comm_strategy(const std::string& strategy_name) {
+
+  auto res = benchmark::RegisterBenchmark(
+    emp::to_string("MeshCommStrategy/", strategy_name).c_str(),
+    MeshCommStrategy<CommStrategy>
+  )->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+  uitsl::report_confidence(res);
+
+  // every proc must step its mesh the same number of times
+  res->Iterations( std::hecto::num );
+
+}
+
+const uitsl::ScopeGuard register_benchmarks( [](){
+  register_mesh_comm_strategy<netuit::MeshCommStrategy::shared>( "shared" );
+  register_mesh_comm_strategy<netuit::MeshCommStrategy::per_outlet_thread>(
+    "per_outlet_thread"
+  );
+  register_mesh_comm_strategy<netuit::MeshCommStrategy::per_thread_pair>(
+    "per_thread_pair"
+  );
+} );
+
+int main(int argc, char** argv) {
+
+  // suppress json output for non-root procs
+  int one{1};
+  benchmark::Initialize(
+    uitsl::is_root() ? &argc : &one,
+    argv
+  );
+
+  benchmark::RunSpecifiedBenchmarks();
+
+}
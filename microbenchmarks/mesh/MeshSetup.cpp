@@ -0,0 +1,190 @@
+#include <ratio>
+
+#include <benchmark/benchmark.h>
+#include <mpi.h>
+
+#include "../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "uitsl/debug/benchmark_utils.hpp"
+#include "uitsl/mpi/MpiGuard.hpp"
+#include "uitsl/mpi/mpi_utils.hpp"
+#include "uitsl/nonce/ScopeGuard.hpp"
+#include "uitsl/utility/assign_utils.hpp"
+
+#include "uit/ducts/intra/put=dropping+get=stepping+type=any/a::SerialPendingDuct.hpp"
+#include "uit/ducts/mock/ThrowDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=stepping+type=trivial/inlet=RingIsend+outlet=RingIrecv_t::IriOriDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+#include "netuit/arrange/ImplicitRingTopology.hpp"
+#include "netuit/arrange/RingTopologyFactory.hpp"
+#include "netuit/mesh/Mesh.hpp"
+#include "netuit/topology/LocalTopology.hpp"
+
+const uitsl::MpiGuard guard;
+
+using Spec = uit::ImplSpec<
+  int,
+  uit::ImplSelect<
+    uit::a::SerialPendingDuct,
+    uit::ThrowDuct,
+    uit::t::IriOriDuct
+  >
+>;
+
+// ring split into one contiguous block per proc, so each proc has two
+// neighbors however large the ring grows
+netuit::LocalTopology make_local_topology(const size_t num_nodes) {
+
+  uitsl::AssignContiguously<uitsl::proc_id_t> proc_assignment{
+    uitsl::get_nprocs(), num_nodes
+  };
+
+  emp::vector<size_t> nodes;
+  for (size_t node_id{}; node_id < num_nodes; ++node_id) {
+    if ( proc_assignment(node_id) == uitsl::get_proc_id() ) {
+      nodes.push_back( node_id );
+    }
+  }
+
+  return netuit::LocalTopology::Generate(
+    std::move( nodes ),
+    [num_nodes](const size_t node_id, const auto& emit){
+      const size_t prev = (node_id + num_nodes - 1) % num_nodes;
+      emit( netuit::LocalTopology::Edge{ prev, prev, node_id } );
+      emit( netuit::LocalTopology::Edge{
+        node_id, node_id, (node_id + 1) % num_nodes
+      } );
+    }
+  );
+
+}
+
+static void GlobalSetup(benchmark::State& state) {
+
+  const size_t num_nodes = state.range(0);
+
+  // benchmark
+  for (auto _ : state) {
+    // prevent tags from overflowing over many setups
+    netuit::internal::MeshIDCounter::Reset();
+    netuit::Mesh<Spec> mesh{
+      netuit::RingTopologyFactory{}( num_nodes ),
+      uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+      uitsl::AssignContiguously<uitsl::proc_id_t>{
+        uitsl::get_nprocs(), num_nodes
+      }
+    };
+    benchmark::DoNotOptimize( mesh.GetNodeCount() );
+    state.PauseTiming();
+    UITSL_Barrier( MPI_COMM_WORLD );
+    state.ResumeTiming();
+  }
+
+  // log results
+  state.counters.insert({
+    {
+      "Nodes",
+      benchmark::Counter( num_nodes, benchmark::Counter::kAvgThreads )
+    }
+  });
+
+}
+
+static void LocalSetup(benchmark::State& state) {
+
+  const size_t num_nodes = state.range(0);
+
+  // benchmark
+  for (auto _ : state) {
+    // prevent tags from overflowing over many setups
+    netuit::internal::MeshIDCounter::Reset();
+    netuit::Mesh<Spec> mesh{
+      make_local_topology( num_nodes ),
+      uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+      uitsl::AssignContiguously<uitsl::proc_id_t>{
+        uitsl::get_nprocs(), num_nodes
+      }
+    };
+    benchmark::DoNotOptimize( mesh.GetNodeCount() );
+    state.PauseTiming();
+    UITSL_Barrier( MPI_COMM_WORLD );
+    state.ResumeTiming();
+  }
+
+  // log results
+  state.counters.insert({
+    {
+      "Nodes",
+      benchmark::Counter( num_nodes, benchmark::Counter::kAvgThreads )
+    }
+  });
+
+}
+
+static void ImplicitSetup(benchmark::State& state) {
+
+  const size_t num_nodes = state.range(0);
+
+  // benchmark
+  for (auto _ : state) {
+    // prevent tags from overflowing over many setups
+    netuit::internal::MeshIDCounter::Reset();
+    netuit::Mesh<Spec> mesh{
+      netuit::ImplicitRingTopology{ num_nodes },
+      uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+      uitsl::AssignContiguously<uitsl::proc_id_t>{
+        uitsl::get_nprocs(), num_nodes
+      }
+    };
+    benchmark::DoNotOptimize( mesh.GetNodeCount() );
+    state.PauseTiming();
+    UITSL_Barrier( MPI_COMM_WORLD );
+    state.ResumeTiming();
+  }
+
+  // log results
+  state.counters.insert({
+    {
+      "Nodes",
+      benchmark::Counter( num_nodes, benchmark::Counter::kAvgThreads )
+    }
+  });
+
+}
+
+const uitsl::ScopeGuard register_benchmarks( [](){
+
+  // every proc must take part in the same number of setups
+  auto global = benchmark::RegisterBenchmark( "GlobalSetup", GlobalSetup );
+  uitsl::report_confidence( global );
+  global->RangeMultiplier( 10 )->Range(
+    std::kilo::num, std::mega::num
+  )->Iterations( 1 )->Unit( benchmark::kMillisecond );
+
+  auto local = benchmark::RegisterBenchmark( "LocalSetup", LocalSetup );
+  uitsl::report_confidence( local );
+  local->RangeMultiplier( 10 )->Range(
+    std::kilo::num, 10 * std::mega::num
+  )->Iterations( 1 )->Unit( benchmark::kMillisecond );
+
+  auto implicit = benchmark::RegisterBenchmark( "ImplicitSetup", ImplicitSetup );
+  uitsl::report_confidence( implicit );
+  implicit->RangeMultiplier( 10 )->Range(
+    std::kilo::num, 10 * std::mega::num
+  )->Iterations( 1 )->Unit( benchmark::kMillisecond );
+
+} );
+
+int main(int argc, char** argv) {
+
+  // suppress json output for non-root procs
+  int one{1};
+  benchmark::Initialize(
+    uitsl::is_root() ? &argc : &one,
+    argv
+  );
+
+  benchmark::RunSpecifiedBenchmarks();
+
+}
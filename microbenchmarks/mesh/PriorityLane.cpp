@@ -0,0 +1,195 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <ratio>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <mpi.h>
+
+#include "../../third-party/Empirical/include/emp/base/vector.hpp"
+#include "../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "uitsl/debug/benchmark_utils.hpp"
+#include "uitsl/mpi/MpiGuard.hpp"
+#include "uitsl/mpi/mpi_utils.hpp"
+#include "uitsl/nonce/ScopeGuard.hpp"
+
+#include "uit/ducts/intra/put=dropping+get=stepping+type=any/a::SerialPendingDuct.hpp"
+#include "uit/ducts/mock/ThrowDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=stepping+type=trivial/inlet=RingIsend+outlet=RingIrecv_t::IriOriDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+#include "netuit/arrange/DyadicTopologyFactory.hpp"
+#include "netuit/assign/AssignAvailableProcs.hpp"
+#include "netuit/mesh/LanedMesh.hpp"
+#include "netuit/mesh/Mesh.hpp"
+
+const uitsl::MpiGuard guard;
+
+using BulkSpec = uit::ImplSpec<
+  std::array<char, 4096>,
+  uit::ImplSelect<uit::a::SerialPendingDuct, uit::ThrowDuct, uit::t::IriOriDuct>
+>;
+
+using ControlSpec = uit::ImplSpec<
+  size_t,
+  uit::ImplSelect<uit::a::SerialPendingDuct, uit::ThrowDuct, uit::t::IriOriDuct>
+>;
+
+// control and bulk meshes on the same comm, so control receives search past
+// unexpected bulk messages
+struct SharedLanes {
+
+  netuit::Mesh<ControlSpec> control;
+  netuit::Mesh<BulkSpec> bulk;
+
+  SharedLanes(const netuit::Topology& topology)
+  : control(
+    topology,
+    uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+    netuit::AssignAvailableProcs{}
+  ), bulk(
+    topology,
+    uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+    netuit::AssignAvailableProcs{}
+  ) { ; }
+
+  auto GetControl() { return control.GetSubmesh().front(); }
+
+  auto GetBulk() { return bulk.GetSubmesh().front(); }
+
+};
+
+// control on the priority lane of a laned mesh
+struct PriorityLanes {
+
+  netuit::LanedMesh<BulkSpec, ControlSpec> mesh;
+
+  PriorityLanes(const netuit::Topology& topology)
+  : mesh(
+    topology,
+    uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+    netuit::AssignAvailableProcs{}
+  ) { ; }
+
+  auto GetControl() { return mesh.GetSubmesh().front().GetPriority(); }
+
+  auto GetBulk() { return mesh.GetSubmesh().front().GetBulk(); }
+
+};
+
+// ping-pongs a small control message between dyad partners while both
+// stream bulk messages at each other
+// state.range(0): bulk puts per control round trip
+template<typename Lanes>
+static void PriorityLane(benchmark::State& state) {
+
+  const size_t bulk_per_ping = state.range(0);
+
+  // prevent tags from overflowing over many setups
+  netuit::internal::MeshIDCounter::Reset();
+  Lanes lanes{ netuit::DyadicTopologyFactory{}( uitsl::get_nprocs() ) };
+  auto control = lanes.GetControl();
+  auto bulk = lanes.GetBulk();
+  auto& control_in = control.GetInput(0);
+  auto& control_out = control.GetOutput(0);
+  auto& bulk_in = bulk.GetInput(0);
+  auto& bulk_out = bulk.GetOutput(0);
+
+  // even nodes ping, odd nodes echo
+  const bool pinger = control.GetNodeID() % 2 == 0;
+
+  emp::vector<double> round_trips;
+  size_t seq{};
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+  // benchmark
+  for (auto _ : state) {
+
+    ++seq;
+    for (size_t i{}; i < bulk_per_ping; ++i) bulk_out.TryPut( {} );
+
+    if (pinger) {
+      const auto start = std::chrono::steady_clock::now();
+      control_out.Put( seq );
+      control_out.TryFlush();
+      // always check the control lane before servicing bulk
+      while ( control_in.JumpGet() != seq ) bulk_in.Jump();
+      round_trips.push_back( std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - start
+      ).count() );
+    } else {
+      while ( control_in.JumpGet() != seq ) bulk_in.Jump();
+      control_out.Put( seq );
+      control_out.TryFlush();
+    }
+
+    bulk_in.Jump();
+
+  }
+
+  // log results
+  std::sort( std::begin(round_trips), std::end(round_trips) );
+  const auto quantile = [&round_trips](const double q) {
+    return round_trips.empty() ? 0.0 : round_trips[
+      static_cast<size_t>( q * (round_trips.size() - 1) )
+    ];
+  };
+
+  state.counters.insert({
+    {
+      "Bulk Puts per Ping",
+      benchmark::Counter( bulk_per_ping, benchmark::Counter::kAvgThreads )
+    },
+    {
+      "Round Trip p50 us",
+      benchmark::Counter( quantile(0.5), benchmark::Counter::kAvgThreads )
+    },
+    {
+      "Round Trip p99 us",
+      benchmark::Counter( quantile(0.99), benchmark::Counter::kAvgThreads )
+    },
+    {
+      "Round Trip max us",
+      benchmark::Counter( quantile(1.0), benchmark::Counter::kAvgThreads )
+    }
+  });
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+}
+
+template<typename Lanes>
+void register_priority_lane(const std::string& lanes_name) {
+
+  auto res = benchmark::RegisterBenchmark(
+    emp::to_string("PriorityLane/", lanes_name).c_str(),
+    PriorityLane<Lanes>
+  )->Arg(0)->Arg(16)->Arg(256);
+
+  uitsl::report_confidence(res);
+
+  // ping and echo procs must run the same number of round trips
+  res->Iterations( std::kilo::num );
+
+}
+
+const uitsl::ScopeGuard register_benchmarks( [](){
+  register_priority_lane<SharedLanes>( "shared" );
+  register_priority_lane<PriorityLanes>( "priority" );
+} );
+
+int main(int argc, char** argv) {
+
+  // suppress json output for non-root procs
+  int one{1};
+  benchmark::Initialize(
+    uitsl::is_root() ? &argc : &one,
+    argv
+  );
+
+  benchmark::RunSpecifiedBenchmarks();
+
+}
@@ -0,0 +1,138 @@
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <mpi.h>
+
+#include "../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "uitsl/debug/benchmark_utils.hpp"
+#include "uitsl/debug/safe_cast.hpp"
+#include "uitsl/mpi/MpiGuard.hpp"
+#include "uitsl/mpi/mpi_utils.hpp"
+#include "uitsl/nonce/ScopeGuard.hpp"
+
+#include "uit/ducts/intra/put=dropping+get=stepping+type=any/a::SerialPendingDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=stepping+type=trivial/inlet=ProgressRingIsend+outlet=ProgressRingIrecv_t::IpriOpriDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=stepping+type=trivial/inlet=RingIsend+outlet=RingIrecv_t::IriOriDuct.hpp"
+#include "uit/ducts/thread/put=dropping+get=stepping+type=any/a::AtomicPendingDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+#include "netuit/arrange/RingTopologyFactory.hpp"
+#include "netuit/assign/AssignRoundRobin.hpp"
+#include "netuit/mesh/Mesh.hpp"
+
+const uitsl::MpiGuard guard;
+
+// state.range(0): nodes per process, each with one inter-process input
+// state.range(1): whether nodes put every step, or inputs only poll
+template<template<typename> typename ProcDuct>
+static void ProgressPoll(benchmark::State& state) {
+
+  using Spec = uit::ImplSpec<
+    int,
+    uit::ImplSelect<
+      uit::a::SerialPendingDuct,
+      uit::a::AtomicPendingDuct,
+      ProcDuct
+    >
+  >;
+
+  const size_t num_procs = uitsl::safe_cast<size_t>( uitsl::get_nprocs() );
+  const size_t num_nodes = state.range(0) * num_procs;
+  const bool do_puts = state.range(1);
+
+  // prevent tags from overflowing over many setups
+  netuit::internal::MeshIDCounter::Reset();
+
+  // round robin assignment puts every ring edge between processes
+  netuit::Mesh<Spec> mesh{
+    netuit::RingTopologyFactory{}( num_nodes ),
+    uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+    netuit::AssignRoundRobin<uitsl::proc_id_t>{ num_procs }
+  };
+  auto submesh = mesh.GetSubmesh();
+
+  int step{};
+  size_t num_fresh{};
+  size_t num_gets{};
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+  // benchmark
+  for (auto _ : state) {
+
+    if (do_puts) for (auto& node : submesh) {
+      for (auto& output : node.GetOutputs()) {
+        output.TryPut( step );
+        output.TryFlush();
+      }
+    }
+
+    for (auto& node : submesh) for (auto& input : node.GetInputs()) {
+      num_fresh += input.Jump() != 0;
+      ++num_gets;
+      benchmark::DoNotOptimize( input.Get() );
+    }
+
+    ++step;
+
+  }
+
+  // log results
+  state.counters.insert({
+    {
+      "Inputs Per Process",
+      benchmark::Counter( state.range(0), benchmark::Counter::kAvgThreads )
+    },
+    {
+      "Fresh Get Fraction",
+      benchmark::Counter(
+        num_gets ? num_fresh / static_cast<double>(num_gets) : 0.0,
+        benchmark::Counter::kAvgThreads
+      )
+    },
+    {
+      "Processes",
+      benchmark::Counter(
+        uitsl::get_nprocs(),
+        benchmark::Counter::kAvgThreads
+      )
+    }
+  });
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+}
+
+template<template<typename> typename ProcDuct>
+void register_progress_poll(const std::string& duct_name) {
+
+  auto res = benchmark::RegisterBenchmark(
+    emp::to_string("ProgressPoll/", duct_name).c_str(),
+    ProgressPoll<ProcDuct>
+  )->ArgsProduct({ {1, 16, 256}, {0, 1} });
+
+  uitsl::report_confidence(res);
+
+  // every proc must step its mesh the same number of times
+  res->Iterations( std::kilo::num );
+
+}
+
+const uitsl::ScopeGuard register_benchmarks( [](){
+  register_progress_poll<uit::t::IriOriDuct>( "IriOriDuct" );
+  register_progress_poll<uit::t::IpriOpriDuct>( "IpriOpriDuct" );
+} );
+
+int main(int argc, char** argv) {
+
+  // suppress json output for non-root procs
+  int one{1};
+  benchmark::Initialize(
+    uitsl::is_root() ? &argc : &one,
+    argv
+  );
+
+  benchmark::RunSpecifiedBenchmarks();
+
+}
@@ -0,0 +1,195 @@
+#include <array>
+#include <chrono>
+#include <limits>
+#include <ratio>
+#include <stddef.h>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <mpi.h>
+
+#include "../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "uitsl/debug/benchmark_utils.hpp"
+#include "uitsl/mpi/MpiMultithreadGuard.hpp"
+#include "uitsl/mpi/mpi_utils.hpp"
+#include "uitsl/nonce/ScopeGuard.hpp"
+
+#include "uit/ducts/intra/put=dropping+get=stepping+type=any/a::SerialPendingDuct.hpp"
+#include "uit/ducts/mock/ThrowDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=stepping+type=trivial/inlet=ProgressRingIsend+outlet=ProgressRingIrecv_t::IpriOpriDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+#include "uit/setup/ProgressPolicy.hpp"
+
+#include "netuit/arrange/DyadicTopologyFactory.hpp"
+#include "netuit/assign/AssignAvailableProcs.hpp"
+#include "netuit/mesh/Mesh.hpp"
+
+// the progress thread calls into MPI alongside the main thread
+const uitsl::MpiMultithreadGuard guard;
+
+using steady_clock_t = std::chrono::steady_clock;
+
+template<size_t Bytes>
+struct Message {
+  // when this message was put
+  steady_clock_t::time_point sent;
+  // sent time of the latest message the putting node had received
+  steady_clock_t::time_point echo;
+  std::array<char, Bytes> payload;
+};
+
+template<size_t Bytes, typename ProgressPolicy>
+using Spec = uit::ImplSpec<
+  Message<Bytes>,
+  uit::ImplSelect<
+    uit::a::SerialPendingDuct, uit::ThrowDuct, uit::t::IpriOpriDuct
+  >,
+  uit::DefaultSpoutWrapper,
+  uit::DEFAULT_BUFFER,
+  std::numeric_limits<size_t>::max(),
+  2,
+  uit::ManualFlushPolicy,
+  ProgressPolicy
+>;
+
+// dyad partners each compute, put, then jump to their partner's latest
+// message, as cells with long compute phases would
+// each message echoes the latest one received, so round trips are timed on
+// one clock: from a put until a message echoing it is got, which includes
+// up to a step of the partner's compute
+// state.range(0): units of compute work per step
+template<size_t Bytes, typename ProgressPolicy>
+static void ProgressThreadLatency(benchmark::State& state) {
+
+  const size_t work = state.range(0);
+
+  // prevent tags from overflowing over many setups
+  netuit::internal::MeshIDCounter::Reset();
+
+  netuit::Mesh<Spec<Bytes, ProgressPolicy>> mesh{
+    netuit::DyadicTopologyFactory{}( uitsl::get_nprocs() ),
+    uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+    netuit::AssignAvailableProcs{}
+  };
+  auto node = mesh.GetSubmesh().front();
+  auto& input = node.GetInput(0);
+  auto& output = node.GetOutput(0);
+
+  steady_clock_t::time_point latest_received{};
+  steady_clock_t::time_point latest_echo{};
+  std::chrono::duration<double, std::micro> round_trips{};
+  size_t num_round_trips{};
+  size_t num_fresh{};
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+  // benchmark
+  for (auto _ : state) {
+
+    uitsl::do_compute_work( work );
+
+    output.TryPut( { steady_clock_t::now(), latest_received, {} } );
+    output.TryFlush();
+
+    if ( input.Jump() ) {
+      ++num_fresh;
+      const auto& message = input.Get();
+      latest_received = message.sent;
+      if (
+        message.echo != steady_clock_t::time_point{}
+        && message.echo != latest_echo
+      ) {
+        latest_echo = message.echo;
+        round_trips += steady_clock_t::now() - message.echo;
+        ++num_round_trips;
+      }
+    }
+
+  }
+
+  // log results
+  state.counters.insert({
+    {
+      "Compute Work per Step",
+      benchmark::Counter( work, benchmark::Counter::kAvgThreads )
+    },
+    {
+      "Message Bytes",
+      benchmark::Counter(
+        sizeof(Message<Bytes>),
+        benchmark::Counter::kAvgThreads
+      )
+    },
+    {
+      "Mean Round Trip us",
+      benchmark::Counter(
+        num_round_trips ? round_trips.count() / num_round_trips : 0.0,
+        benchmark::Counter::kAvgThreads
+      )
+    },
+    {
+      "Round Trips Timed",
+      benchmark::Counter( num_round_trips, benchmark::Counter::kAvgThreads )
+    },
+    {
+      "Fresh Get Fraction",
+      benchmark::Counter(
+        num_fresh / static_cast<double>( state.iterations() ),
+        benchmark::Counter::kAvgThreads
+      )
+    },
+    {
+      "Processes",
+      benchmark::Counter(
+        uitsl::get_nprocs(),
+        benchmark::Counter::kAvgThreads
+      )
+    }
+  });
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+}
+
+template<size_t Bytes, typename ProgressPolicy>
+void register_progress_thread_latency(const std::string& policy_name) {
+
+  auto res = benchmark::RegisterBenchmark(
+    emp::to_string(
+      "ProgressThreadLatency/", policy_name, "/", sizeof(Message<Bytes>)
+    ).c_str(),
+    ProgressThreadLatency<Bytes, ProgressPolicy>
+  )->Arg(0)->Arg(std::kilo::num)->Arg(100 * std::kilo::num);
+
+  uitsl::report_confidence(res);
+
+  // dyad partners must step the same number of times
+  res->Iterations( std::kilo::num );
+
+}
+
+const uitsl::ScopeGuard register_benchmarks( [](){
+  // small messages go eager, large ones need rendezvous progress
+  register_progress_thread_latency<8, uit::InlineProgressPolicy>( "inline" );
+  register_progress_thread_latency<8, uit::ThreadProgressPolicy>( "thread" );
+  register_progress_thread_latency<65536, uit::InlineProgressPolicy>(
+    "inline"
+  );
+  register_progress_thread_latency<65536, uit::ThreadProgressPolicy>(
+    "thread"
+  );
+} );
+
+int main(int argc, char** argv) {
+
+  // suppress json output for non-root procs
+  int one{1};
+  benchmark::Initialize(
+    uitsl::is_root() ? &argc : &one,
+    argv
+  );
+
+  benchmark::RunSpecifiedBenchmarks();
+
+}
@@ -0,0 +1,132 @@
+#include <array>
+#include <ratio>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <mpi.h>
+
+#include "../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "uitsl/debug/benchmark_utils.hpp"
+#include "uitsl/mpi/MpiGuard.hpp"
+#include "uitsl/mpi/mpi_utils.hpp"
+#include "uitsl/nonce/ScopeGuard.hpp"
+
+#include "uit/ducts/intra/accumulating+type=any/a::AccumulatingDuct.hpp"
+#include "uit/ducts/intra/put=dropping+get=stepping+type=any/a::SerialPendingDuct.hpp"
+#include "uit/ducts/mock/ThrowDuct.hpp"
+#include "uit/ducts/proc/accumulating+type=fundamental/inlet=Accumulate+outlet=WithdrawingWindow_f::IaOwwDuct.hpp"
+#include "uit/ducts/proc/accumulating+type=fundamental/inlet=NotifyAccumulate+outlet=CounterWithdrawingWindow_f::InaOcwwDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=skipping+type=trivial/inlet=FlushRput+outlet=SyncWindow_t::IfrOswDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=skipping+type=trivial/inlet=NotifyRput+outlet=CounterWindow_t::InrOcwDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=skipping+type=trivial/inlet=RingRput+outlet=Window_t::IrrOwDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+#include "netuit/arrange/DyadicTopologyFactory.hpp"
+#include "netuit/assign/AssignAvailableProcs.hpp"
+#include "netuit/mesh/Mesh.hpp"
+
+const uitsl::MpiGuard guard;
+
+template<size_t NumBytes>
+using payload_t = std::array<char, NumBytes>;
+
+// polls on an outlet that has received one value and nothing since
+template<typename Spec>
+static void RdmaPoll(benchmark::State& state) {
+
+  // prevent tags from overflowing over many setups
+  netuit::internal::MeshIDCounter::Reset();
+  netuit::Mesh<Spec> mesh{
+    netuit::DyadicTopologyFactory{}( uitsl::get_nprocs() ),
+    uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+    netuit::AssignAvailableProcs{}
+  };
+  auto submesh = mesh.GetSubmesh();
+  auto input = submesh.front().GetInput(0);
+  auto output = submesh.front().GetOutput(0);
+
+  output.TryPut( typename Spec::T{} );
+  output.TryFlush();
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+  // benchmark
+  for (auto _ : state) benchmark::DoNotOptimize( input.JumpGet() );
+
+  // log results
+  state.counters.insert({
+    {
+      "Payload Bytes",
+      benchmark::Counter(
+        sizeof(typename Spec::T), benchmark::Counter::kAvgThreads
+      )
+    }
+  });
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+}
+
+template<template<typename> typename ProcDuct, size_t NumBytes>
+void register_trivial_poll(const std::string& duct_name) {
+
+  using Spec = uit::ImplSpec<
+    payload_t<NumBytes>,
+    uit::ImplSelect<uit::a::SerialPendingDuct, uit::ThrowDuct, ProcDuct>
+  >;
+
+  auto res = benchmark::RegisterBenchmark(
+    emp::to_string("RdmaPoll/", duct_name, "/bytes:", NumBytes).c_str(),
+    RdmaPoll<Spec>
+  );
+  uitsl::report_confidence(res);
+  // every proc must tear down the same meshes
+  res->Iterations( 10 * std::kilo::num );
+
+}
+
+template<template<typename> typename ProcDuct>
+void register_accumulating_poll(const std::string& duct_name) {
+
+  using Spec = uit::ImplSpec<
+    double,
+    uit::ImplSelect<uit::a::AccumulatingDuct, uit::ThrowDuct, ProcDuct>
+  >;
+
+  auto res = benchmark::RegisterBenchmark(
+    emp::to_string("RdmaPoll/", duct_name).c_str(),
+    RdmaPoll<Spec>
+  );
+  uitsl::report_confidence(res);
+  res->Iterations( 10 * std::kilo::num );
+
+}
+
+template<template<typename> typename ProcDuct>
+void register_trivial_polls(const std::string& duct_name) {
+  register_trivial_poll<ProcDuct, 8>( duct_name );
+  register_trivial_poll<ProcDuct, 512>( duct_name );
+  register_trivial_poll<ProcDuct, 4096>( duct_name );
+  register_trivial_poll<ProcDuct, 32768>( duct_name );
+}
+
+const uitsl::ScopeGuard register_benchmarks( [](){
+  register_trivial_polls<uit::t::IrrOwDuct>( "IrrOwDuct" );
+  register_trivial_polls<uit::t::IfrOswDuct>( "IfrOswDuct" );
+  register_trivial_polls<uit::t::InrOcwDuct>( "InrOcwDuct" );
+  register_accumulating_poll<uit::f::IaOwwDuct>( "IaOwwDuct" );
+  register_accumulating_poll<uit::f::InaOcwwDuct>( "InaOcwwDuct" );
+} );
+
+int main(int argc, char** argv) {
+
+  // suppress json output for non-root procs
+  int one{1};
+  benchmark::Initialize(
+    uitsl::is_root() ? &argc : &one,
+    argv
+  );
+
+  benchmark::RunSpecifiedBenchmarks();
+
+}
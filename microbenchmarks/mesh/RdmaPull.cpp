@@ -0,0 +1,120 @@
+#include <array>
+#include <ratio>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <mpi.h>
+
+#include "../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "uitsl/debug/benchmark_utils.hpp"
+#include "uitsl/mpi/MpiGuard.hpp"
+#include "uitsl/mpi/mpi_utils.hpp"
+#include "uitsl/nonce/ScopeGuard.hpp"
+
+#include "uit/ducts/intra/put=dropping+get=stepping+type=any/a::SerialPendingDuct.hpp"
+#include "uit/ducts/mock/ThrowDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=skipping+type=trivial/inlet=Expose+outlet=PrefetchRget_t::IeOprDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=skipping+type=trivial/inlet=Expose+outlet=Rget_t::IeOrDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=skipping+type=trivial/inlet=FlushRput+outlet=SyncWindow_t::IfrOswDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+#include "netuit/arrange/DyadicTopologyFactory.hpp"
+#include "netuit/assign/AssignAvailableProcs.hpp"
+#include "netuit/mesh/Mesh.hpp"
+
+const uitsl::MpiGuard guard;
+
+using payload_t = std::array<char, 4096>;
+
+template<template<typename> typename ProcDuct>
+using Spec = uit::ImplSpec<
+  payload_t,
+  uit::ImplSelect<uit::a::SerialPendingDuct, uit::ThrowDuct, ProcDuct>
+>;
+
+// state.range(0): number of puts per get
+template<template<typename> typename ProcDuct>
+static void RdmaPull(benchmark::State& state) {
+
+  const size_t puts_per_get = state.range(0);
+
+  // prevent tags from overflowing over many setups
+  netuit::internal::MeshIDCounter::Reset();
+  netuit::Mesh<Spec<ProcDuct>> mesh{
+    netuit::DyadicTopologyFactory{}( uitsl::get_nprocs() ),
+    uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+    netuit::AssignAvailableProcs{}
+  };
+  auto submesh = mesh.GetSubmesh();
+  auto input = submesh.front().GetInput(0);
+  auto output = submesh.front().GetOutput(0);
+
+  size_t num_fresh{};
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+  // benchmark
+  for (auto _ : state) {
+    for (size_t i{}; i < puts_per_get; ++i) output.TryPut( payload_t{} );
+    output.TryFlush();
+    num_fresh += input.Jump() != 0;
+    benchmark::DoNotOptimize( input.Get() );
+  }
+
+  // log results
+  state.counters.insert({
+    {
+      "Puts per Get",
+      benchmark::Counter( puts_per_get, benchmark::Counter::kAvgThreads )
+    },
+    {
+      "Payload Bytes",
+      benchmark::Counter( sizeof(payload_t), benchmark::Counter::kAvgThreads )
+    },
+    {
+      "Fresh Get Fraction",
+      benchmark::Counter(
+        num_fresh / static_cast<double>( state.iterations() ),
+        benchmark::Counter::kAvgThreads
+      )
+    }
+  });
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+}
+
+template<template<typename> typename ProcDuct>
+void register_rdma_pull(const std::string& duct_name) {
+
+  auto res = benchmark::RegisterBenchmark(
+    emp::to_string("RdmaPull/", duct_name).c_str(),
+    RdmaPull<ProcDuct>
+  )->Arg(1)->Arg(16)->Arg(256);
+
+  uitsl::report_confidence(res);
+
+  // every proc must step its mesh the same number of times
+  res->Iterations( std::kilo::num );
+
+}
+
+const uitsl::ScopeGuard register_benchmarks( [](){
+  register_rdma_pull<uit::t::IfrOswDuct>( "IfrOswDuct" );
+  register_rdma_pull<uit::t::IeOrDuct>( "IeOrDuct" );
+  register_rdma_pull<uit::t::IeOprDuct>( "IeOprDuct" );
+} );
+
+int main(int argc, char** argv) {
+
+  // suppress json output for non-root procs
+  int one{1};
+  benchmark::Initialize(
+    uitsl::is_root() ? &argc : &one,
+    argv
+  );
+
+  benchmark::RunSpecifiedBenchmarks();
+
+}
@@ -0,0 +1,151 @@
+#include <ratio>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <mpi.h>
+
+#include "../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "uitsl/debug/benchmark_utils.hpp"
+#include "uitsl/mpi/MpiGuard.hpp"
+#include "uitsl/mpi/mpi_utils.hpp"
+#include "uitsl/nonce/ScopeGuard.hpp"
+
+#include "uit/ducts/intra/put=dropping+get=stepping+type=any/a::SerialPendingDuct.hpp"
+#include "uit/ducts/mock/ThrowDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=skipping+type=trivial/inlet=FlushRput+outlet=SyncWindow_t::IfrOswDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=skipping+type=trivial/inlet=RingRput+outlet=Window_t::IrrOwDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+#include "netuit/arrange/CompleteTopologyFactory.hpp"
+#include "netuit/assign/AssignAvailableProcs.hpp"
+#include "netuit/mesh/Mesh.hpp"
+
+const uitsl::MpiGuard guard;
+
+template<template<typename> typename ProcDuct>
+using Spec = uit::ImplSpec<
+  int,
+  uit::ImplSelect<
+    uit::a::SerialPendingDuct,
+    uit::ThrowDuct,
+    ProcDuct
+  >
+>;
+
+// one node per proc, so every proc has an RDMA duct to and from every other
+template<template<typename> typename ProcDuct>
+netuit::Mesh<Spec<ProcDuct>> make_mesh() {
+  // prevent tags from overflowing over many setups
+  netuit::internal::MeshIDCounter::Reset();
+  return netuit::Mesh<Spec<ProcDuct>>{
+    netuit::CompleteTopologyFactory{}( uitsl::get_nprocs() ),
+    uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+    netuit::AssignAvailableProcs{}
+  };
+}
+
+template<template<typename> typename ProcDuct>
+static void RdmaSetup(benchmark::State& state) {
+
+  // benchmark
+  for (auto _ : state) {
+    // window setup is collective, so teardown has to finish everywhere first
+    auto mesh = make_mesh<ProcDuct>();
+    benchmark::DoNotOptimize( mesh.GetSubmesh() );
+    state.PauseTiming();
+    UITSL_Barrier( MPI_COMM_WORLD );
+    state.ResumeTiming();
+  }
+
+  // log results
+  state.counters.insert({
+    {
+      "Peers",
+      benchmark::Counter(
+        uitsl::get_nprocs() - 1, benchmark::Counter::kAvgThreads
+      )
+    }
+  });
+
+}
+
+template<template<typename> typename ProcDuct>
+static void RdmaPut(benchmark::State& state) {
+
+  auto mesh = make_mesh<ProcDuct>();
+  auto submesh = mesh.GetSubmesh();
+
+  size_t num_puts{};
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+  // benchmark
+  for (auto _ : state) {
+    for (auto& node : submesh) for (auto& output : node.GetOutputs()) {
+      output.TryPut( num_puts );
+      ++num_puts;
+    }
+    for (auto& node : submesh) for (auto& output : node.GetOutputs()) {
+      output.TryFlush();
+    }
+    for (auto& node : submesh) for (auto& input : node.GetInputs()) {
+      benchmark::DoNotOptimize( input.JumpGet() );
+    }
+  }
+
+  // log results
+  state.counters.insert({
+    {
+      "Peers",
+      benchmark::Counter(
+        uitsl::get_nprocs() - 1, benchmark::Counter::kAvgThreads
+      )
+    },
+    {
+      "Puts",
+      benchmark::Counter( num_puts, benchmark::Counter::kIsRate )
+    }
+  });
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+}
+
+template<template<typename> typename ProcDuct>
+void register_rdma_benchmarks(const std::string& duct_name) {
+
+  auto setup = benchmark::RegisterBenchmark(
+    emp::to_string("RdmaSetup/", duct_name).c_str(),
+    RdmaSetup<ProcDuct>
+  );
+  uitsl::report_confidence(setup);
+  // every proc must take part in the same number of window setups
+  setup->Iterations( std::hecto::num );
+
+  auto put = benchmark::RegisterBenchmark(
+    emp::to_string("RdmaPut/", duct_name).c_str(),
+    RdmaPut<ProcDuct>
+  );
+  uitsl::report_confidence(put);
+  put->Iterations( 10 * std::kilo::num );
+
+}
+
+const uitsl::ScopeGuard register_benchmarks( [](){
+  register_rdma_benchmarks<uit::t::IrrOwDuct>( "IrrOwDuct" );
+  register_rdma_benchmarks<uit::t::IfrOswDuct>( "IfrOswDuct" );
+} );
+
+int main(int argc, char** argv) {
+
+  // suppress json output for non-root procs
+  int one{1};
+  benchmark::Initialize(
+    uitsl::is_root() ? &argc : &one,
+    argv
+  );
+
+  benchmark::RunSpecifiedBenchmarks();
+
+}
@@ -0,0 +1,138 @@
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <mpi.h>
+
+#include "../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "uitsl/debug/benchmark_utils.hpp"
+#include "uitsl/debug/safe_cast.hpp"
+#include "uitsl/mpi/MpiGuard.hpp"
+#include "uitsl/mpi/mpi_utils.hpp"
+#include "uitsl/nonce/ScopeGuard.hpp"
+#include "uitsl/utility/assign_utils.hpp"
+
+#include "uit/ducts/intra/put=dropping+get=stepping+type=any/a::SerialPendingDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=skipping+type=trivial/inlet=IneighborPut+outlet=IneighborGet_t::IipOigDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=stepping+type=trivial/inlet=RingIsend+outlet=RingIrecv_t::IriOriDuct.hpp"
+#include "uit/ducts/thread/put=dropping+get=stepping+type=any/a::AtomicPendingDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+#include "netuit/arrange/ToroidalGridTopologyFactory.hpp"
+#include "netuit/assign/AssignContiguously.hpp"
+#include "netuit/mesh/Mesh.hpp"
+
+const uitsl::MpiGuard guard;
+
+// state.range(0): side length of square toroidal grid
+// state.range(1): units of compute work per node per step
+template<template<typename> typename ProcDuct>
+static void ToroidalGridExchange(benchmark::State& state) {
+
+  using Spec = uit::ImplSpec<
+    int,
+    uit::ImplSelect<
+      uit::a::SerialPendingDuct,
+      uit::a::AtomicPendingDuct,
+      ProcDuct
+    >
+  >;
+
+  const size_t num_nodes = state.range(0) * state.range(0);
+  const size_t compute_work = state.range(1);
+
+  // set up
+  netuit::Mesh<Spec> mesh{
+    netuit::ToroidalGridTopologyFactory{}( num_nodes ),
+    uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+    netuit::AssignContiguously<uitsl::proc_id_t>{
+      uitsl::safe_cast<size_t>( uitsl::get_nprocs() ), num_nodes
+    }
+  };
+  auto submesh = mesh.GetSubmesh();
+
+  int step{};
+  size_t num_fresh{};
+  size_t num_gets{};
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+  // benchmark
+  for (auto _ : state) {
+
+    for (auto& node : submesh) {
+      uitsl::do_compute_work( compute_work );
+      for (auto& output : node.GetOutputs()) {
+        output.TryPut( step );
+        output.TryFlush();
+      }
+    }
+
+    for (auto& node : submesh) for (auto& input : node.GetInputs()) {
+      num_fresh += input.Jump() != 0;
+      ++num_gets;
+      benchmark::DoNotOptimize( input.Get() );
+    }
+
+    ++step;
+
+  }
+
+  // log results
+  state.counters.insert({
+    {
+      "Nodes",
+      benchmark::Counter( num_nodes, benchmark::Counter::kAvgThreads )
+    },
+    {
+      "Fresh Get Fraction",
+      benchmark::Counter(
+        num_gets ? num_fresh / static_cast<double>(num_gets) : 0.0,
+        benchmark::Counter::kAvgThreads
+      )
+    },
+    {
+      "Processes",
+      benchmark::Counter(
+        uitsl::get_nprocs(),
+        benchmark::Counter::kAvgThreads
+      )
+    }
+  });
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+}
+
+template<template<typename> typename ProcDuct>
+void register_toroidal_grid_exchange(const std::string& duct_name) {
+
+  auto res = benchmark::RegisterBenchmark(
+    emp::to_string("ToroidalGridExchange/", duct_name).c_str(),
+    ToroidalGridExchange<ProcDuct>
+  )->ArgsProduct({ {8, 32, 64}, {0, 100} });
+
+  uitsl::report_confidence(res);
+
+  // every proc must step its mesh the same number of times
+  res->Iterations( std::kilo::num );
+
+}
+
+const uitsl::ScopeGuard register_benchmarks( [](){
+  register_toroidal_grid_exchange<uit::t::IriOriDuct>( "IriOriDuct" );
+  register_toroidal_grid_exchange<uit::t::IipOigDuct>( "IipOigDuct" );
+} );
+
+int main(int argc, char** argv) {
+
+  // suppress json output for non-root procs
+  int one{1};
+  benchmark::Initialize(
+    uitsl::is_root() ? &argc : &one,
+    argv
+  );
+
+  benchmark::RunSpecifiedBenchmarks();
+
+}
@@ -0,0 +1,21 @@
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "netuit/arrange/ImplicitLoopTopology.hpp"
+#include "netuit/arrange/LoopTopologyFactory.hpp"
+
+TEST_CASE("Test ImplicitLoopTopology", "[nproc:1]") {
+
+  for (const size_t cardinality : { 0, 1, 2, 7, 100 }) {
+
+    const netuit::ImplicitLoopTopology implicit{ cardinality };
+    const netuit::Topology expected = netuit::make_loop_topology( cardinality );
+    const netuit::Topology topology = implicit.ToTopology();
+
+    REQUIRE( topology.GetSize() == expected.GetSize() );
+    for (size_t node_id{}; node_id < expected.GetSize(); ++node_id) {
+      REQUIRE( topology[node_id] == expected[node_id] );
+    }
+
+  }
+
+}
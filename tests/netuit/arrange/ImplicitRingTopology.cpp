@@ -0,0 +1,21 @@
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "netuit/arrange/ImplicitRingTopology.hpp"
+#include "netuit/arrange/RingTopologyFactory.hpp"
+
+TEST_CASE("Test ImplicitRingTopology", "[nproc:1]") {
+
+  for (const size_t cardinality : { 0, 1, 2, 7, 100 }) {
+
+    const netuit::ImplicitRingTopology implicit{ cardinality };
+    const netuit::Topology expected = netuit::make_ring_topology( cardinality );
+    const netuit::Topology topology = implicit.ToTopology();
+
+    REQUIRE( topology.GetSize() == expected.GetSize() );
+    for (size_t node_id{}; node_id < expected.GetSize(); ++node_id) {
+      REQUIRE( topology[node_id] == expected[node_id] );
+    }
+
+  }
+
+}
@@ -0,0 +1,36 @@
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "netuit/arrange/ImplicitToroidalGridTopology.hpp"
+#include "netuit/arrange/ToroidalGridTopologyFactory.hpp"
+
+TEST_CASE("Test ImplicitToroidalGridTopology", "[nproc:1]") {
+
+  for (const size_t dimension : { 1, 2, 3, 10 }) {
+
+    const netuit::ImplicitToroidalGridTopology implicit{
+      {dimension, dimension}
+    };
+    const netuit::Topology expected = netuit::make_toroidal_grid_topology(
+      {dimension, dimension}
+    );
+    const netuit::Topology topology = implicit.ToTopology();
+
+    REQUIRE( topology.GetSize() == expected.GetSize() );
+    for (size_t node_id{}; node_id < expected.GetSize(); ++node_id) {
+      REQUIRE( topology[node_id] == expected[node_id] );
+    }
+
+  }
+
+}
+
+TEST_CASE("Test ImplicitToroidalGridTopology neighbors", "[nproc:1]") {
+
+  const netuit::ImplicitToroidalGridTopology topology{ 9 };
+
+  REQUIRE( topology.GetSize() == 9 );
+  // north, west, east, south
+  REQUIRE( topology.GetNeighbors( 4 ) == emp::vector<size_t>{ 1, 3, 5, 7 } );
+  REQUIRE( topology.GetNeighbors( 0 ) == emp::vector<size_t>{ 6, 2, 1, 3 } );
+
+}
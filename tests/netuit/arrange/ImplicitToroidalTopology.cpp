@@ -0,0 +1,43 @@
+#include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "netuit/arrange/ImplicitToroidalTopology.hpp"
+#include "netuit/arrange/ToroidalTopologyFactory.hpp"
+
+TEST_CASE("Test ImplicitToroidalTopology", "[nproc:1]") {
+
+  for (const auto& dims : emp::vector<uitsl::Dims>{
+    {3}, {10}, {3, 4}, {5, 3}, {3, 3, 3}, {3, 4, 5, 3}
+  }) {
+
+    const netuit::ImplicitToroidalTopology implicit{ dims };
+    const netuit::Topology expected = netuit::make_toroidal_topology( dims );
+    const netuit::Topology topology = implicit.ToTopology();
+
+    REQUIRE( topology.GetSize() == expected.GetSize() );
+    for (size_t node_id{}; node_id < expected.GetSize(); ++node_id) {
+      REQUIRE( topology[node_id] == expected[node_id] );
+    }
+
+  }
+
+}
+
+TEST_CASE("Test ImplicitToroidalTopology hypercube", "[nproc:1]") {
+
+  const netuit::ImplicitToroidalTopology topology{ {2, 2, 2} };
+
+  REQUIRE( topology.GetSize() == 8 );
+  REQUIRE( topology.GetDegree( 0 ) == 6 );
+  // up each dimension, then down each in reverse order
+  REQUIRE(
+    topology.GetNeighbors( 0 ) == emp::vector<size_t>{ 1, 2, 4, 4, 2, 1 }
+  );
+
+  // each direction is its own edge, even between the same pair of nodes
+  const netuit::Topology materialized = topology.ToTopology();
+  const auto [x_adj, adjacency] = materialized.AsCSR();
+  REQUIRE( adjacency.size() == 48 );
+  REQUIRE( topology.GetEdgeID( 0, 4 ) == 2 * 8 + 0 );
+
+}
@@ -1,11 +1,108 @@
-#include <fstream>
+#include <cstdlib>
 
 #include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
 
-#include "netuit/arrange/NavigableSmallWorldTopologyFactory.hpp"
+#include "uitsl/math/mapping_utils.hpp"
 
-#include "NetworkXTester.hpp"
+#include "netuit/arrange/NavigableSmallWorldTopologyFactory.hpp"
 
 TEST_CASE("Test NavigableSmallWorldTopologyFactory", "[nproc:1]") {
-  REQUIRE(test_all_adj(netuit::NavigableSmallWorldTopologyFactory{}));
+
+  for (const size_t cardinality : { 3, 10, 15, 27 }) {
+    const netuit::Topology topology
+      = netuit::NavigableSmallWorldTopologyFactory{}( cardinality );
+    REQUIRE( topology.GetSize() == cardinality );
+  }
+
+  REQUIRE(
+    netuit::NavigableSmallWorldTopologyFactory{}( {4, 4} ).GetSize() == 16
+  );
+
+}
+
+TEST_CASE("Test navigable small world short-range links", "[nproc:1]") {
+
+  for (const size_t dim : { 1, 2, 3 }) {
+
+    const size_t side = 6;
+    const size_t p = 2;
+    const size_t q = 3;
+    const netuit::internal::NavigableSmallWorldGenerator generator(
+      side, p, q, 2.0, dim, 1
+    );
+    const uitsl::Dims dims( dim, side );
+
+    for (size_t node{}; node < generator.GetNumNodes(); ++node) {
+
+      const auto neighbors = generator.GetNeighbors( node );
+      const auto coords = uitsl::linear_decode( node, dims );
+
+      size_t num_short{};
+      for (size_t other{}; other < generator.GetNumNodes(); ++other) {
+        const auto other_coords = uitsl::linear_decode( other, dims );
+        size_t distance{};
+        for (size_t d{}; d < dim; ++d) distance += std::abs(
+          static_cast<long>( coords[d] ) - static_cast<long>( other_coords[d] )
+        );
+        if ( distance && distance <= p ) {
+          ++num_short;
+          REQUIRE( std::count(
+            std::begin(neighbors), std::end(neighbors), other
+          ) == 1 );
+        }
+      }
+
+      REQUIRE( neighbors.size() >= num_short );
+      REQUIRE( neighbors.size() <= num_short + q );
+      REQUIRE( !std::count( std::begin(neighbors), std::end(neighbors), node ) );
+
+    }
+
+  }
+
+}
+
+TEST_CASE("Test navigable small world long-range links", "[nproc:1]") {
+
+  // with no short-range links, every link is long-range
+  const size_t side = 2000;
+  const netuit::internal::NavigableSmallWorldGenerator generator(
+    side, 0, 1, 2.0, 1, 1
+  );
+
+  size_t num_adjacent{}, num_links{};
+  // skip nodes near the ends, which have fewer candidates
+  for (size_t node = side / 4; node < 3 * side / 4; ++node) {
+    for (const size_t neighbor : generator.GetNeighbors( node )) {
+      ++num_links;
+      num_adjacent += neighbor + 1 == node || node + 1 == neighbor;
+    }
+  }
+
+  // away from the ends, the chance of linking to an adjacent node is
+  // 1 / zeta(2), about 0.61
+  REQUIRE( num_links == side / 2 );
+  const double fraction = static_cast<double>( num_adjacent ) / num_links;
+  REQUIRE( fraction > 0.55 );
+  REQUIRE( fraction < 0.67 );
+
+}
+
+TEST_CASE("Test make_navigable_small_world_csr_topology", "[nproc:1]") {
+
+  const auto topology = netuit::make_navigable_small_world_csr_topology(
+    20, 1, 2, 2.0, 2, 7, 3
+  );
+
+  REQUIRE( topology.GetSize() == 400 );
+
+  // same seed, same graph, however many threads
+  REQUIRE( topology.AsCSR() == netuit::make_navigable_small_world_csr_topology(
+    20, 1, 2, 2.0, 2, 7, 1
+  ).AsCSR() );
+  REQUIRE( topology.AsCSR() == netuit::make_navigable_small_world_topology(
+    20, 1, 2, 2.0, 2, 7, 2
+  ).AsCSR() );
+
 }
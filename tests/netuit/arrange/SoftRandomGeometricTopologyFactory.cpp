@@ -1,11 +1,75 @@
-#include <fstream>
+#include <utility>
 
 #include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
 
 #include "netuit/arrange/SoftRandomGeometricTopologyFactory.hpp"
 
-#include "NetworkXTester.hpp"
-
 TEST_CASE("Test SoftRandomGeometricTopologyFactory", "[nproc:1]") {
-  REQUIRE(test_all_adj(netuit::SoftRandomGeometricTopologyFactory{}));
+
+  for (const size_t cardinality : { 3, 10, 15, 27 }) {
+    const netuit::Topology topology
+      = netuit::SoftRandomGeometricTopologyFactory{}( cardinality );
+    REQUIRE( topology.GetSize() == cardinality );
+  }
+
+}
+
+TEST_CASE("Test soft random geometric spatial hashing", "[nproc:1]") {
+
+  for (const size_t dim : { 1, 2, 3 }) {
+    for (const double radius : { 0.05, 0.2, 1.5 }) {
+
+      const netuit::internal::SoftRandomGeometricGenerator generator(
+        300, radius, dim, 1, 4
+      );
+
+      // check every pair instead of neighboring cells
+      emp::vector<std::pair<size_t, size_t>> expected;
+      for (size_t a{}; a < generator.GetNumNodes(); ++a) {
+        for (size_t b = a + 1; b < generator.GetNumNodes(); ++b) {
+          if ( generator.IsLinked(a, b) ) expected.emplace_back( a, b );
+        }
+      }
+
+      REQUIRE( generator.GetEdges( 4 ) == expected );
+      REQUIRE( generator.GetEdges( 1 ) == expected );
+
+      for (const auto& [a, b] : expected) {
+        REQUIRE( generator.GetDistance(a, b) <= radius );
+      }
+
+    }
+  }
+
+}
+
+TEST_CASE("Test make_soft_random_geometric_csr_topology", "[nproc:1]") {
+
+  const auto topology = netuit::make_soft_random_geometric_csr_topology(
+    1000, 0.1, 2, 1, 3
+  );
+
+  REQUIRE( topology.GetSize() == 1000 );
+  REQUIRE( topology.GetNumEdges() > 0 );
+
+  // same seed, same graph, however many threads
+  REQUIRE( topology.AsCSR() == netuit::make_soft_random_geometric_csr_topology(
+    1000, 0.1, 2, 1, 1
+  ).AsCSR() );
+  REQUIRE( topology.AsCSR() == netuit::make_soft_random_geometric_topology(
+    1000, 0.1, 2, 1, 2
+  ).AsCSR() );
+
+  REQUIRE( topology.AsCSR() != netuit::make_soft_random_geometric_csr_topology(
+    1000, 0.1, 2, 2
+  ).AsCSR() );
+
+  // edges run from lower to higher node ids, as networkx writes them
+  for (size_t node{}; node < topology.GetSize(); ++node) {
+    for (const size_t edge_id : topology.GetOutputEdgeIDs( node )) {
+      REQUIRE( topology.GetOutletNode( edge_id ) > node );
+    }
+  }
+
 }
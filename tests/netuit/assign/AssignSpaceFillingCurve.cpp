@@ -0,0 +1,101 @@
+#include <algorithm>
+
+#include <mpi.h>
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uitsl/math/mapping_utils.hpp"
+
+#include "netuit/arrange/ToroidalTopologyFactory.hpp"
+#include "netuit/assign/AssignContiguously.hpp"
+#include "netuit/assign/AssignSpaceFillingCurve.hpp"
+#include "netuit/assign/EvaluatePartition.hpp"
+#include "netuit/topology/CsrTopology.hpp"
+
+TEST_CASE("Test AssignHilbertCurve") {
+
+  const uitsl::Dims dims{ 16, 16 };
+  const netuit::CsrTopology topology{ netuit::make_toroidal_topology( dims ) };
+
+  const netuit::AssignHilbertCurve<size_t> hilbert{ dims, 16 };
+  const auto curve = netuit::EvaluatePartition( topology, hilbert, 16 );
+  REQUIRE( curve.imbalance.front() == 1.0 );
+
+  // 4x4 blocks instead of one-row slabs
+  const auto slabs = netuit::EvaluatePartition(
+    topology, netuit::AssignContiguously<size_t>{ 16, 256 }, 16
+  );
+  REQUIRE( slabs.num_cut_edges == 512 );
+  REQUIRE( curve.num_cut_edges == 256 );
+
+}
+
+TEST_CASE("Test AssignMortonCurve") {
+
+  const uitsl::Dims dims{ 4, 4, 4 };
+  const netuit::AssignMortonCurve<size_t> morton{ dims, 8 };
+
+  // each part is a 2x2x2 cube
+  for (size_t part{}; part < 8; ++part) {
+    uitsl::Point lo( 3, 4 ), hi( 3, 0 );
+    size_t count{};
+    for (size_t node{}; node < 64; ++node) if ( morton( node ) == part ) {
+      const auto p = uitsl::linear_decode( node, dims );
+      for (size_t d{}; d < 3; ++d) {
+        lo[d] = std::min( lo[d], p[d] );
+        hi[d] = std::max( hi[d], p[d] );
+      }
+      ++count;
+    }
+    REQUIRE( count == 8 );
+    REQUIRE( hi[0] - lo[0] == 1 );
+    REQUIRE( hi[1] - lo[1] == 1 );
+    REQUIRE( hi[2] - lo[2] == 1 );
+  }
+
+}
+
+TEST_CASE("Test AssignSpaceFillingCurve, uneven grid") {
+
+  const uitsl::Dims dims{ 12, 10 };
+  const netuit::CsrTopology topology{ netuit::make_toroidal_topology( dims ) };
+
+  const auto slabs = netuit::EvaluatePartition(
+    topology, netuit::AssignContiguously<size_t>{ 6, 120 }, 6
+  );
+
+  const netuit::AssignHilbertCurve<size_t> hilbert{ dims, 6 };
+  const netuit::AssignMortonCurve<size_t> morton{ dims, 6 };
+  for (const auto& report : {
+    netuit::EvaluatePartition( topology, hilbert, 6 ),
+    netuit::EvaluatePartition( topology, morton, 6 )
+  }) {
+    REQUIRE( report.imbalance.front() == 1.0 );
+    REQUIRE( report.num_cut_edges < slabs.num_cut_edges );
+  }
+
+}
+
+TEST_CASE("Test AssignSpaceFillingCurve, procs then threads") {
+
+  const uitsl::Dims dims{ 9, 7 };
+  const size_t num_procs = 3;
+  const size_t threads_per_proc = 2;
+
+  const netuit::AssignHilbertCurve<size_t> procs{ dims, num_procs };
+  const netuit::AssignHilbertCurve<size_t> threads{
+    dims, threads_per_proc, num_procs
+  };
+  const netuit::AssignHilbertCurve<size_t> slots{
+    dims, num_procs * threads_per_proc
+  };
+
+  // each proc's stretch of curve is split among its threads
+  for (size_t node{}; node < 63; ++node) {
+    REQUIRE( threads( node ) < threads_per_proc );
+    REQUIRE(
+      procs( node ) * threads_per_proc + threads( node ) == slots( node )
+    );
+  }
+
+}
@@ -0,0 +1,74 @@
+#include <mpi.h>
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "netuit/arrange/CompleteTopologyFactory.hpp"
+#include "netuit/arrange/RingTopologyFactory.hpp"
+#include "netuit/assign/EvaluatePartition.hpp"
+#include "netuit/assign/PartitionWeights.hpp"
+#include "netuit/topology/CsrTopology.hpp"
+#include "netuit/topology/Topology.hpp"
+
+TEST_CASE("Test EvaluatePartition, unweighted") {
+
+  const netuit::Topology topology = netuit::make_ring_topology( 8 );
+
+  // halves of a ring are joined by one edge at each end
+  const auto halves = netuit::EvaluatePartition(
+    topology, [](const size_t node){ return node / 4; }, 2
+  );
+  REQUIRE( halves.num_cut_edges == 2 );
+  REQUIRE( halves.edge_cut == 2.0 );
+  REQUIRE( halves.comm_volume == 2 );
+  REQUIRE( halves.imbalance.size() == 1 );
+  REQUIRE( halves.imbalance.front() == 1.0 );
+
+  // dealing nodes out cuts every edge, and parts can't be even
+  const auto dealt = netuit::EvaluatePartition(
+    topology, [](const size_t node){ return node % 3; }, 3
+  );
+  REQUIRE( dealt.num_cut_edges == 8 );
+  REQUIRE( dealt.edge_cut == 8.0 );
+  REQUIRE( dealt.comm_volume == 8 );
+  REQUIRE( dealt.imbalance.front() == 3.0 * 3 / 8 );
+
+  // node 0 sends to both other parts
+  const netuit::Topology complete = netuit::make_complete_topology( 3 );
+  const auto spread = netuit::EvaluatePartition(
+    complete, [](const size_t node){ return node; }, 3
+  );
+  REQUIRE( spread.comm_volume == 6 );
+
+}
+
+TEST_CASE("Test EvaluatePartition, weighted") {
+
+  const netuit::Topology topology = netuit::make_ring_topology( 4 );
+  const netuit::CsrTopology csr_topology{ topology };
+
+  netuit::PartitionWeights weights( 4, 2 );
+  weights.SetNodeWeight( 0, 3.0, 0 );
+  weights.SetNodeWeight( 0, 1.0, 1 );
+  for (size_t node = 1; node < 4; ++node) {
+    weights.SetNodeWeight( node, 1.0, 0 );
+    weights.SetNodeWeight( node, 1.0, 1 );
+  }
+  for (const auto& output : topology[1].GetOutputs()) {
+    weights.AddEdgeWeight( output.GetEdgeID(), 10.0 );
+  }
+
+  const auto assignment = [](const size_t node){ return node / 2; };
+  for (const auto& report : {
+    netuit::EvaluatePartition( topology, assignment, 2, weights ),
+    netuit::EvaluatePartition( csr_topology, assignment, 2, weights )
+  }) {
+    // edges from node 1 to node 2 and from node 3 to node 0 are cut
+    REQUIRE( report.num_cut_edges == 2 );
+    REQUIRE( report.edge_cut == 11.0 );
+    REQUIRE( report.comm_volume == 2 );
+    REQUIRE( report.imbalance.size() == 2 );
+    REQUIRE( report.imbalance[0] == 4.0 * 2 / 6 );
+    REQUIRE( report.imbalance[1] == 1.0 );
+  }
+
+}
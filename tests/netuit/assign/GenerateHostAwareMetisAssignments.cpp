@@ -0,0 +1,138 @@
+#include <unordered_set>
+
+#include <mpi.h>
+
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uitsl/debug/safe_cast.hpp"
+#include "uitsl/mpi/comm_utils.hpp"
+#include "uitsl/mpi/mpi_guard.hpp"
+
+#include "netuit/arrange/ToroidalTopologyFactory.hpp"
+#include "netuit/assign/EvaluatePartition.hpp"
+#include "netuit/assign/GenerateHostAwareMetisAssignments.hpp"
+#include "netuit/topology/CsrTopology.hpp"
+#include "netuit/topology/Topology.hpp"
+
+TEST_CASE("Test GenerateHostAwareMetisAssignments, simulated hosts") {
+
+  const netuit::Topology topology = netuit::make_toroidal_topology( {16, 16} );
+  const size_t threads_per_proc = 2;
+
+  // two ranks per simulated host
+  const auto proc_hosts = uitsl::get_host_ids(
+    [](const uitsl::proc_id_t rank){ return rank / 2; }
+  );
+
+  const auto [proc_assigner, thread_assigner]
+    = netuit::GenerateHostAwareMetisAssignments(
+      proc_hosts, threads_per_proc, topology
+    );
+
+  REQUIRE( proc_assigner.GetSize() == topology.GetSize() );
+  REQUIRE( thread_assigner.GetSize() == topology.GetSize() );
+  for (size_t node = 0; node < topology.GetSize(); ++node) {
+    REQUIRE(
+      uitsl::safe_cast<size_t>( proc_assigner(node) ) < proc_hosts.size()
+    );
+    REQUIRE( thread_assigner(node) < threads_per_proc );
+  }
+
+  // an edge between hosts is also an edge between procs
+  const netuit::CsrTopology csr{ topology };
+  const auto procs = netuit::EvaluatePartition(
+    csr, proc_assigner, proc_hosts.size()
+  );
+  const auto hosts = netuit::EvaluatePartition(
+    csr,
+    [&](const size_t node){ return proc_hosts[ proc_assigner(node) ]; },
+    proc_hosts.back() + 1
+  );
+  REQUIRE( hosts.num_cut_edges <= procs.num_cut_edges );
+
+}
+
+TEST_CASE("Test GenerateHostAwareMetisAssignments, uneven hosts") {
+
+  const netuit::Topology topology = netuit::make_toroidal_topology( {16, 16} );
+
+  // hosts need not have the same number of procs
+  const emp::vector<size_t> proc_hosts{ 0, 0, 1, 1, 1 };
+
+  const auto [proc_assigner, thread_assigner]
+    = netuit::GenerateHostAwareMetisAssignmentFunctors(
+      proc_hosts, 3, topology
+    );
+
+  for (size_t node = 0; node < topology.GetSize(); ++node) {
+    REQUIRE( uitsl::safe_cast<size_t>( proc_assigner(node) ) < 5 );
+    REQUIRE( thread_assigner(node) < 3 );
+  }
+
+}
+
+TEST_CASE("Test GenerateHostAwareMetisAssignments, discovered hosts") {
+
+  const netuit::CsrTopology topology{
+    netuit::make_toroidal_topology( {16, 16} )
+  };
+
+  const auto [proc_assigner, thread_assigner]
+    = netuit::GenerateHostAwareMetisAssignments( 2, topology );
+
+  REQUIRE( proc_assigner.GetSize() == topology.GetSize() );
+  for (size_t node = 0; node < topology.GetSize(); ++node) {
+    REQUIRE( proc_assigner(node) < uitsl::get_nprocs() );
+    REQUIRE( thread_assigner(node) < 2 );
+  }
+
+}
+
+TEST_CASE("Test GenerateHostAwareMetisAssignments, inter-host cut vs flat") {
+
+  const netuit::Topology topology = netuit::make_toroidal_topology( {16, 16} );
+  const netuit::CsrTopology csr{ topology };
+
+  // four simulated hosts with two ranks apiece
+  const emp::vector<size_t> proc_hosts{ 0, 0, 1, 1, 2, 2, 3, 3 };
+  const size_t num_hosts = proc_hosts.back() + 1;
+
+  const auto host_cut = [&](const auto& proc_assigner){
+    return netuit::EvaluatePartition(
+      csr,
+      [&](const size_t node){ return proc_hosts[ proc_assigner(node) ]; },
+      num_hosts
+    ).num_cut_edges;
+  };
+
+  const auto host_aware = netuit::GenerateHostAwareMetisAssignments(
+    proc_hosts, 1, topology
+  ).first;
+  const auto flat = netuit::GenerateMetisAssignments(
+    proc_hosts.size(), 1, topology
+  ).first;
+
+  REQUIRE( host_cut( host_aware ) <= host_cut( flat ) );
+
+}
+
+TEST_CASE("Test GenerateHostAwareMetisAssignments, more procs than nodes") {
+
+  const netuit::Topology topology = netuit::make_toroidal_topology( {3} );
+
+  const emp::vector<size_t> proc_hosts{ 0, 0, 0, 0, 1, 1, 1, 1 };
+
+  const auto [proc_assigner, thread_assigner]
+    = netuit::GenerateHostAwareMetisAssignments( proc_hosts, 1, topology );
+
+  // each host gets fewer nodes than it has procs, so no proc doubles up
+  std::unordered_set<uitsl::proc_id_t> used;
+  for (size_t node = 0; node < topology.GetSize(); ++node) {
+    const auto proc = uitsl::safe_cast<size_t>( proc_assigner(node) );
+    REQUIRE( proc < proc_hosts.size() );
+    REQUIRE( used.insert( proc_assigner(node) ).second );
+    REQUIRE( thread_assigner(node) == 0 );
+  }
+
+}
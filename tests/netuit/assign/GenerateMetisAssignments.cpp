@@ -6,6 +6,9 @@
 #include "netuit/arrange/DyadicTopologyFactory.hpp"
 #include "netuit/arrange/ToroidalTopologyFactory.hpp"
 #include "netuit/assign/GenerateMetisAssignments.hpp"
+#include "netuit/assign/PartitionWeights.hpp"
+#include "netuit/topology/CsrTopology.hpp"
+#include "netuit/topology/TopoNode.hpp"
 #include "netuit/topology/Topology.hpp"
 
 TEST_CASE("Test PartitionMetis, complete topology") {
@@ -59,3 +62,78 @@ TEST_CASE("Test GenerateMetisAssignments, toroidal topology") {
   netuit::GenerateMetisAssignments(1, 1, topo17);
   netuit::GenerateMetisAssignments(2, 2, topo17);
 }
+
+TEST_CASE("Test GenerateMetisAssignments, CSR topology") {
+  const netuit::CsrTopology topo16{ netuit::make_toroidal_topology( {16, 16} ) };
+  netuit::PartitionMetis(2, topo16);
+  netuit::GenerateMetisAssignments(1, 1, topo16);
+  netuit::GenerateMetisAssignments(2, 2, topo16);
+}
+
+TEST_CASE("Test MakeWeightedCSR") {
+  // 0 <-> 1 -> 2, with a self loop on 2
+  emp::vector<netuit::TopoNode> nodes( 3 );
+  nodes[0].AddOutput( 1 ); nodes[1].AddInput( 1 );
+  nodes[1].AddOutput( 2 ); nodes[0].AddInput( 2 );
+  nodes[1].AddOutput( 3 ); nodes[2].AddInput( 3 );
+  nodes[2].AddOutput( 4 ); nodes[2].AddInput( 4 );
+  netuit::Topology topology;
+  for (const auto& node : nodes) topology.push_back( node );
+
+  netuit::PartitionWeights weights( 3, 2 );
+  weights.AddEdgeWeight( 1, 1.0 );
+  weights.AddEdgeWeight( 2, 2.0 );
+  weights.AddEdgeWeight( 3, 3.0 );
+  weights.SetNodeWeight( 0, 1.0, 0 );
+  weights.SetNodeWeight( 1, 3.0, 0 );
+  weights.SetNodeWeight( 2, 1.0, 1 );
+
+  const auto csr = netuit::internal::MakeWeightedCSR( topology, weights );
+
+  // edges are symmetric, with self loop dropped
+  REQUIRE( csr.x_adj == emp::vector<int32_t>{ 0, 1, 3, 4 } );
+  REQUIRE( csr.adjacency == emp::vector<int32_t>{ 1, 0, 2, 1 } );
+
+  // both directions between 0 and 1 are summed, keeping proportion to 1 -> 2
+  REQUIRE( csr.edge_weights[0] == csr.edge_weights[1] );
+  REQUIRE( csr.edge_weights[2] == csr.edge_weights[3] );
+  REQUIRE( csr.edge_weights[0] == csr.edge_weights[2] );
+
+  // node-major, each constraint scaled separately
+  REQUIRE( csr.node_weights.size() == 6 );
+  REQUIRE( csr.node_weights[2] == 3 * csr.node_weights[0] );
+  REQUIRE( csr.node_weights[4] == 0 );
+  REQUIRE( csr.node_weights[1] == 0 );
+  REQUIRE( csr.node_weights[3] == 0 );
+  REQUIRE( csr.node_weights[5] > 0 );
+}
+
+TEST_CASE("Test GenerateMetisAssignments, weighted") {
+  const netuit::Topology topo16 = netuit::make_toroidal_topology( {16, 16} );
+  const netuit::CsrTopology csr_topo16{ topo16 };
+
+  // two constraints, e.g., compute and memory
+  netuit::PartitionWeights weights( topo16.GetSize(), 2 );
+  for (size_t node{}; node < topo16.GetSize(); ++node) {
+    weights.SetNodeWeight( node, 1.0 + node % 3, 0 );
+    weights.SetNodeWeight( node, 1.0 + node % 5, 1 );
+  }
+  for (const auto& node : topo16) {
+    for (const auto& output : node.GetOutputs()) {
+      weights.AddEdgeWeight( output.GetEdgeID(), output.GetEdgeID() % 7 );
+    }
+  }
+
+  netuit::PartitionMetis(2, topo16, weights);
+  netuit::PartitionMetis(2, csr_topo16, weights, 1.1);
+  netuit::GenerateMetisAssignments(1, 1, topo16, weights);
+  netuit::GenerateMetisAssignments(2, 2, topo16, weights);
+  netuit::GenerateMetisAssignments(2, 2, csr_topo16, weights);
+
+  const auto [proc_assign, thread_assign]
+    = netuit::GenerateMetisAssignmentFunctors(2, 2, topo16, weights);
+  for (size_t node{}; node < topo16.GetSize(); ++node) {
+    REQUIRE( proc_assign( node ) < 2 );
+    REQUIRE( thread_assign( node ) < 2 );
+  }
+}
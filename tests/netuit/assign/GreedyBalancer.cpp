@@ -0,0 +1,334 @@
+#include <algorithm>
+#include <map>
+#include <string>
+
+#include <mpi.h>
+
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uitsl/mpi/comm_utils.hpp"
+#include "uitsl/mpi/mpi_guard.hpp"
+
+#include "uit/ducts/intra/put=dropping+get=stepping+type=any/a::SerialPendingDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=skipping+type=span/inlet=RingIsend+outlet=BlockIrecv_s::IriObiDuct.hpp"
+#include "uit/ducts/thread/put=dropping+get=stepping+type=any/a::AtomicPendingDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+#include "netuit/arrange/RingTopologyFactory.hpp"
+#include "netuit/assign/GreedyBalancer.hpp"
+#include "netuit/assign/NodeLoad.hpp"
+#include "netuit/mesh/Mesh.hpp"
+
+using Spec = uit::ImplSpec<int>;
+
+namespace {
+
+double max_slot_load(
+  const emp::vector<netuit::NodeLoad>& loads, const size_t threads_per_proc
+) {
+  std::map<size_t, double> slot_loads;
+  for (const auto& load : loads) {
+    slot_loads[load.proc * threads_per_proc + load.thread] += load.load;
+  }
+  double res{};
+  for (const auto& [slot, slot_load] : slot_loads) {
+    res = std::max( res, slot_load );
+  }
+  return res;
+}
+
+// put each node's id + 1 around the ring until every local node has heard
+// from its predecessor
+void check_ring(netuit::Mesh<Spec>& mesh, const size_t num_nodes) {
+
+  const uitsl::proc_id_t rank = uitsl::get_rank();
+
+  emp::vector<Spec::T> expected;
+  auto submesh = mesh.GetSubmesh( 0, rank );
+  for (const auto& node : mesh.GetSubmesh( 1, rank )) submesh.push_back( node );
+  for (const auto& node : submesh) expected.push_back(
+    ( node.GetNodeID() + num_nodes - 1 ) % num_nodes + 1
+  );
+
+  emp::vector<char> heard( submesh.size() );
+  while (
+    !std::all_of( std::begin(heard), std::end(heard), [](char h){ return h; } )
+  ) {
+    for (size_t i{}; i < submesh.size(); ++i) {
+      submesh[i].GetOutput(0).TryPut( submesh[i].GetNodeID() + 1 );
+      submesh[i].GetOutput(0).TryFlush();
+    }
+    for (size_t i{}; i < submesh.size(); ++i) {
+      const Spec::T res = submesh[i].GetInput(0).JumpGet();
+      REQUIRE( (res == 0 || res == expected[i]) );
+      heard[i] |= res == expected[i];
+    }
+  }
+
+  // then wait for every proc to hear
+  while ( !netuit::internal::AllAgree( true, MPI_COMM_WORLD ) );
+
+}
+
+} // namespace
+
+TEST_CASE("Test GreedyBalancer") {
+
+  // everything starts on proc 0, thread 0
+  emp::vector<netuit::NodeLoad> loads;
+  for (size_t node{}; node < 16; ++node) {
+    loads.push_back( netuit::NodeLoad{ node, 0, 0, 1.0 + node % 3 } );
+  }
+
+  const auto balanced = netuit::GreedyBalancer{}( loads, 2, 2 );
+
+  REQUIRE( balanced.size() == loads.size() );
+  for (size_t i{}; i < loads.size(); ++i) {
+    REQUIRE( balanced[i].node_id == loads[i].node_id );
+    REQUIRE( balanced[i].load == loads[i].load );
+    REQUIRE( balanced[i].proc < 2 );
+    REQUIRE( balanced[i].thread < 2 );
+  }
+
+  // total load is 31 over 4 slots
+  REQUIRE( max_slot_load( loads, 2 ) == 31.0 );
+  REQUIRE( max_slot_load( balanced, 2 ) <= 9.0 );
+
+}
+
+TEST_CASE("Test GreedyBalancer leaves balanced placements alone") {
+
+  emp::vector<netuit::NodeLoad> loads;
+  for (size_t node{}; node < 16; ++node) {
+    loads.push_back(
+      netuit::NodeLoad{ node, int(node % 4 / 2), node % 2, 1.0 }
+    );
+  }
+
+  const auto balanced = netuit::GreedyBalancer{}( loads, 2, 2 );
+  for (size_t i{}; i < loads.size(); ++i) {
+    REQUIRE( balanced[i].proc == loads[i].proc );
+    REQUIRE( balanced[i].thread == loads[i].thread );
+  }
+
+}
+
+TEST_CASE("Test GatherNodeLoads") {
+
+  const uitsl::proc_id_t rank = uitsl::get_rank();
+  const size_t nprocs = uitsl::get_nprocs();
+
+  const auto loads = netuit::GatherNodeLoads( {
+    netuit::NodeLoad{ 2 * size_t(rank), rank, 0, 1.0 },
+    netuit::NodeLoad{ 2 * size_t(rank) + 1, rank, 1, 2.0 }
+  } );
+
+  REQUIRE( loads.size() == 2 * nprocs );
+  for (size_t i{}; i < loads.size(); ++i) {
+    REQUIRE( loads[i].node_id == i );
+    REQUIRE( size_t(loads[i].proc) == i / 2 );
+    REQUIRE( loads[i].load == 1.0 + i % 2 );
+  }
+
+}
+
+TEST_CASE("Test Mesh Migrate between procs") {
+
+  const size_t nprocs = uitsl::get_nprocs();
+  const uitsl::proc_id_t rank = uitsl::get_rank();
+  const size_t num_nodes = 4 * nprocs;
+
+  netuit::Mesh<Spec> mesh{
+    netuit::make_ring_topology( num_nodes ),
+    [](size_t node){ return node % 2; },
+    [](size_t node){ return uitsl::proc_id_t( node / 4 ); }
+  };
+  check_ring( mesh, num_nodes );
+
+  // shift every block of nodes over one proc
+  std::map<size_t, std::string> states;
+  mesh.Migrate(
+    [](size_t){ return 0; },
+    [nprocs](size_t node){
+      return uitsl::proc_id_t( (node / 4 + 1) % nprocs );
+    },
+    [](size_t node){ return std::to_string( node * 10 ); },
+    [&states](size_t node, std::string state){ states[node] = state; }
+  );
+
+  const auto submesh = mesh.GetSubmesh( 0, rank );
+  REQUIRE( submesh.size() == 4 );
+  for (const auto& node : submesh) {
+    REQUIRE( (node.GetNodeID() / 4 + 1) % nprocs == size_t(rank) );
+  }
+
+  if ( nprocs > 1 ) {
+    REQUIRE( states.size() == 4 );
+    for (const auto& [node, state] : states) {
+      REQUIRE( state == std::to_string( node * 10 ) );
+    }
+  } else REQUIRE( states.empty() );
+
+  check_ring( mesh, num_nodes );
+
+}
+
+TEST_CASE("Test Mesh Migrate keeps back end message size") {
+
+  using SpanSpec = uit::ImplSpec<
+    emp::vector<int>,
+    uit::ImplSelect<
+      uit::a::SerialPendingDuct,
+      uit::a::AtomicPendingDuct,
+      uit::s::IriObiDuct
+    >
+  >;
+  const size_t message_size = 2;
+
+  const size_t nprocs = uitsl::get_nprocs();
+  const uitsl::proc_id_t rank = uitsl::get_rank();
+  const size_t num_nodes = 4 * nprocs;
+
+  netuit::Mesh<SpanSpec> mesh{
+    netuit::make_ring_topology( num_nodes ),
+    [](size_t){ return 0; },
+    [](size_t node){ return uitsl::proc_id_t( node / 4 ); },
+    std::make_shared<SpanSpec::ProcBackEnd>( message_size )
+  };
+
+  // put each node's id around the ring until every local node has heard
+  // from its predecessor
+  const auto check_span_ring = [&mesh, num_nodes, rank, message_size](){
+    auto submesh = mesh.GetSubmesh( 0, rank );
+    emp::vector<char> heard( submesh.size() );
+    while ( !std::all_of(
+      std::begin(heard), std::end(heard), [](char h){ return h; }
+    ) ) {
+      for (auto& node : submesh) {
+        const int id = node.GetNodeID();
+        node.GetOutput(0).TryPut( emp::vector<int>( message_size, id + 1 ) );
+        node.GetOutput(0).TryFlush();
+      }
+      for (size_t i{}; i < submesh.size(); ++i) {
+        const int expected = (
+          submesh[i].GetNodeID() + num_nodes - 1
+        ) % num_nodes + 1;
+        const auto& res = submesh[i].GetInput(0).JumpGet();
+        REQUIRE( res.size() == message_size );
+        REQUIRE( (res.front() == 0 || res.front() == expected) );
+        heard[i] |= res.front() == expected;
+      }
+    }
+    while ( !netuit::internal::AllAgree( true, MPI_COMM_WORLD ) );
+  };
+
+  check_span_ring();
+
+  // rebuilt with a back end of the same message size
+  mesh.Migrate(
+    [](size_t){ return 0; },
+    [nprocs](size_t node){
+      return uitsl::proc_id_t( (node / 4 + 1) % nprocs );
+    }
+  );
+  check_span_ring();
+
+  // or with one from the caller's factory
+  size_t num_made{};
+  mesh.Migrate(
+    [](size_t){ return 0; },
+    [](size_t node){ return uitsl::proc_id_t( node / 4 ); },
+    [](size_t){ return std::string{}; },
+    [](size_t, std::string){},
+    [&num_made, message_size](){
+      ++num_made;
+      return std::make_shared<SpanSpec::ProcBackEnd>( message_size );
+    }
+  );
+  REQUIRE( num_made == (nprocs > 1) );
+  check_span_ring();
+
+}
+
+TEST_CASE("Test Mesh Migrate between threads") {
+
+  const size_t nprocs = uitsl::get_nprocs();
+  const uitsl::proc_id_t rank = uitsl::get_rank();
+  const size_t num_nodes = 6 * nprocs;
+
+  netuit::Mesh<Spec> mesh{
+    netuit::make_ring_topology( num_nodes ),
+    [](size_t){ return 0; },
+    [](size_t node){ return uitsl::proc_id_t( node / 6 ); }
+  };
+
+  // leave a message on the untouched duct from node 0 to node 1 of each block
+  for (auto& node : mesh.GetSubmesh( 0, rank )) {
+    if ( node.GetNodeID() % 6 == 0 ) {
+      REQUIRE( node.GetOutput(0).TryPut( 42 ) );
+      node.GetOutput(0).TryFlush();
+    }
+  }
+
+  // only nodes without inter-process ducts move, so ducts are re-emplaced
+  bool packed{};
+  mesh.Migrate(
+    [](size_t node){ return node % 6 == 2 || node % 6 == 3; },
+    [](size_t node){ return uitsl::proc_id_t( node / 6 ); },
+    [&packed](size_t){ packed = true; return std::string{}; }
+  );
+  REQUIRE( !packed );
+
+  REQUIRE( mesh.GetSubmesh( 0, rank ).size() == 4 );
+  REQUIRE( mesh.GetSubmesh( 1, rank ).size() == 2 );
+
+  for (auto& node : mesh.GetSubmesh( 0, rank )) {
+    if ( node.GetNodeID() % 6 == 1 ) {
+      REQUIRE( node.GetInput(0).JumpGet() == 42 );
+    }
+  }
+
+  check_ring( mesh, num_nodes );
+
+}
+
+TEST_CASE("Test Mesh Rebalance") {
+
+  const size_t nprocs = uitsl::get_nprocs();
+  const uitsl::proc_id_t rank = uitsl::get_rank();
+  const size_t num_nodes = 4 * nprocs;
+
+  netuit::Mesh<Spec> mesh{
+    netuit::make_ring_topology( num_nodes ),
+    [](size_t){ return 0; },
+    [](size_t node){ return uitsl::proc_id_t( node / 4 ); }
+  };
+
+  // nodes on proc 0 are slow
+  const auto node_load = [](size_t node){ return node < 4 ? 10.0 : 1.0; };
+
+  std::map<size_t, std::string> states;
+  mesh.Rebalance(
+    netuit::GreedyBalancer{}, node_load, 1,
+    [](size_t node){ return std::to_string( node ); },
+    [&states](size_t node, std::string state){ states[node] = state; }
+  );
+
+  emp::vector<netuit::NodeLoad> local;
+  for (const auto& node : mesh.GetSubmesh( 0, rank )) {
+    local.push_back( netuit::NodeLoad{
+      node.GetNodeID(), rank, 0, node_load( node.GetNodeID() )
+    } );
+  }
+  const auto loads = netuit::GatherNodeLoads( local );
+  REQUIRE( loads.size() == num_nodes );
+
+  if ( nprocs > 1 ) REQUIRE( max_slot_load( loads, 1 ) < 40.0 );
+  for (const auto& [node, state] : states) {
+    REQUIRE( state == std::to_string( node ) );
+  }
+
+  check_ring( mesh, num_nodes );
+
+}
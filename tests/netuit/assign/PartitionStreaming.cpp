@@ -0,0 +1,139 @@
+#include <algorithm>
+
+#include <mpi.h>
+
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uitsl/mpi/comm_utils.hpp"
+#include "uitsl/mpi/mpi_guard.hpp"
+
+#include "netuit/arrange/ImplicitToroidalGridTopology.hpp"
+#include "netuit/arrange/ToroidalGridTopologyFactory.hpp"
+#include "netuit/assign/EvaluatePartition.hpp"
+#include "netuit/assign/PartitionStreaming.hpp"
+#include "netuit/topology/CsrTopology.hpp"
+
+namespace {
+
+// is every proc's result the same as proc 0's?
+bool is_consistent(const emp::vector<uint32_t>& parts) {
+  emp::vector<uint32_t> root( parts );
+  MPI_Bcast(
+    root.data(), root.size(), MPI_UINT32_T, 0, MPI_COMM_WORLD
+  );
+  return root == parts;
+}
+
+} // namespace
+
+TEST_CASE("Test PartitionStreaming") {
+
+  const netuit::CsrTopology topology{
+    netuit::make_toroidal_grid_topology( { 32, 32 } )
+  };
+  const size_t num_parts = 4;
+
+  for (const auto objective : {
+    netuit::StreamingObjective::ldg, netuit::StreamingObjective::fennel
+  }) {
+
+    const auto parts = netuit::PartitionStreaming(
+      num_parts, topology, objective, 1.05, 64
+    );
+    REQUIRE( parts.size() == topology.GetSize() );
+    REQUIRE( is_consistent( parts ) );
+    REQUIRE( std::all_of(
+      std::begin(parts), std::end(parts),
+      [num_parts](const uint32_t part){ return part < num_parts; }
+    ) );
+
+    const auto assignment = [&parts](size_t node){ return parts[node]; };
+    const auto report = netuit::EvaluatePartition(
+      topology, assignment, num_parts
+    );
+    REQUIRE( report.imbalance.front() <= 1.05 );
+
+    // much better than dealing nodes out round robin, which cuts every
+    // east-west edge
+    const auto dealt = netuit::EvaluatePartition(
+      topology, [](size_t node){ return node % 4; }, num_parts
+    );
+    REQUIRE( dealt.num_cut_edges == topology.GetNumEdges() / 2 );
+    REQUIRE( report.num_cut_edges * 2 < dealt.num_cut_edges );
+
+    const auto distributed = netuit::EvaluatePartitionDistributed(
+      topology, assignment, num_parts
+    );
+    REQUIRE( distributed.num_cut_edges == report.num_cut_edges );
+    REQUIRE( distributed.comm_volume == report.comm_volume );
+    REQUIRE( distributed.imbalance == report.imbalance );
+
+  }
+
+}
+
+TEST_CASE("Test PartitionStreaming, implicit topology") {
+
+  const netuit::ImplicitToroidalGridTopology implicit{ 1024 };
+  const netuit::CsrTopology explicit_{
+    netuit::make_toroidal_grid_topology( { 32, 32 } )
+  };
+
+  // same graph, same partition
+  const auto parts = netuit::PartitionStreaming( 8, implicit );
+  REQUIRE( parts == netuit::PartitionStreaming( 8, explicit_ ) );
+  REQUIRE( is_consistent( parts ) );
+
+  const auto report = netuit::EvaluatePartitionDistributed(
+    implicit, [&parts](size_t node){ return parts[node]; }, 8
+  );
+  REQUIRE( report.imbalance.front() <= 1.05 );
+  // dealing nodes out at random would cut seven in eight edges
+  REQUIRE( report.num_cut_edges < implicit.GetSize() * 2 );
+
+}
+
+TEST_CASE("Test GenerateStreamingAssignmentFunctors") {
+
+  const netuit::CsrTopology topology{
+    netuit::make_toroidal_grid_topology( { 32, 32 } )
+  };
+  const size_t num_procs = 2;
+  const size_t threads_per_proc = 3;
+
+  const auto [proc_assignment, thread_assignment]
+    = netuit::GenerateStreamingAssignmentFunctors(
+      num_procs, threads_per_proc, topology
+    );
+
+  emp::vector<size_t> slot_sizes( num_procs * threads_per_proc );
+  emp::vector<uint32_t> slots;
+  for (size_t node{}; node < topology.GetSize(); ++node) {
+    const size_t proc = proc_assignment( node );
+    const size_t thread = thread_assignment( node );
+    REQUIRE( proc < num_procs );
+    REQUIRE( thread < threads_per_proc );
+    ++slot_sizes[ proc * threads_per_proc + thread ];
+    slots.push_back( proc * threads_per_proc + thread );
+  }
+  REQUIRE( is_consistent( slots ) );
+
+  // each proc holds about half, split about evenly among its threads
+  const size_t largest = *std::max_element(
+    std::begin(slot_sizes), std::end(slot_sizes)
+  );
+  REQUIRE(
+    largest <= 1.05 * 1.05 * topology.GetSize() / slot_sizes.size() + 1
+  );
+
+  const auto procs = netuit::EvaluatePartition(
+    topology, proc_assignment, num_procs
+  );
+  const auto threads = netuit::EvaluatePartition(
+    topology, [&slots](size_t node){ return slots[node]; }, slot_sizes.size()
+  );
+  REQUIRE( procs.num_cut_edges < topology.GetNumEdges() / 4 );
+  REQUIRE( threads.num_cut_edges < topology.GetNumEdges() / 2 );
+
+}
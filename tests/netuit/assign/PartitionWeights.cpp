@@ -0,0 +1,164 @@
+#include <sstream>
+
+#include <mpi.h>
+
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uitsl/mpi/comm_utils.hpp"
+#include "uitsl/mpi/mpi_guard.hpp"
+
+#include "uit/setup/ImplSpec.hpp"
+
+#include "netuit/arrange/RingTopologyFactory.hpp"
+#include "netuit/assign/PartitionWeights.hpp"
+#include "netuit/mesh/Mesh.hpp"
+#include "netuit/topology/CsrTopology.hpp"
+#include "netuit/topology/Topology.hpp"
+
+TEST_CASE("Test PartitionWeights defaults") {
+
+  const netuit::PartitionWeights weights( 4, 2, 3.0 );
+
+  REQUIRE( weights.GetNumNodes() == 4 );
+  REQUIRE( weights.GetNumConstraints() == 2 );
+  REQUIRE( weights.GetNodeWeight( 3, 1 ) == 1.0 );
+  REQUIRE( weights.GetEdgeWeight( 42 ) == 3.0 );
+
+}
+
+TEST_CASE("Test PartitionWeights measurements") {
+
+  netuit::PartitionWeights weights( 4, 2 );
+
+  // first measurement replaces the default for every constraint
+  weights.SetNodeWeight( 1, 5.0 );
+  REQUIRE( weights.GetNodeWeight( 1, 0 ) == 5.0 );
+  REQUIRE( weights.GetNodeWeight( 1, 1 ) == 0.0 );
+  REQUIRE( weights.GetNodeWeight( 2, 1 ) == 1.0 );
+
+  weights.AddNodeWeight( 1, 2.0, 1 );
+  weights.AddNodeWeight( 1, 2.0, 1 );
+  REQUIRE( weights.GetNodeWeight( 1, 1 ) == 4.0 );
+
+  weights.AddNodeWeight( 2, 0.5 );
+  REQUIRE( weights.GetNodeWeight( 2, 0 ) == 0.5 );
+
+  weights.AddEdgeWeight( 7, 10.0 );
+  weights.AddEdgeWeight( 7, 10.0 );
+  REQUIRE( weights.GetEdgeWeight( 7 ) == 20.0 );
+  REQUIRE( weights.GetEdgeWeight( 8 ) == 1.0 );
+
+}
+
+TEST_CASE("Test PartitionWeights Write and Read") {
+
+  netuit::PartitionWeights written( 4, 2 );
+  written.SetNodeWeight( 0, 0.1, 0 );
+  written.SetNodeWeight( 0, 128.0, 1 );
+  written.SetNodeWeight( 3, 1.0 / 3.0, 1 );
+  written.AddEdgeWeight( 5, 64.0 );
+
+  std::stringstream ss;
+  ss << "# profiling run\n";
+  written.Write( ss );
+  ss << "\n";
+
+  netuit::PartitionWeights read( 4, 2 );
+  read.Read( ss );
+
+  for (size_t node{}; node < 4; ++node) {
+    for (size_t constraint{}; constraint < 2; ++constraint) {
+      REQUIRE(
+        read.GetNodeWeight( node, constraint )
+        == written.GetNodeWeight( node, constraint )
+      );
+    }
+  }
+  REQUIRE( read.GetEdgeWeight( 5 ) == 64.0 );
+  REQUIRE( read.GetEdgeWeight( 6 ) == 1.0 );
+
+}
+
+TEST_CASE("Test PartitionWeights Read accumulates") {
+
+  netuit::PartitionWeights weights( 2 );
+
+  std::stringstream first( "node 0 1.5\nedge 3 8\n" );
+  std::stringstream second( "node 0 2.5\nnode 1 4\nedge 3 8\n" );
+  weights.Read( first );
+  weights.Read( second );
+
+  REQUIRE( weights.GetNodeWeight( 0 ) == 4.0 );
+  REQUIRE( weights.GetNodeWeight( 1 ) == 4.0 );
+  REQUIRE( weights.GetEdgeWeight( 3 ) == 16.0 );
+
+}
+
+TEST_CASE("Test PartitionWeights GetCsrEdgeWeights") {
+
+  const netuit::Topology topology = netuit::make_ring_topology( 5 );
+  const netuit::CsrTopology csr_topology{ topology };
+
+  netuit::PartitionWeights weights( topology.GetSize() );
+  const size_t edge_id = topology[2].GetOutputs().front().GetEdgeID();
+  weights.AddEdgeWeight( edge_id, 9.0 );
+
+  const auto [x_adj, adjacency] = topology.AsCSR();
+
+  for (const auto& res : {
+    weights.GetCsrEdgeWeights( topology ),
+    weights.GetCsrEdgeWeights( csr_topology )
+  }) {
+    REQUIRE( res.size() == adjacency.size() );
+    for (size_t node{}; node < topology.GetSize(); ++node) {
+      for (int32_t i = x_adj[node]; i < x_adj[node + 1]; ++i) {
+        REQUIRE( res[i] == (node == 2 ? 9.0 : 1.0) );
+      }
+    }
+  }
+
+}
+
+TEST_CASE("Test PartitionWeights AddTraffic") {
+
+  using Spec = uit::ImplSpec<int>;
+
+  // every proc gets a whole ring of its own
+  const netuit::Topology topology = netuit::make_ring_topology( 4 );
+  netuit::Mesh<Spec> mesh{
+    topology,
+    uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+    [](size_t){ return uitsl::get_proc_id(); }
+  };
+
+  auto submesh = mesh.GetSubmesh();
+  for (size_t i{}; i < 3; ++i) submesh[0].GetOutput(0).TryPut( i );
+  submesh[1].GetOutput(0).TryPut( 0 );
+
+  netuit::PartitionWeights weights( topology.GetSize() );
+  weights.AddTraffic( submesh, sizeof(int) );
+
+  REQUIRE( weights.GetEdgeWeight(
+    submesh[0].GetOutput(0).GetEdgeID()
+  ) == 3 * sizeof(int) );
+  REQUIRE( weights.GetEdgeWeight(
+    submesh[1].GetOutput(0).GetEdgeID()
+  ) == sizeof(int) );
+  REQUIRE( weights.GetEdgeWeight(
+    submesh[2].GetOutput(0).GetEdgeID()
+  ) == 0.0 );
+
+  // later calls only add traffic since the previous call, weighed by the
+  // bytes passed, e.g., a span message's size
+  submesh[1].GetOutput(0).TryPut( 1 );
+  weights.AddTraffic( submesh, 100.0 );
+
+  REQUIRE( weights.GetEdgeWeight(
+    submesh[0].GetOutput(0).GetEdgeID()
+  ) == 3 * sizeof(int) );
+  REQUIRE( weights.GetEdgeWeight(
+    submesh[1].GetOutput(0).GetEdgeID()
+  ) == sizeof(int) + 100.0 );
+
+}
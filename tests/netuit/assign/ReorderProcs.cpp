@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <numeric>
+
+#include <mpi.h>
+
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uit/setup/ImplSpec.hpp"
+#include "uitsl/mpi/comm_utils.hpp"
+#include "uitsl/mpi/mpi_types.hpp"
+#include "uitsl/utility/assign_utils.hpp"
+
+#include "netuit/arrange/RingTopologyFactory.hpp"
+#include "netuit/arrange/ToroidalGridTopologyFactory.hpp"
+#include "netuit/assign/ReorderProcs.hpp"
+#include "netuit/mesh/Mesh.hpp"
+#include "netuit/topology/CsrTopology.hpp"
+
+TEST_CASE("Test TallyProcTraffic") {
+
+  const size_t num_procs = uitsl::get_nprocs();
+  const auto topology = netuit::RingTopologyFactory{}( 4 * num_procs );
+  const auto assignment = uitsl::AssignContiguously<uitsl::proc_id_t>{
+    num_procs, topology.GetSize()
+  };
+
+  const auto traffic = netuit::TallyProcTraffic(
+    topology, assignment, uitsl::get_rank()
+  );
+
+  if (num_procs == 1) REQUIRE( traffic.empty() );
+  else {
+    // a ring only crosses procs at each end of a contiguous chunk
+    REQUIRE( traffic.size() == 1 );
+    REQUIRE(
+      static_cast<size_t>( traffic.begin()->first )
+      == (uitsl::get_rank() + 1) % num_procs
+    );
+    REQUIRE( traffic.begin()->second == 1 );
+  }
+
+  REQUIRE( netuit::TallyProcTraffic(
+    netuit::CsrTopology{ topology }, assignment, uitsl::get_rank()
+  ) == traffic );
+
+}
+
+TEST_CASE("Test ReorderProcs") {
+
+  const size_t num_procs = uitsl::get_nprocs();
+  const auto topology = netuit::ToroidalGridTopologyFactory{}(
+    16 * num_procs
+  );
+  const std::function<uitsl::proc_id_t(size_t)> assignment
+    = uitsl::AssignContiguously<uitsl::proc_id_t>{
+      num_procs, topology.GetSize()
+    };
+
+  auto res = netuit::ReorderProcs( topology, assignment );
+
+  REQUIRE( uitsl::get_nprocs( res.comm ) == uitsl::get_nprocs() );
+
+  // base ranks are a permutation
+  auto sorted = res.base_ranks;
+  std::sort( std::begin(sorted), std::end(sorted) );
+  emp::vector<uitsl::proc_id_t> iota( num_procs );
+  std::iota( std::begin(iota), std::end(iota), 0 );
+  REQUIRE( sorted == iota );
+  REQUIRE( res.base_ranks[ uitsl::get_rank(res.comm) ] == uitsl::get_rank() );
+
+  for (size_t node{}; node < topology.GetSize(); ++node) {
+    REQUIRE( res.proc_assignment(node) == assignment(node) );
+    REQUIRE( res.base_proc_assignment(node) == uitsl::translate_comm_rank(
+      res.proc_assignment(node), res.comm, MPI_COMM_WORLD
+    ) );
+  }
+
+  // graph neighbors are the procs this partition exchanges edges with
+  int indegree, outdegree, weighted;
+  UITSL_Dist_graph_neighbors_count( res.comm, &indegree, &outdegree, &weighted );
+  REQUIRE( uitsl::safe_equal( outdegree, netuit::TallyProcTraffic(
+    topology, assignment, uitsl::get_rank(res.comm)
+  ).size() ) );
+
+  {
+    netuit::Mesh<uit::ImplSpec<int>> mesh{
+      topology,
+      uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+      res.proc_assignment,
+      std::make_shared<uit::ImplSpec<int>::ProcBackEnd>(),
+      res.comm
+    };
+
+    // every node is hosted by exactly one proc
+    const size_t num_local = mesh.GetSubmesh().size();
+    size_t total;
+    UITSL_Allreduce(
+      &num_local, &total, 1, uitsl::datatype_from_type<size_t>(),
+      MPI_SUM, MPI_COMM_WORLD
+    );
+    REQUIRE( total == topology.GetSize() );
+  }
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+  UITSL_Comm_free( &res.comm );
+
+}
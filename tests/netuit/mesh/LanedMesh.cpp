@@ -0,0 +1,101 @@
+#include <stddef.h>
+
+#include <mpi.h>
+
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uitsl/mpi/mpi_guard.hpp"
+#include "uitsl/mpi/mpi_utils.hpp"
+#include "uitsl/utility/assign_utils.hpp"
+
+#include "uit/setup/ImplSpec.hpp"
+
+#include "netuit/arrange/DyadicTopologyFactory.hpp"
+#include "netuit/arrange/RingTopologyFactory.hpp"
+#include "netuit/assign/AssignAvailableProcs.hpp"
+#include "netuit/mesh/LanedMesh.hpp"
+
+using BulkSpec = uit::ImplSpec<double>;
+using PrioritySpec = uit::ImplSpec<char>;
+
+TEST_CASE("Test LanedMesh", "[nproc:1]") {
+
+  netuit::LanedMesh<BulkSpec, PrioritySpec> mesh{
+    netuit::RingTopologyFactory{}(100)
+  };
+
+  REQUIRE( mesh.GetNodeCount() == 100 );
+  REQUIRE( mesh.GetEdgeCount() == 100 );
+  REQUIRE( mesh.GetSubmesh().size() == 100 );
+
+  for (const auto& node : mesh.GetSubmesh()) {
+    REQUIRE( node.GetBulk().GetNodeID() == node.GetNodeID() );
+    REQUIRE( node.GetPriority().GetNodeID() == node.GetNodeID() );
+  }
+
+}
+
+TEST_CASE("Test LanedMesh lanes are independent", "[nproc:1]") {
+
+  netuit::LanedMesh<BulkSpec, PrioritySpec> mesh{
+    netuit::RingTopologyFactory{}(10)
+  };
+
+  auto submesh = mesh.GetSubmesh();
+
+  for (auto& node : submesh) {
+    node.GetBulk().GetOutput(0).Put( node.GetNodeID() + 0.5 );
+    node.GetPriority().GetOutput(0).Put( 'a' );
+  }
+
+  for (auto& node : submesh) {
+    REQUIRE( node.GetPriority().GetInput(0).GetNext() == 'a' );
+    REQUIRE( node.GetBulk().GetInput(0).GetNext() != 0.0 );
+  }
+
+}
+
+TEST_CASE("Test LanedMesh priority lane bypasses bulk backlog", "[nproc:2]") {
+
+  netuit::LanedMesh<BulkSpec, PrioritySpec> mesh{
+    netuit::DyadicTopologyFactory{}( uitsl::get_nprocs() ),
+    uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+    netuit::AssignAvailableProcs{}
+  };
+
+  auto submesh = mesh.GetSubmesh();
+  REQUIRE( submesh.size() == 1 );
+  auto& node = submesh.front();
+
+  // flood the bulk lane well past what its ducts buffer, and never read it
+  for (size_t i{}; i < 4 * uit::DEFAULT_BUFFER; ++i) {
+    node.GetBulk().GetOutput(0).TryPut( i + 0.5 );
+  }
+  node.GetPriority().GetOutput(0).Put( 'a' );
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+  char received{};
+  while ( received == 0 ) node.DrainPriority(
+    [&received](size_t, const char val){ received = val; }
+  );
+  REQUIRE( received == 'a' );
+
+  // servicing the node reaches a new priority message while bulk messages
+  // are still queued ahead of it
+  node.GetPriority().GetOutput(0).Put( 'b' );
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+  size_t num_bulk{};
+  while ( received != 'b' ) node.Service(
+    [&received](size_t, const char val){ received = val; },
+    [&num_bulk](size_t, double){ ++num_bulk; },
+    1
+  );
+  REQUIRE( received == 'b' );
+  REQUIRE( num_bulk < uit::DEFAULT_BUFFER );
+  REQUIRE( node.GetBulk().GetInput(0).TryStep() );
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+}
@@ -1,14 +1,23 @@
+#include <mpi.h>
+
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
 #include "Catch/single_include/catch2/catch.hpp"
 
+#include "uitsl/debug/safe_cast.hpp"
 #include "uitsl/mpi/mpi_guard.hpp"
+#include "uitsl/mpi/mpi_utils.hpp"
+#include "uitsl/utility/assign_utils.hpp"
 
 #include "uit/setup/ImplSpec.hpp"
 
+#include "netuit/arrange/ImplicitToroidalGridTopology.hpp"
 #include "netuit/arrange/ProConTopologyFactory.hpp"
 #include "netuit/arrange/RingTopologyFactory.hpp"
 #include "netuit/arrange/ToroidalGridTopologyFactory.hpp"
 #include "netuit/arrange/ToroidalTopologyFactory.hpp"
 #include "netuit/mesh/Mesh.hpp"
+#include "netuit/topology/CsrTopology.hpp"
+#include "netuit/topology/LocalTopology.hpp"
 
 TEST_CASE("Test Mesh", "[nproc:1]") {
 
@@ -35,6 +44,160 @@ TEST_CASE("Test with ProConTopologyFactory", "[nproc:1]") {
 
 }
 
+TEST_CASE("Test Mesh from LocalTopology") {
+
+  using Spec = uit::ImplSpec<size_t>;
+
+  const size_t num_procs = uitsl::safe_cast<size_t>( uitsl::get_nprocs() );
+  const size_t num_nodes = 10 * num_procs;
+  const uitsl::AssignContiguously<uitsl::proc_id_t> proc_assignment{
+    num_procs, num_nodes
+  };
+
+  netuit::Mesh<Spec> mesh{
+    netuit::LocalTopology::Extract(
+      netuit::RingTopologyFactory{}( num_nodes ), proc_assignment
+    ),
+    uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+    proc_assignment
+  };
+
+  // plus the edge in from the previous proc's block
+  REQUIRE( mesh.GetEdgeCount() == 10 + (num_procs > 1) );
+
+  auto submesh = mesh.GetSubmesh();
+  REQUIRE( submesh.size() == 10 );
+
+  for (auto& node : submesh) node.GetOutput(0).Put( node.GetNodeID() );
+
+  // each node hears from its ring neighbor, across procs at block ends
+  for (auto& node : submesh) {
+    const size_t received = node.GetInput(0).GetNext();
+    REQUIRE( received != node.GetNodeID() );
+    REQUIRE( (
+      received == (node.GetNodeID() + 1) % num_nodes
+      || received == (node.GetNodeID() + num_nodes - 1) % num_nodes
+    ) );
+  }
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+}
+
+TEST_CASE("Test ToroidalMesh reciporical from LocalTopology") {
+
+  using Spec = uit::ImplSpec<size_t>;
+
+  const size_t num_procs = uitsl::safe_cast<size_t>( uitsl::get_nprocs() );
+  const auto topology = netuit::ToroidalTopologyFactory{}( {10, 10} );
+  const uitsl::AssignContiguously<uitsl::proc_id_t> proc_assignment{
+    num_procs, topology.GetSize()
+  };
+
+  netuit::Mesh<Spec> global{
+    topology, uitsl::AssignIntegrated<uitsl::thread_id_t>{}, proc_assignment
+  };
+  netuit::Mesh<Spec> local{
+    netuit::LocalTopology::Extract( topology, proc_assignment ),
+    uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+    proc_assignment
+  };
+
+  auto global_submesh = global.GetSubmesh();
+  auto local_submesh = local.GetSubmesh();
+  REQUIRE( local_submesh.size() == global_submesh.size() );
+
+  if ( num_procs == 1 ) {
+    REQUIRE( local.GetNodeCount() == global.GetNodeCount() );
+    REQUIRE( local.GetEdgeCount() == global.GetEdgeCount() );
+  }
+
+  // both paths wire up the same inputs and outputs in the same order
+  for (size_t i{}; i < local_submesh.size(); ++i) {
+    auto& global_node = global_submesh[i];
+    auto& local_node = local_submesh[i];
+    REQUIRE( local_node.GetNumInputs() == global_node.GetNumInputs() );
+    REQUIRE( local_node.GetNumOutputs() == global_node.GetNumOutputs() );
+    for (size_t j{}; j < local_node.GetNumOutputs(); ++j) {
+      global_node.GetOutput( j ).Put( i * 4 + j );
+      local_node.GetOutput( j ).Put( i * 4 + j );
+    }
+  }
+
+  for (size_t i{}; i < local_submesh.size(); ++i) {
+    for (size_t j{}; j < local_submesh[i].GetNumInputs(); ++j) {
+      REQUIRE(
+        local_submesh[i].GetInput( j ).GetNext()
+        == global_submesh[i].GetInput( j ).GetNext()
+      );
+    }
+  }
+
+}
+
+TEST_CASE("Test Mesh from CsrTopology", "[nproc:1]") {
+
+  using Spec = uit::ImplSpec<size_t>;
+
+  netuit::Mesh<Spec> mesh{
+    netuit::CsrTopology{ netuit::ToroidalTopologyFactory{}( {10, 10} ) }
+  };
+
+  REQUIRE( mesh.GetNodeCount() == 100 );
+  REQUIRE( mesh.GetEdgeCount() == 400 );
+
+  auto submesh = mesh.GetSubmesh();
+  REQUIRE( submesh.size() == 100 );
+
+  size_t counter{};
+  for (auto& node : submesh) {
+    for (auto& output : node.GetOutputs()) output.Put(counter++);
+  }
+
+  counter = 0;
+  for (auto& node : submesh) {
+    for (auto& input : node.GetInputs()) {
+      // each value arrives somewhere exactly once
+      REQUIRE( input.GetNext() < 400 );
+      ++counter;
+    }
+  }
+  REQUIRE( counter == 400 );
+
+}
+
+TEST_CASE("Test ToroidalGridMesh reciporical from ImplicitTopology", "[nproc:1]") {
+
+  using Spec = uit::ImplSpec<size_t>;
+
+  netuit::Mesh<Spec> global{ netuit::ToroidalGridTopologyFactory{}( {5, 5} ) };
+  netuit::Mesh<Spec> implicit{ netuit::ImplicitToroidalGridTopology{ {5, 5} } };
+
+  REQUIRE( implicit.GetNodeCount() == global.GetNodeCount() );
+  REQUIRE( implicit.GetEdgeCount() == global.GetEdgeCount() );
+
+  auto global_submesh = global.GetSubmesh();
+  auto implicit_submesh = implicit.GetSubmesh();
+  REQUIRE( implicit_submesh.size() == global_submesh.size() );
+
+  for (size_t i{}; i < implicit_submesh.size(); ++i) {
+    for (size_t j{}; j < implicit_submesh[i].GetNumOutputs(); ++j) {
+      global_submesh[i].GetOutput( j ).Put( i * 4 + j );
+      implicit_submesh[i].GetOutput( j ).Put( i * 4 + j );
+    }
+  }
+
+  for (size_t i{}; i < implicit_submesh.size(); ++i) {
+    for (size_t j{}; j < implicit_submesh[i].GetNumInputs(); ++j) {
+      REQUIRE(
+        implicit_submesh[i].GetInput( j ).GetNext()
+        == global_submesh[i].GetInput( j ).GetNext()
+      );
+    }
+  }
+
+}
+
 // TODO add tests with more TopologyFactories
 // TODO add tests with no-connection nodes
 
@@ -0,0 +1,162 @@
+#include <unordered_set>
+#include <utility>
+
+#include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "uitsl/fetch/make_temp_filepath.hpp"
+
+#include "netuit/arrange/CompleteTopologyFactory.hpp"
+#include "netuit/arrange/DyadicTopologyFactory.hpp"
+#include "netuit/arrange/EmptyTopologyFactory.hpp"
+#include "netuit/arrange/ToroidalTopologyFactory.hpp"
+#include "netuit/topology/CsrTopology.hpp"
+#include "netuit/topology/Topology.hpp"
+
+TEST_CASE("Test CsrTopology", "[nproc:1]") {
+
+  const netuit::CsrTopology topology{};
+
+  REQUIRE( topology.GetSize() == 0 );
+  REQUIRE( topology.GetNumEdges() == 0 );
+  REQUIRE( !topology.HasEdge( 0 ) );
+
+}
+
+TEST_CASE("Test CsrTopology round trip", "[nproc:1]") {
+
+  for (const auto& topology : emp::vector<netuit::Topology>{
+    netuit::make_complete_topology( 5 ),
+    netuit::make_dyadic_topology( 5 ),
+    netuit::make_empty_topology( 5 ),
+    netuit::make_toroidal_topology( {3, 4} )
+  }) {
+
+    const netuit::CsrTopology csr{ topology };
+    REQUIRE( csr.GetSize() == topology.GetSize() );
+    REQUIRE( csr.AsCSR() == topology.AsCSR() );
+
+    const netuit::Topology converted = csr.ToTopology();
+    REQUIRE( converted.GetSize() == topology.GetSize() );
+    for (size_t node_id{}; node_id < topology.GetSize(); ++node_id) {
+      REQUIRE( converted[node_id] == topology[node_id] );
+    }
+
+  }
+
+}
+
+TEST_CASE("Test CsrTopology edge lookup", "[nproc:1]") {
+
+  const netuit::Topology topology = netuit::make_toroidal_topology( {3, 3} );
+  const netuit::CsrTopology csr{ topology };
+
+  REQUIRE( csr.GetNumEdges() == 36 );
+
+  for (size_t node_id{}; node_id < topology.GetSize(); ++node_id) {
+    REQUIRE( csr.GetNumOutputs( node_id ) == 4 );
+    REQUIRE( csr.GetNumInputs( node_id ) == 4 );
+    for (const auto& output : topology[node_id].GetOutputs()) {
+      REQUIRE( csr.GetInletNode( output.GetEdgeID() ) == node_id );
+    }
+    for (const auto& input : topology[node_id].GetInputs()) {
+      REQUIRE( csr.GetOutletNode( input.GetEdgeID() ) == node_id );
+    }
+  }
+
+}
+
+TEST_CASE("Test CsrTopology FromEdgeList", "[nproc:1]") {
+
+  // 0 -> 1, 1 -> 2, 2 -> 0, 0 -> 2
+  const auto csr = netuit::CsrTopology::FromEdgeList(
+    4, { {0, 1}, {1, 2}, {2, 0}, {0, 2} }
+  );
+
+  REQUIRE( csr.GetSize() == 4 );
+  REQUIRE( csr.GetNumEdges() == 4 );
+
+  REQUIRE( csr.GetOutputEdgeIDs( 0 ).size() == 2 );
+  REQUIRE( csr.GetOutputEdgeIDs( 0 )[0] == 0 );
+  REQUIRE( csr.GetOutputEdgeIDs( 0 )[1] == 3 );
+  REQUIRE( csr.GetInputEdgeIDs( 2 ).size() == 2 );
+  REQUIRE( csr.GetNumOutputs( 3 ) == 0 );
+  REQUIRE( csr.GetNumInputs( 3 ) == 0 );
+
+  REQUIRE( csr.GetInletNode( 3 ) == 0 );
+  REQUIRE( csr.GetOutletNode( 3 ) == 2 );
+  REQUIRE( !csr.HasEdge( 4 ) );
+
+  const auto [x_adj, adjacency] = csr.AsCSR();
+  REQUIRE( x_adj == emp::vector<int32_t>{ 0, 2, 3, 4, 4 } );
+  REQUIRE( adjacency == emp::vector<int32_t>{ 1, 2, 2, 0 } );
+
+}
+
+TEST_CASE("Test CsrTopology GetSubTopology", "[nproc:1]") {
+
+  const netuit::Topology topology = netuit::make_toroidal_topology( {4, 4} );
+  const netuit::CsrTopology csr{ topology };
+
+  const std::unordered_set<size_t> node_ids{ 0, 1, 4, 5, 15 };
+
+  const netuit::Topology expected = topology.GetSubTopology( node_ids );
+  const netuit::CsrTopology subtopology = csr.GetSubTopology( node_ids );
+
+  REQUIRE( subtopology.GetSize() == expected.GetSize() );
+  REQUIRE( subtopology.AsCSR() == expected.AsCSR() );
+  for (size_t node_id{}; node_id < expected.GetSize(); ++node_id) {
+    REQUIRE(
+      subtopology.GetCanonicalNodeID( node_id )
+      == expected.GetCanonicalNodeID( node_id )
+    );
+  }
+
+  // canonical ids survive conversion in both directions
+  const netuit::CsrTopology reconverted{ subtopology.ToTopology() };
+  for (size_t node_id{}; node_id < expected.GetSize(); ++node_id) {
+    REQUIRE(
+      reconverted.GetCanonicalNodeID( node_id )
+      == expected.GetCanonicalNodeID( node_id )
+    );
+  }
+
+}
+
+TEST_CASE("Test CsrTopology file round trip", "[nproc:1]") {
+
+  const netuit::Topology topology = netuit::make_toroidal_topology( {5, 6} );
+  const netuit::CsrTopology csr{ topology };
+
+  const auto path = uitsl::make_temp_filepath();
+  netuit::write_csr_topology_file( topology, path );
+
+  const netuit::CsrTopology mapped = netuit::CsrTopology::MapFile( path );
+  REQUIRE( mapped.GetSize() == csr.GetSize() );
+  REQUIRE( mapped.GetNumEdges() == csr.GetNumEdges() );
+  REQUIRE( mapped.AsCSR() == csr.AsCSR() );
+  for (size_t node_id{}; node_id < csr.GetSize(); ++node_id) {
+    for (const size_t edge_id : csr.GetOutputEdgeIDs( node_id )) {
+      REQUIRE( mapped.GetInletNode( edge_id ) == node_id );
+      REQUIRE( mapped.GetOutletNode( edge_id ) == csr.GetOutletNode( edge_id ) );
+    }
+  }
+
+  // canonical ids and sparse edge ids of subtopologies survive too
+  const netuit::CsrTopology subtopology = csr.GetSubTopology( { 7, 8, 13 } );
+  subtopology.WriteFile( path );
+  const netuit::CsrTopology mapped_subtopology
+    = netuit::CsrTopology::MapFile( path );
+  REQUIRE( mapped_subtopology.AsCSR() == subtopology.AsCSR() );
+  for (size_t node_id{}; node_id < subtopology.GetSize(); ++node_id) {
+    REQUIRE(
+      mapped_subtopology.GetCanonicalNodeID( node_id )
+      == subtopology.GetCanonicalNodeID( node_id )
+    );
+  }
+
+  // copies share the mapping
+  const netuit::CsrTopology copy = mapped_subtopology;
+  REQUIRE( copy.AsCSR() == subtopology.AsCSR() );
+
+}
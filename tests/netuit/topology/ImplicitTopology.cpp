@@ -0,0 +1,93 @@
+#include <unordered_set>
+
+#include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "uitsl/utility/assign_utils.hpp"
+
+#include "netuit/arrange/ImplicitRingTopology.hpp"
+#include "netuit/arrange/ImplicitToroidalTopology.hpp"
+#include "netuit/arrange/RingTopologyFactory.hpp"
+#include "netuit/arrange/ToroidalTopologyFactory.hpp"
+#include "netuit/assign/ReorderProcs.hpp"
+#include "netuit/topology/ImplicitTopology.hpp"
+#include "netuit/topology/LocalTopology.hpp"
+
+TEST_CASE("Test ImplicitTopology neighbors", "[nproc:1]") {
+
+  const netuit::ImplicitRingTopology topology{ 5 };
+
+  REQUIRE( topology.GetSize() == 5 );
+  REQUIRE( topology.GetDegree( 4 ) == 1 );
+  REQUIRE( topology.GetNeighbors( 4 ) == emp::vector<size_t>{ 0 } );
+
+  REQUIRE( topology.GetEdgeID( 4, 0 ) == 5 );
+  REQUIRE( topology.GetEdgeID( 0, 1 ) == 1 );
+  REQUIRE( !topology.GetEdgeID( 1, 0 ) );
+
+}
+
+TEST_CASE("Test ImplicitTopology AsCSR", "[nproc:1]") {
+
+  REQUIRE(
+    netuit::ImplicitToroidalTopology{ {3, 4} }.AsCSR()
+    == netuit::make_toroidal_topology( {3, 4} ).AsCSR()
+  );
+
+  REQUIRE(
+    netuit::ImplicitRingTopology{ 0 }.AsCSR()
+    == netuit::make_ring_topology( 0 ).AsCSR()
+  );
+
+  // partitioner helpers take implicit topologies too
+  const netuit::ImplicitRingTopology ring{ 12 };
+  uitsl::AssignContiguously<uitsl::proc_id_t> assignment{ 3, 12 };
+  REQUIRE(
+    netuit::TallyProcTraffic( ring, assignment, 1 )
+    == netuit::TallyProcTraffic(
+      netuit::make_ring_topology( 12 ), assignment, 1
+    )
+  );
+
+}
+
+TEST_CASE("Test ImplicitTopology GetLocalTopology", "[nproc:1]") {
+
+  const netuit::ImplicitToroidalTopology topology{ {4, 5} };
+  const netuit::Topology explicit_topology = topology.ToTopology();
+
+  for (uitsl::proc_id_t proc{}; proc < 3; ++proc) {
+
+    uitsl::AssignContiguously<uitsl::proc_id_t> assignment{ 3, 20 };
+    emp::vector<size_t> nodes;
+    for (size_t node_id{}; node_id < topology.GetSize(); ++node_id) {
+      if ( assignment( node_id ) == proc ) nodes.push_back( node_id );
+    }
+
+    const netuit::LocalTopology local = topology.GetLocalTopology( nodes );
+    REQUIRE( local.GetNodes() == nodes );
+
+    // every edge with an end on proc, and only those
+    std::unordered_set<size_t> expected;
+    for (const size_t node_id : nodes) {
+      for (const auto& output : explicit_topology[node_id].GetOutputs()) {
+        expected.insert( output.GetEdgeID() );
+      }
+      for (const auto& input : explicit_topology[node_id].GetInputs()) {
+        expected.insert( input.GetEdgeID() );
+      }
+    }
+    REQUIRE( local.GetNumEdges() == expected.size() );
+    for (const auto& edge : local.GetEdges()) {
+      REQUIRE( expected.count( edge.edge_id ) );
+    }
+
+  }
+
+  REQUIRE(
+    topology.GetLocalTopology(
+      uitsl::AssignIntegrated<uitsl::proc_id_t>{}
+    ).GetNumEdges() == 80
+  );
+
+}
@@ -0,0 +1,156 @@
+#include <algorithm>
+
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "uitsl/debug/safe_cast.hpp"
+#include "uitsl/mpi/comm_utils.hpp"
+#include "uitsl/mpi/mpi_guard.hpp"
+#include "uitsl/utility/assign_utils.hpp"
+
+#include "netuit/arrange/ProConTopologyFactory.hpp"
+#include "netuit/arrange/RingTopologyFactory.hpp"
+#include "netuit/arrange/ToroidalTopologyFactory.hpp"
+#include "netuit/topology/LocalTopology.hpp"
+
+using Edge = netuit::LocalTopology::Edge;
+
+// edge i runs from node i to node i + 1
+template<typename Emit>
+void ring_generator(
+  const size_t num_nodes, const size_t node_id, const Emit& emit
+) {
+  const size_t prev = (node_id + num_nodes - 1) % num_nodes;
+  emit( Edge{ prev, prev, node_id } );
+  emit( Edge{ node_id, node_id, (node_id + 1) % num_nodes } );
+}
+
+TEST_CASE("Test LocalTopology", "[nproc:1]") {
+
+  const netuit::LocalTopology topology{
+    { 2, 0, 2 },
+    { Edge{ 1, 2, 5 }, Edge{ 0, 0, 2 }, Edge{ 1, 2, 5 } }
+  };
+
+  REQUIRE( topology.GetNodes() == emp::vector<size_t>{ 0, 2 } );
+  REQUIRE( topology.GetEdges() == emp::vector<Edge>{
+    Edge{ 0, 0, 2 }, Edge{ 1, 2, 5 }
+  } );
+  REQUIRE( topology.GetNumNodes() == 2 );
+  REQUIRE( topology.GetNumEdges() == 2 );
+  REQUIRE( topology.HasNode( 2 ) );
+  REQUIRE( !topology.HasNode( 5 ) );
+
+}
+
+TEST_CASE("Test LocalTopology Generate", "[nproc:1]") {
+
+  const auto topology = netuit::LocalTopology::Generate(
+    { 3, 4 },
+    [](const size_t node_id, const auto& emit){
+      ring_generator( 10, node_id, emit );
+    }
+  );
+
+  REQUIRE( topology.GetNodes() == emp::vector<size_t>{ 3, 4 } );
+  REQUIRE( topology.GetEdges() == emp::vector<Edge>{
+    Edge{ 2, 2, 3 }, Edge{ 3, 3, 4 }, Edge{ 4, 4, 5 }
+  } );
+
+}
+
+TEST_CASE("Test LocalTopology Extract") {
+
+  const size_t num_procs = uitsl::safe_cast<size_t>( uitsl::get_nprocs() );
+  const size_t num_nodes = 10 * num_procs;
+  uitsl::AssignContiguously<uitsl::proc_id_t> proc_assignment{
+    num_procs, num_nodes
+  };
+
+  const auto extracted = netuit::LocalTopology::Extract(
+    netuit::RingTopologyFactory{}( num_nodes ), proc_assignment
+  );
+
+  emp::vector<size_t> nodes;
+  for (size_t node_id{}; node_id < num_nodes; ++node_id) {
+    if ( proc_assignment(node_id) == uitsl::get_proc_id() ) {
+      nodes.push_back( node_id );
+    }
+  }
+  REQUIRE( extracted.GetNodes() == nodes );
+  // plus one edge in from the previous proc's block
+  REQUIRE(
+    extracted.GetNumEdges() == nodes.size() + (num_procs > 1)
+  );
+
+  // every edge touches this proc
+  for (const auto& edge : extracted.GetEdges()) {
+    REQUIRE( (
+      extracted.HasNode( edge.inlet_node )
+      || extracted.HasNode( edge.outlet_node )
+    ) );
+  }
+
+}
+
+TEST_CASE("Test LocalTopology Scatter") {
+
+  const size_t num_procs = uitsl::safe_cast<size_t>( uitsl::get_nprocs() );
+  const auto topology = netuit::ToroidalTopologyFactory{}(
+    { 4, 3 * num_procs }
+  );
+  uitsl::AssignRoundRobin<uitsl::proc_id_t> proc_assignment{
+    num_procs
+  };
+
+  const auto extracted = netuit::LocalTopology::Extract(
+    topology, proc_assignment
+  );
+
+  // deal out every edge in the topology round robin across procs
+  const auto everything = netuit::LocalTopology::Extract(
+    topology, [](size_t){ return uitsl::get_proc_id(); }
+  );
+  emp::vector<Edge> slice;
+  for (size_t i{}; i < everything.GetNumEdges(); ++i) {
+    if ( i % num_procs == uitsl::safe_cast<size_t>( uitsl::get_proc_id() ) ) {
+      slice.push_back( everything.GetEdges()[i] );
+    }
+  }
+
+  const auto scattered = netuit::LocalTopology::Scatter(
+    slice, extracted.GetNodes(), proc_assignment
+  );
+
+  REQUIRE( scattered.GetNodes() == extracted.GetNodes() );
+  REQUIRE( scattered.GetEdges() == extracted.GetEdges() );
+
+}
+
+TEST_CASE("Test LocalTopology Scatter ProCon") {
+
+  const size_t num_procs = uitsl::safe_cast<size_t>( uitsl::get_nprocs() );
+  const auto topology = netuit::ProConTopologyFactory{}( 8 * num_procs );
+  uitsl::AssignContiguously<uitsl::proc_id_t> proc_assignment{
+    num_procs, topology.GetSize()
+  };
+
+  const auto extracted = netuit::LocalTopology::Extract(
+    topology, proc_assignment
+  );
+
+  // one proc holds the whole edge list
+  const auto slice = uitsl::get_proc_id() == 0
+    ? netuit::LocalTopology::Extract(
+      topology, [](size_t){ return uitsl::get_proc_id(); }
+    ).GetEdges()
+    : emp::vector<Edge>{};
+
+  const auto scattered = netuit::LocalTopology::Scatter(
+    slice, extracted.GetNodes(), proc_assignment
+  );
+
+  REQUIRE( scattered.GetEdges() == extracted.GetEdges() );
+
+}
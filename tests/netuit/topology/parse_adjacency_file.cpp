@@ -0,0 +1,59 @@
+#include <fstream>
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uitsl/fetch/make_temp_filepath.hpp"
+
+#include "netuit/arrange/AdjacencyFileTopologyFactory.hpp"
+#include "netuit/arrange/CompleteTopologyFactory.hpp"
+#include "netuit/arrange/ToroidalTopologyFactory.hpp"
+#include "netuit/topology/parse_adjacency_file.hpp"
+#include "netuit/topology/Topology.hpp"
+
+void check_parse(const netuit::Topology& topology) {
+
+  const auto path = uitsl::make_temp_filepath();
+  {
+    std::ofstream file( path );
+    topology.PrintAdjacencyList( file );
+  }
+
+  const netuit::Topology expected
+    = netuit::make_adjacency_file_topology( path );
+
+  for (const size_t num_threads : { 1, 2, 3, 16 }) {
+    const auto parsed = netuit::parse_adjacency_file( path, num_threads );
+    REQUIRE( parsed.GetSize() == expected.GetSize() );
+    REQUIRE( parsed.AsCSR() == expected.AsCSR() );
+
+    // edge ids are numbered in file order, like Topology(std::istream&)
+    const netuit::Topology converted = parsed.ToTopology();
+    for (size_t node_id{}; node_id < expected.GetSize(); ++node_id) {
+      REQUIRE( converted[node_id] == expected[node_id] );
+    }
+  }
+
+}
+
+TEST_CASE("Test parse_adjacency_file", "[nproc:1]") {
+
+  check_parse( netuit::make_complete_topology( 1 ) );
+  check_parse( netuit::make_complete_topology( 15 ) );
+  check_parse( netuit::make_toroidal_topology( {7, 9} ) );
+
+}
+
+TEST_CASE("Test parse_adjacency_file whitespace", "[nproc:1]") {
+
+  const auto path = uitsl::make_temp_filepath();
+  {
+    std::ofstream file( path );
+    file << "0 1  2\r\n\n  1\t0\n2 0";
+  }
+
+  const auto parsed = netuit::parse_adjacency_file( path, 2 );
+  const auto [x_adj, adjacency] = parsed.AsCSR();
+  REQUIRE( x_adj == emp::vector<int32_t>{ 0, 2, 3, 4 } );
+  REQUIRE( adjacency == emp::vector<int32_t>{ 1, 2, 0, 0 } );
+
+}
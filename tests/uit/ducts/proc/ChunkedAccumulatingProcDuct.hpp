@@ -0,0 +1,64 @@
+#include "VectorAccumulatingProcDuct.hpp"
+
+#define CAPD_IMPL_NAME IMPL_NAME "ChunkedAccumulatingProcDuct"
+
+// spans several chunks of the default chunk size
+constexpr size_t large_message_size = 100 * std::kilo::num;
+
+template <typename T>
+decltype(auto) make_ring_large_capd_bundle() {
+  netuit::Mesh<T> mesh{
+    netuit::RingTopologyFactory{}(uitsl::get_nprocs()),
+    uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+    netuit::AssignAvailableProcs{},
+    std::make_shared<typename T::ProcBackEnd>( large_message_size )
+  };
+
+  auto bundles = mesh.GetSubmesh();
+
+  REQUIRE( bundles.size() == 1);
+
+  return std::tuple{ bundles[0].GetInput(0), bundles[0].GetOutput(0) };
+
+}
+
+TEST_CASE("Large message validity " CAPD_IMPL_NAME, "[ChunkedAccumulatingProcDuct]" TAGS) {
+
+  auto [input, output] = make_ring_large_capd_bundle<Spec>();
+
+  constexpr int num_puts = 10;
+  MSG_T sum( large_message_size );
+
+  const auto accumulate = [&sum, &input=input](){
+    const MSG_T& received = input.JumpGet();
+    REQUIRE( received.size() == large_message_size );
+    std::transform(
+      std::begin(received),
+      std::end(received),
+      std::begin(sum),
+      std::begin(sum),
+      std::plus{}
+    );
+  };
+
+  for (int msg = 0; msg < num_puts; ++msg) {
+    output.Put( MSG_T(large_message_size, 1) );
+    accumulate();
+  }
+
+  // chunks are summed as they land, so items may briefly disagree
+  while ( std::any_of(
+    std::begin(sum),
+    std::end(sum),
+    [](const auto val){ return val != num_puts; }
+  ) ) {
+    for (const auto val : sum) REQUIRE( val <= num_puts );
+    output.TryFlush();
+    accumulate();
+  }
+
+  while ( !output.TryFlush() );
+
+  UITSL_Barrier(MPI_COMM_WORLD);
+
+}
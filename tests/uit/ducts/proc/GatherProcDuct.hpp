@@ -0,0 +1,149 @@
+#include <algorithm>
+#include <iterator>
+#include <ratio>
+
+#include <mpi.h>
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "netuit/assign/AssignAvailableProcs.hpp"
+#include "uitsl/datastructs/GatherSpan.hpp"
+#include "uitsl/mpi/mpi_utils.hpp"
+
+#include "uit/setup/ImplSpec.hpp"
+
+#include "netuit/arrange/DyadicTopologyFactory.hpp"
+#include "netuit/mesh/Mesh.hpp"
+#include "netuit/mesh/MeshNodeInput.hpp"
+#include "netuit/mesh/MeshNodeOutput.hpp"
+
+using MSG_T = uitsl::GatherSpan<int>;
+using Spec = uit::ImplSpec<MSG_T, ImplSel>;
+
+#define REPEAT for (size_t rep = 0; rep < std::deca::num; ++rep)
+
+#define GPD_IMPL_NAME IMPL_NAME "GatherProcDuct"
+#ifndef TAGS
+#define TAGS ""
+#endif
+
+template <typename T>
+decltype(auto) make_dyadic_gpd_bundle() {
+
+  netuit::Mesh<T> mesh{
+    netuit::DyadicTopologyFactory{}(uitsl::get_nprocs()),
+    uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+    netuit::AssignAvailableProcs{}
+  };
+
+  auto bundles = mesh.GetSubmesh();
+  REQUIRE( bundles.size() == 1 );
+
+  return std::tuple{ bundles[0].GetInput(0), bundles[0].GetOutput(0) };
+
+};
+
+// a header and an array, not adjacent in memory
+struct Message {
+  int seq;
+  emp::vector<int> payload;
+  int checksum;
+};
+
+TEST_CASE("Contiguous puts " GPD_IMPL_NAME, "[GatherProcDuct]" TAGS) { REPEAT {
+
+  auto [input, output] = make_dyadic_gpd_bundle<Spec>();
+
+  REQUIRE( input.JumpGet() == MSG_T{} );
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+  output.Put({42, 43});
+  output.Flush();
+  while( input.JumpGet() != MSG_T{42, 43} );
+
+  REQUIRE( input.Get().size() == 2 );
+  REQUIRE( input.Get().data()[0] == 42 );
+  REQUIRE( input.Get().data()[1] == 43 );
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+} }
+
+TEST_CASE("Gathered puts " GPD_IMPL_NAME, "[GatherProcDuct]" TAGS) { REPEAT {
+
+  auto [input, output] = make_dyadic_gpd_bundle<Spec>();
+
+  Message message{ 0, emp::vector<int>( 3 ), 0 };
+
+  int last{ -1 };
+  for (int msg = 0; msg < std::kilo::num; ++msg) {
+
+    message.seq = msg;
+    for (auto& val : message.payload) val = msg;
+    message.checksum = -msg;
+
+    MSG_T gather;
+    gather.AddSegment( &message.seq, 1 );
+    gather.AddSegment( message.payload.data(), message.payload.size() );
+    gather.AddSegment( &message.checksum, 1 );
+    REQUIRE( gather.size() == 5 );
+
+    output.TryPut( gather );
+    // segments must not change until sends complete
+    output.Flush();
+
+    const MSG_T& current = input.JumpGet();
+    if ( current.size() ) {
+      REQUIRE( current.size() == 5 );
+      const int* received = current.data();
+      REQUIRE( received[0] >= last );
+      REQUIRE( received[0] <= msg );
+      for (size_t i{1}; i < 4; ++i) REQUIRE( received[i] == received[0] );
+      REQUIRE( received[4] == -received[0] );
+      last = received[0];
+    }
+
+  }
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+} }
+
+TEST_CASE("Changing segment shapes " GPD_IMPL_NAME, "[GatherProcDuct]" TAGS) {
+
+  auto [input, output] = make_dyadic_gpd_bundle<Spec>();
+
+  const emp::vector<int> first{ 1, 2, 3 };
+  const emp::vector<int> second{ 4, 5 };
+
+  // revisit each shape several times
+  for (size_t len{}; len < 100; ++len) {
+
+    MSG_T gather;
+    gather.AddSegment( second.data(), len % second.size() );
+    gather.AddSegment( first.data(), len % first.size() );
+
+    output.Put( gather );
+    output.Flush();
+
+    MSG_T expected;
+    emp::vector<int> flat(
+      std::begin(second), std::next(std::begin(second), len % second.size())
+    );
+    flat.insert(
+      std::end(flat),
+      std::begin(first), std::next(std::begin(first), len % first.size())
+    );
+    expected.resize( flat.size() );
+    std::copy( std::begin(flat), std::end(flat), expected.data() );
+
+    REQUIRE( input.GetNext() == expected );
+
+  }
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+}
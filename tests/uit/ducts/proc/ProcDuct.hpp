@@ -27,7 +27,11 @@
 #include "netuit/mesh/MeshNodeOutput.hpp"
 
 using MSG_T = int;
+#ifdef IMPL_SPEC
+using Spec = IMPL_SPEC;
+#else
 using Spec = uit::ImplSpec<MSG_T, ImplSel>;
+#endif
 
 #define REPEAT for (size_t rep = 0; rep < std::deca::num; ++rep)
 
@@ -45,12 +49,17 @@ TEST_CASE("Reset MeshIDCounter" PD_IMPL_NAME, "[ProcDuct][nproc:1]") {
 
 
 template <typename T>
-decltype(auto) make_dyadic_pd_bundle() {
+decltype(auto) make_dyadic_pd_bundle(
+  const netuit::MeshCommStrategy comm_strategy=netuit::MeshCommStrategy::shared
+) {
 
   netuit::Mesh<T> mesh{
     netuit::DyadicTopologyFactory{}(uitsl::get_nprocs()),
     uitsl::AssignIntegrated<uitsl::thread_id_t>{},
-    netuit::AssignAvailableProcs{}
+    netuit::AssignAvailableProcs{},
+    std::make_shared<typename T::ProcBackEnd>(),
+    MPI_COMM_WORLD,
+    comm_strategy
   };
 
   auto bundles = mesh.GetSubmesh();
@@ -202,6 +211,31 @@ TEST_CASE("Unmatched gets" PD_IMPL_NAME, "[ProcDuct]" TAGS) { REPEAT {
 
 } }
 
+TEST_CASE("Duplicated duct comms" PD_IMPL_NAME, "[ProcDuct]" TAGS) {
+
+  for (const auto comm_strategy : {
+    netuit::MeshCommStrategy::per_outlet_thread,
+    netuit::MeshCommStrategy::per_thread_pair,
+    netuit::MeshCommStrategy::dedicated
+  }) {
+
+    // mesh is torn down before ducts are used
+    auto [input, output] = make_dyadic_pd_bundle<Spec>( comm_strategy );
+
+    UITSL_Barrier( MPI_COMM_WORLD );
+
+    output.Put(42);
+    output.TryFlush();
+    while( input.JumpGet() != 42);
+
+    REQUIRE( input.JumpGet() == 42 );
+
+    UITSL_Barrier( MPI_COMM_WORLD );
+
+  }
+
+}
+
 TEST_CASE("Unmatched puts" PD_IMPL_NAME, "[ProcDuct]" TAGS) { REPEAT {
 
   auto [input, output] = make_dyadic_pd_bundle<Spec>();
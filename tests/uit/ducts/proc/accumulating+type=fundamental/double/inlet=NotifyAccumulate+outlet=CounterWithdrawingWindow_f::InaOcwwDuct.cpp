@@ -0,0 +1,16 @@
+#include "uit/ducts/intra/accumulating+type=any/a::AccumulatingDuct.hpp"
+#include "uit/ducts/mock/ThrowDuct.hpp"
+#include "uit/ducts/proc/accumulating+type=fundamental/inlet=NotifyAccumulate+outlet=CounterWithdrawingWindow_f::InaOcwwDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+using ImplSel = uit::ImplSelect<
+  uit::a::AccumulatingDuct,
+  uit::ThrowDuct,
+  uit::f::InaOcwwDuct
+>;
+
+using MSG_T = double;
+#define IMPL_NAME "inlet=NotifyAccumulate+outlet=CounterWithdrawingWindow_f::InaOcwwDuct/double"
+#define TAGS "[nproc:2][nproc:3][nproc:4]"
+
+#include "../../AccumulatingProcDuct.hpp"
@@ -0,0 +1,15 @@
+#include "uit/ducts/mock/ThrowDuct.hpp"
+#include "uit/ducts/proc/accumulating+type=span/chunked+inlet=ChunkedIsend+outlet=ChunkedIrecv_s::ChunkedIciOciDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+using ImplSel = uit::ImplSelect<
+  uit::ThrowDuct,
+  uit::ThrowDuct,
+  uit::s::ChunkedIciOciDuct
+>;
+
+#define MSG_VALUE_T double
+#define IMPL_NAME "chunked+inlet=ChunkedIsend+outlet=ChunkedIrecv_s::ChunkedIciOciDuct/double"
+#define TAGS "[nproc:2][nproc:3][nproc:4]"
+
+#include "../../ChunkedAccumulatingProcDuct.hpp"
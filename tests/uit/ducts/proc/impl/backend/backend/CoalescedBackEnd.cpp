@@ -0,0 +1,97 @@
+#include <ratio>
+#include <thread>
+
+#include <mpi.h>
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uitsl/mpi/audited_routines.hpp"
+#include "uitsl/mpi/mpi_utils.hpp"
+#include "uitsl/mpi/MpiMultithreadGuard.hpp"
+#include "uitsl/parallel/ThreadTeam.hpp"
+#include "uitsl/utility/assign_utils.hpp"
+
+#include "uit/ducts/intra/put=dropping+get=stepping+type=any/a::SerialPendingDuct.hpp"
+#include "uit/ducts/proc/impl/backend/CoalescedBackEnd.hpp"
+#include "uit/ducts/proc/put=dropping+get=stepping+type=cereal/coalesced+inlet=RingIsend+outlet=Iprobe_c::CoalescedIriOiDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=stepping+type=cereal/inlet=RingIsend+outlet=Iprobe_c::IriOiDuct.hpp"
+#include "uit/ducts/thread/put=dropping+get=stepping+type=any/a::AtomicPendingDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+#include "netuit/arrange/RingTopologyFactory.hpp"
+#include "netuit/mesh/Mesh.hpp"
+
+// threads deposit and flush combined frames concurrently
+const uitsl::MpiMultithreadGuard guard;
+
+template<typename ImplSpec>
+using AggregatorDuct = uit::c::IriOiDuct<ImplSpec>;
+
+TEST_CASE("Test CoalescedBackEnd") {
+
+  using Spec = uit::ImplSpec<char>;
+
+  uit::CoalescedBackEnd< Spec, AggregatorDuct >{};
+
+}
+
+TEST_CASE("CoalescedBackEnd delivers across threads") {
+
+  using Spec = uit::ImplSpec<
+    int,
+    uit::ImplSelect<
+      uit::a::SerialPendingDuct,
+      uit::a::AtomicPendingDuct,
+      uit::c::CoalescedIriOiDuct
+    >
+  >;
+
+  constexpr uitsl::thread_id_t num_threads{ 3 };
+  const size_t num_procs = uitsl::get_nprocs();
+  const size_t num_nodes = num_threads * num_procs;
+
+  // each node receives from the previous proc, so every thread on a proc
+  // sends through the same coalescer
+  netuit::Mesh<Spec> mesh{
+    netuit::RingTopologyFactory{}( num_nodes ),
+    uitsl::AssignContiguously<uitsl::thread_id_t>{ num_threads, num_nodes },
+    uitsl::AssignRoundRobin<uitsl::proc_id_t>{ num_procs }
+  };
+
+  uitsl::ThreadTeam team;
+  for (uitsl::thread_id_t thread = 0; thread < num_threads; ++thread) {
+    team.Add( [&mesh, thread](){
+
+      auto node = mesh.GetSubmesh( thread ).front();
+      auto& input = node.GetInput( 0 );
+      auto& output = node.GetOutput( 0 );
+
+      int latest{};
+      for (int i = 1; i <= std::kilo::num; ++i) {
+        output.TryPut( i );
+        output.TryFlush();
+        const int got = input.JumpGet();
+        REQUIRE( got >= latest );
+        latest = got;
+        std::this_thread::yield();
+      }
+
+    } );
+  }
+  team.Join();
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+  // every node eventually hears from its neighbor
+  for (uitsl::thread_id_t thread = 0; thread < num_threads; ++thread) {
+    auto node = mesh.GetSubmesh( thread ).front();
+    auto& input = node.GetInput( 0 );
+    for (size_t i{}; i < std::mega::num && input.JumpGet() == 0; ++i) {
+      std::this_thread::yield();
+    }
+    REQUIRE( input.Get() > 0 );
+  }
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+}
@@ -0,0 +1,64 @@
+#include <sstream>
+
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+#include "cereal/include/cereal/archives/binary.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "uit/ducts/proc/impl/backend/impl/AggregationFrame.hpp"
+
+TEST_CASE("Test AggregationFrame layout", "[nproc:1]") {
+
+  uit::AggregationFrame<int> frame;
+  REQUIRE( frame.GetNumSlots() == 0 );
+  REQUIRE( frame.IsEmpty() );
+
+  const emp::vector<int> first{ 1, 2, 3 };
+  const emp::vector<int> second{};
+  const emp::vector<int> third{ 4 };
+
+  frame.AppendSlot( 7, std::begin(first), std::end(first) );
+  frame.AppendSlot( 9, std::begin(second), std::end(second) );
+  frame.AppendSlot( 3, std::begin(third), std::end(third) );
+
+  REQUIRE( frame.GetNumSlots() == 3 );
+  REQUIRE( frame.GetNumPayloads() == 4 );
+
+  REQUIRE( frame.GetTag(0) == 7 );
+  REQUIRE( frame.GetTag(1) == 9 );
+  REQUIRE( frame.GetTag(2) == 3 );
+
+  REQUIRE( frame.GetCount(0) == 3 );
+  REQUIRE( frame.GetCount(1) == 0 );
+  REQUIRE( frame.GetCount(2) == 1 );
+
+  REQUIRE( frame.GetOffset(0) == 0 );
+  REQUIRE( frame.GetOffset(1) == 3 );
+  REQUIRE( frame.GetOffset(2) == 3 );
+
+  REQUIRE( frame.GetPayload(0, 2) == 3 );
+  REQUIRE( frame.GetPayload(2, 0) == 4 );
+  REQUIRE( frame.GetSlot(1).empty() );
+
+  frame.Reset();
+  REQUIRE( frame.GetNumSlots() == 0 );
+  REQUIRE( frame.IsEmpty() );
+
+}
+
+TEST_CASE("Test AggregationFrame serialization", "[nproc:1]") {
+
+  uit::AggregationFrame<int> frame;
+  const emp::vector<int> data{ 1, 2, 3 };
+  frame.AppendSlot( 42, std::begin(data), std::end(data) );
+  frame.AppendSlot( 0, std::begin(data), std::next(std::begin(data)) );
+
+  std::stringstream ss;
+  { cereal::BinaryOutputArchive oarchive( ss ); oarchive( frame ); }
+
+  uit::AggregationFrame<int> res;
+  { cereal::BinaryInputArchive iarchive( ss ); iarchive( res ); }
+
+  REQUIRE( res == frame );
+
+}
@@ -0,0 +1,131 @@
+#include <ratio>
+
+#include <mpi.h>
+
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "uit/ducts/proc/impl/backend/impl/AggregatorSpec.hpp"
+#include "uit/ducts/proc/impl/backend/impl/InletFrameCoalescer.hpp"
+#include "uit/ducts/proc/put=dropping+get=stepping+type=cereal/inlet=RingIsend+outlet=Iprobe_c::IriOiDuct.hpp"
+#include "uit/fixtures/Source.hpp"
+#include "uit/setup/ImplSpec.hpp"
+#include "uit/setup/InterProcAddress.hpp"
+
+using AggregatorSpec = uit::AggregatorSpec<
+  uit::ImplSpec<char>,
+  uit::c::IriOiDuct
+>;
+using frame_t = AggregatorSpec::T;
+
+TEST_CASE("Test InletFrameCoalescer", "[nproc:1]") {
+
+  // two inlet threads on this proc, each with a duct to this proc
+  const uit::InterProcAddress first{ 0, 0, 0, 0, 0, MPI_COMM_SELF };
+  const uit::InterProcAddress second{ 0, 0, 0, 1, 1, MPI_COMM_SELF };
+
+  uit::InletFrameCoalescer<AggregatorSpec> coalescer;
+  coalescer.Register( first );
+  coalescer.Register( second );
+  REQUIRE( coalescer.GetSize() == 2 );
+  REQUIRE( !coalescer.IsInitialized() );
+
+  // receive combined frames through a plain backing duct outlet
+  auto backend = std::make_shared<AggregatorSpec::ProcBackEnd>();
+  auto [outlet] = uit::Source<AggregatorSpec>{
+    std::in_place_type_t<AggregatorSpec::ProcOutletDuct>{},
+    first,
+    backend
+  };
+  backend->Initialize();
+
+  coalescer.Initialize();
+  REQUIRE( coalescer.IsInitialized() );
+
+  auto first_inlet = coalescer.GetSegmentInlet( 0 );
+  auto second_inlet = coalescer.GetSegmentInlet( 1 );
+
+  const emp::vector<char> payload{ 'a', 'b' };
+  frame_t frame;
+  frame.AppendSlot( first.GetTag(), std::begin(payload), std::end(payload) );
+
+  REQUIRE( first_inlet.TryPut( frame ) );
+  REQUIRE( first_inlet.TryFlush() );
+
+  // round is incomplete, so nothing went out and the segment is still full
+  REQUIRE( !first_inlet.TryPut( frame ) );
+  REQUIRE( !first_inlet.TryFlush() );
+  REQUIRE( outlet.TryStep( 1 ) == 0 );
+
+  // second thread has nothing to send but completes the round by flushing
+  REQUIRE( second_inlet.TryFlush() );
+
+  while ( outlet.TryStep( 1 ) == 0 );
+  const auto& received = outlet.Get();
+  REQUIRE( received.GetNumSlots() == 1 );
+  REQUIRE( received.GetTag( 0 ) == first.GetTag() );
+  REQUIRE( received.GetCount( 0 ) == payload.size() );
+  REQUIRE( received.GetPayload( 0, 0 ) == 'a' );
+  REQUIRE( received.GetPayload( 0, 1 ) == 'b' );
+
+  // segments reopen once the round has gone out
+  REQUIRE( first_inlet.TryPut( frame ) );
+  REQUIRE( coalescer.TryDeposit( 1, frame_t{} ) );
+  REQUIRE( first_inlet.TryFlush() );
+
+  // rounds where no thread put anything send nothing
+  REQUIRE( first_inlet.TryFlush() );
+  REQUIRE( second_inlet.TryFlush() );
+
+  while ( outlet.TryStep( 1 ) == 0 );
+  REQUIRE( outlet.Get() == frame );
+  REQUIRE( outlet.TryStep( 1 ) == 0 );
+
+}
+
+TEST_CASE("Test InletFrameCoalescer with a full backing duct", "[nproc:1]") {
+
+  // small ring of sends, so the backing duct fills quickly
+  using SmallAggregatorSpec = uit::AggregatorSpec<
+    uit::ImplSpec<char, uit::ImplSelect<>, uit::DefaultSpoutWrapper, 2>,
+    uit::c::IriOiDuct
+  >;
+  using small_frame_t = SmallAggregatorSpec::T;
+
+  const uit::InterProcAddress address{ 0, 0, 0, 0, 0, MPI_COMM_SELF };
+
+  uit::InletFrameCoalescer<SmallAggregatorSpec> coalescer;
+  coalescer.Register( address );
+
+  auto backend = std::make_shared<SmallAggregatorSpec::ProcBackEnd>();
+  auto [outlet] = uit::Source<SmallAggregatorSpec>{
+    std::in_place_type_t<SmallAggregatorSpec::ProcOutletDuct>{},
+    address,
+    backend
+  };
+  backend->Initialize();
+
+  coalescer.Initialize();
+  auto inlet = coalescer.GetSegmentInlet( 0 );
+
+  // large enough that sends stay outstanding until received
+  const emp::vector<char> payload( std::mega::num, 'a' );
+  small_frame_t frame;
+  frame.AppendSlot( address.GetTag(), std::begin(payload), std::end(payload) );
+
+  // with one thread, every deposit completes a round, until a combined
+  // frame is held back and the next deposit is refused
+  size_t num_deposited{};
+  while ( num_deposited < 100 && inlet.TryPut( frame ) ) ++num_deposited;
+  REQUIRE( num_deposited < 100 );
+
+  // every accepted deposit arrives, none dropped
+  size_t num_received{};
+  for (size_t i{}; i < 100 * std::kilo::num; ++i) {
+    num_received += outlet.TryStep( 1 );
+    inlet.TryFlush();
+  }
+  REQUIRE( num_received == num_deposited );
+
+}
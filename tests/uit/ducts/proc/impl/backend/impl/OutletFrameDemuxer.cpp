@@ -0,0 +1,92 @@
+#include <mpi.h>
+
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "uit/ducts/proc/impl/backend/impl/AggregatorSpec.hpp"
+#include "uit/ducts/proc/impl/backend/impl/OutletFrameDemuxer.hpp"
+#include "uit/ducts/proc/put=dropping+get=stepping+type=cereal/inlet=RingIsend+outlet=Iprobe_c::IriOiDuct.hpp"
+#include "uit/fixtures/Sink.hpp"
+#include "uit/setup/ImplSpec.hpp"
+#include "uit/setup/InterProcAddress.hpp"
+
+using AggregatorSpec = uit::AggregatorSpec<
+  uit::ImplSpec<char>,
+  uit::c::IriOiDuct
+>;
+using frame_t = AggregatorSpec::T;
+
+TEST_CASE("Test OutletFrameDemuxer", "[nproc:1]") {
+
+  // two outlet threads on this proc, each with a duct from this proc
+  const uit::InterProcAddress first{ 0, 0, 0, 0, 0, MPI_COMM_SELF };
+  const uit::InterProcAddress second{ 0, 0, 1, 0, 1, MPI_COMM_SELF };
+
+  uit::OutletFrameDemuxer<AggregatorSpec> demuxer;
+  demuxer.Register( first );
+  demuxer.Register( second );
+  REQUIRE( demuxer.GetSize() == 2 );
+  REQUIRE( !demuxer.IsInitialized() );
+
+  // send combined frames through a plain backing duct inlet
+  auto backend = std::make_shared<AggregatorSpec::ProcBackEnd>();
+  auto [inlet] = uit::Sink<AggregatorSpec>{
+    std::in_place_type_t<AggregatorSpec::ProcInletDuct>{},
+    first,
+    backend
+  };
+  backend->Initialize();
+
+  demuxer.Initialize();
+  REQUIRE( demuxer.IsInitialized() );
+
+  auto first_outlet = demuxer.GetChannelOutlet( 0 );
+  auto second_outlet = demuxer.GetChannelOutlet( 1 );
+
+  // initial frames are empty
+  REQUIRE( first_outlet.Get().IsEmpty() );
+  REQUIRE( second_outlet.Get().IsEmpty() );
+  REQUIRE( first_outlet.TryStep( 1 ) == 0 );
+
+  const emp::vector<char> first_payload{ 'a', 'b' };
+  const emp::vector<char> second_payload{ 'c' };
+
+  frame_t combined;
+  combined.AppendSlot(
+    first.GetTag(), std::begin(first_payload), std::end(first_payload)
+  );
+  combined.AppendSlot(
+    second.GetTag(), std::begin(second_payload), std::end(second_payload)
+  );
+  REQUIRE( inlet.TryPut( combined ) );
+  REQUIRE( inlet.TryFlush() );
+
+  while ( second_outlet.TryStep( 1 ) == 0 );
+  REQUIRE( second_outlet.Get().GetNumSlots() == 1 );
+  REQUIRE( second_outlet.Get().GetTag( 0 ) == second.GetTag() );
+  REQUIRE( second_outlet.Get().GetPayload( 0, 0 ) == 'c' );
+
+  // the first thread's share was split off alongside the second's
+  REQUIRE( first_outlet.TryStep( 1 ) == 1 );
+  REQUIRE( first_outlet.Get().GetNumSlots() == 1 );
+  REQUIRE( first_outlet.Get().GetTag( 0 ) == first.GetTag() );
+  REQUIRE( first_outlet.Get().GetCount( 0 ) == first_payload.size() );
+  REQUIRE( first_outlet.Get().GetPayload( 0, 1 ) == 'b' );
+
+  // threads with no share in a frame get nothing new
+  frame_t partial;
+  partial.AppendSlot(
+    first.GetTag(), std::begin(first_payload), std::end(first_payload)
+  );
+  partial.AppendSlot(
+    second.GetTag(), std::begin(second_payload), std::begin(second_payload)
+  );
+  REQUIRE( inlet.TryPut( partial ) );
+  REQUIRE( inlet.TryFlush() );
+
+  while ( first_outlet.TryStep( 1 ) == 0 );
+  REQUIRE( second_outlet.TryStep( 1 ) == 0 );
+  REQUIRE( second_outlet.Get().GetPayload( 0, 0 ) == 'c' );
+
+}
@@ -1,18 +1,84 @@
+#include <deque>
+#include <stddef.h>
+
 #define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
 #include "Catch/single_include/catch2/catch.hpp"
 
+#include "uitsl/mpi/mpi_guard.hpp"
+#include "uitsl/mpi/mpi_utils.hpp"
+
 #include "uit/ducts/proc/impl/backend/impl/AggregatorSpec.hpp"
 #include "uit/ducts/proc/impl/backend/impl/OutletMemoryAggregator.hpp"
 #include "uit/ducts/proc/put=dropping+get=stepping+type=cereal/inlet=RingIsend+outlet=Iprobe_c::IriOiDuct.hpp"
 #include "uit/setup/ImplSpec.hpp"
 
+namespace {
+
+using AggregatorSpec = uit::AggregatorSpec<
+  uit::ImplSpec<int, uit::ImplSelect<>, uit::DefaultSpoutWrapper, 4>,
+  uit::c::IriOiDuct
+>;
+
+using frame_t = typename AggregatorSpec::T;
+
+// serves frames queued by the test
+struct MockFrameOutlet {
+
+  std::deque<frame_t>* queue;
+
+  frame_t cur{};
+
+  size_t TryStep(const size_t num_steps) {
+    size_t res{};
+    while ( res < num_steps && !queue->empty() ) {
+      cur = std::move( queue->front() );
+      queue->pop_front();
+      ++res;
+    }
+    return res;
+  }
+
+  frame_t& Get() { return cur; }
+
+};
+
+frame_t make_frame(const int tag, const int first, const int last) {
+  frame_t res;
+  std::vector<int> payloads;
+  for (int i = first; i < last; ++i) payloads.push_back( i );
+  res.AppendSlot( tag, std::begin(payloads), std::end(payloads) );
+  return res;
+}
+
+} // namespace
+
 TEST_CASE("Test OutletMemoryAggregator") {
 
-  // TODO flesh out stub test
-  using AggregatorSpec = uit::AggregatorSpec<
-    uit::ImplSpec<char>,
-    uit::c::IriOiDuct
-  >;
-  uit::OutletMemoryAggregator<AggregatorSpec>{};
+  const uitsl::proc_id_t rank = uitsl::get_rank();
+
+  std::deque<frame_t> queue;
+  uit::OutletMemoryAggregator<AggregatorSpec, MockFrameOutlet> aggregator;
+  aggregator.Register( uit::InterProcAddress{ rank, rank, 0, 0, 0 } );
+  aggregator.Register( uit::InterProcAddress{ rank, rank, 0, 0, 1 } );
+  aggregator.Initialize( MockFrameOutlet{ &queue } );
+
+  REQUIRE( aggregator.Get( 0 ) == 0 );
+  REQUIRE( aggregator.Get( 1 ) == 0 );
+
+  // slot 0 reads frames as they arrive, slot 1 never steps
+  for (int i{}; i < 16; ++i) {
+    queue.push_back( make_frame( 0, 10 * i, 10 * i + 2 ) );
+    REQUIRE( aggregator.TryConsumeGets( 2, 0 ) == 2 );
+    REQUIRE( aggregator.Get( 0 ) == 10 * i + 1 );
+    REQUIRE( aggregator.Get( 1 ) == 0 );
+  }
+
+  // slot 1's idle cursor does not pin stale frames, and it picks up data
+  // arriving after its value was parked
+  queue.push_back( make_frame( 1, 100, 103 ) );
+  REQUIRE( aggregator.TryConsumeGets( 1, 0 ) == 0 );
+  REQUIRE( aggregator.TryConsumeGets( 3, 1 ) == 3 );
+  REQUIRE( aggregator.Get( 1 ) == 102 );
+  REQUIRE( aggregator.Get( 0 ) == 151 );
 
 }
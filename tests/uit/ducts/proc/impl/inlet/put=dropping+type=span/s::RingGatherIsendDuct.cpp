@@ -0,0 +1,21 @@
+#include <memory>
+
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uit/ducts/proc/impl/inlet/put=dropping+type=span/s::RingGatherIsendDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+#include "uit/setup/InterProcAddress.hpp"
+#include "uitsl/datastructs/GatherSpan.hpp"
+
+TEST_CASE("Test s::RingGatherIsendDuct") {
+
+  using ImplSpec = uit::MockSpec<uitsl::GatherSpan<char>>;
+  using BackEnd = uit::s::RingGatherIsendDuct<ImplSpec>::BackEndImpl;
+
+  // TODO flesh out stub test
+  uit::InterProcAddress address;
+  std::shared_ptr<BackEnd> backing{ std::make_shared<BackEnd>() };
+  uit::s::RingGatherIsendDuct<ImplSpec>{ address, backing };
+
+}
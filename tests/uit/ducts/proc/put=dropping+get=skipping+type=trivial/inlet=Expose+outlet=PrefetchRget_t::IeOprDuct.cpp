@@ -0,0 +1,15 @@
+#include "uit/ducts/mock/ThrowDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=skipping+type=trivial/inlet=Expose+outlet=PrefetchRget_t::IeOprDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+using ImplSel = uit::ImplSelect<
+  uit::a::SerialPendingDuct,
+  uit::ThrowDuct,
+  uit::t::IeOprDuct
+>;
+
+#define IMPL_NAME "inlet=Expose+outlet=PrefetchRget_t::IeOprDuct"
+#define TAGS "[nproc:2][nproc:3][nproc:4][nproc:5][nproc:6][nproc:7][nproc:8]"
+
+#include "../ProcDuct.hpp"
+#include "../SkippingProcDuct.hpp"
@@ -0,0 +1,14 @@
+#include "uit/ducts/mock/ThrowDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=stepping+type=cereal/coalesced+inlet=RingIsend+outlet=Iprobe_c::CoalescedIriOiDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+using ImplSel = uit::ImplSelect<
+  uit::a::SerialPendingDuct,
+  uit::ThrowDuct,
+  uit::c::CoalescedIriOiDuct
+>;
+
+#define IMPL_NAME "coalesced+inlet=RingIsend+outlet=Iprobe_c::CoalescedIriOiDuct"
+
+#include "../ProcDuct.hpp"
+#include "../SteppingProcDuct.hpp"
@@ -0,0 +1,13 @@
+#include "uit/ducts/mock/ThrowDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=stepping+type=span/inlet=RingGatherIsend+outlet=Iprobe_s::IrgiOiDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+using ImplSel = uit::ImplSelect<
+  uit::a::SerialPendingDuct,
+  uit::ThrowDuct,
+  uit::s::IrgiOiDuct
+>;
+
+#define IMPL_NAME "inlet=RingGatherIsend+outlet=Iprobe_s::IrgiOiDuct"
+
+#include "../GatherProcDuct.hpp"
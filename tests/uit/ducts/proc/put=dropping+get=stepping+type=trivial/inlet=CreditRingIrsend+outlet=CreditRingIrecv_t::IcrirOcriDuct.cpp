@@ -0,0 +1,15 @@
+#include "uit/ducts/mock/ThrowDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=stepping+type=trivial/inlet=CreditRingIrsend+outlet=CreditRingIrecv_t::IcrirOcriDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+using ImplSel = uit::ImplSelect<
+  uit::a::SerialPendingDuct,
+  uit::ThrowDuct,
+  uit::t::IcrirOcriDuct
+>;
+
+#define IMPL_NAME "inlet=CreditRingIrsend+outlet=CreditRingIrecv_t::IcrirOcriDuct"
+#define TAGS "[nproc:2][nproc:3][nproc:4]"
+
+#include "../ProcDuct.hpp"
+#include "../SkippingProcDuct.hpp"
@@ -0,0 +1,44 @@
+#include <algorithm>
+#include <array>
+#include <ratio>
+
+#include "uit/ducts/mock/ThrowDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=stepping+type=trivial/inlet=CreditRingIsend+outlet=CreditRingIrecv_t::IcriOcriDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+using ImplSel = uit::ImplSelect<
+  uit::a::SerialPendingDuct,
+  uit::ThrowDuct,
+  uit::t::IcriOcriDuct
+>;
+
+#define IMPL_NAME "inlet=CreditRingIsend+outlet=CreditRingIrecv_t::IcriOcriDuct"
+#define TAGS "[nproc:2][nproc:3][nproc:4]"
+
+#include "../ProcDuct.hpp"
+#include "../SkippingProcDuct.hpp"
+
+TEST_CASE("Teardown with a full ring in flight " IMPL_NAME, "[ProcDuct]" TAGS) { REPEAT {
+
+  // large enough to be sent by rendezvous, so receives that matched before
+  // the end-of-data message may still be transferring during teardown
+  using big_t = std::array<char, 64 * std::kilo::num>;
+  using BigSpec = uit::ImplSpec<big_t, ImplSel>;
+
+  auto [input, output] = make_dyadic_pd_bundle<BigSpec>();
+
+  big_t msg;
+  for (size_t i{}; i < 2 * uit::DEFAULT_BUFFER; ++i) {
+    msg.fill( static_cast<char>(i) );
+    output.TryPut( msg );
+  }
+  output.TryFlush();
+
+  // whatever arrives before teardown is intact
+  const auto& res = input.JumpGet();
+  REQUIRE( std::all_of(
+    std::begin(res), std::end(res),
+    [&res](const char c){ return c == res.front(); }
+  ) );
+
+} }
@@ -0,0 +1,35 @@
+#include <limits>
+
+#include "uitsl/mpi/MpiMultithreadGuard.hpp"
+
+#include "uit/ducts/mock/ThrowDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=stepping+type=trivial/inlet=ProgressRingIsend+outlet=ProgressRingIrecv_t::IpriOpriDuct.hpp"
+#include "uit/setup/FlushPolicy.hpp"
+#include "uit/setup/ImplSpec.hpp"
+#include "uit/setup/ProgressPolicy.hpp"
+
+// the progress thread calls into MPI alongside the test thread
+const uitsl::MpiMultithreadGuard guard;
+
+using ImplSel = uit::ImplSelect<
+  uit::a::SerialPendingDuct,
+  uit::ThrowDuct,
+  uit::t::IpriOpriDuct
+>;
+
+#define IMPL_SPEC uit::ImplSpec< \
+  MSG_T, \
+  ImplSel, \
+  uit::DefaultSpoutWrapper, \
+  uit::DEFAULT_BUFFER, \
+  std::numeric_limits<size_t>::max(), \
+  2, \
+  uit::ManualFlushPolicy, \
+  uit::ThreadProgressPolicy \
+>
+
+#define IMPL_NAME "offload+inlet=ProgressRingIsend+outlet=ProgressRingIrecv_t::IpriOpriDuct"
+#define TAGS "[nproc:2][nproc:3][nproc:4]"
+
+#include "../ProcDuct.hpp"
+#include "../SkippingProcDuct.hpp"
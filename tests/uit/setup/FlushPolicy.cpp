@@ -0,0 +1,197 @@
+#include <thread>
+
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uitsl/mpi/mpi_guard.hpp"
+#include "uitsl/mpi/mpi_utils.hpp"
+#include "uitsl/utility/assign_utils.hpp"
+
+#include "uit/ducts/intra/put=dropping+get=stepping+type=any/a::SerialPendingDuct.hpp"
+#include "uit/ducts/mock/ThrowDuct.hpp"
+#include "uit/ducts/proc/impl/inlet/templated/impl/FlushTrigger.hpp"
+#include "uit/ducts/proc/put=dropping+get=stepping+type=cereal/aggregated+inlet=RingIsend+outlet=Iprobe_c::AggregatedIriOiDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=stepping+type=trivial/buffered+inlet=RingIsend+outlet=Iprobe_t::BufferedIriOiDuct.hpp"
+#include "uit/setup/FlushPolicy.hpp"
+#include "uit/setup/ImplSpec.hpp"
+#include "uit/setup/StepEndHooks.hpp"
+
+#include "netuit/arrange/DyadicTopologyFactory.hpp"
+#include "netuit/assign/AssignAvailableProcs.hpp"
+#include "netuit/mesh/Mesh.hpp"
+
+namespace {
+
+template<template<typename> typename ProcDuct, typename FlushPolicy>
+using flush_spec_t = uit::ImplSpec<
+  int,
+  uit::ImplSelect<uit::a::SerialPendingDuct, uit::ThrowDuct, ProcDuct>,
+  uit::DefaultSpoutWrapper,
+  uit::DEFAULT_BUFFER,
+  std::numeric_limits<size_t>::max(),
+  2,
+  FlushPolicy
+>;
+
+// put 1 through num_puts to the paired proc, calling end_step() but never
+// TryFlush, and check that the last put arrives
+template<typename Spec>
+void check_delivers_without_try_flush(const int num_puts) {
+
+  netuit::Mesh<Spec> mesh{
+    netuit::DyadicTopologyFactory{}( uitsl::get_nprocs() ),
+    uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+    netuit::AssignAvailableProcs{}
+  };
+  auto node = mesh.GetSubmesh().front();
+  auto input = node.GetInput(0);
+  auto output = node.GetOutput(0);
+
+  for (int i = 1; i <= num_puts; ++i) REQUIRE( output.TryPut( i ) );
+  uit::end_step();
+
+  while ( input.Get() != num_puts ) input.TryStep();
+
+  UITSL_Barrier( MPI_COMM_WORLD );
+
+}
+
+} // namespace
+
+TEST_CASE("Test FlushPolicy", "[nproc:1]") {
+
+  REQUIRE( uit::ManualFlushPolicy::IsManual );
+  REQUIRE( !uit::ItemFlushPolicy<4>::IsManual );
+  REQUIRE( !uit::ByteFlushPolicy<64>::IsManual );
+  REQUIRE( uit::DeadlineFlushPolicy<10>::IsTimed );
+  REQUIRE( !uit::ItemFlushPolicy<4>::IsTimed );
+  REQUIRE( uit::StepEndFlushPolicy::FlushAtStepEnd );
+
+  REQUIRE( std::is_same_v<
+    uit::get_flush_policy_t<uit::ImplSpec<int>>,
+    uit::ManualFlushPolicy
+  > );
+
+  using Spec = uit::ImplSpec<
+    int,
+    uit::ImplSelect<>,
+    uit::DefaultSpoutWrapper,
+    uit::DEFAULT_BUFFER,
+    std::numeric_limits<size_t>::max(),
+    2,
+    uit::ItemFlushPolicy<4>
+  >;
+  REQUIRE( std::is_same_v<
+    uit::get_flush_policy_t<Spec>,
+    uit::ItemFlushPolicy<4>
+  > );
+
+  struct NoPolicy {};
+  REQUIRE( std::is_same_v<
+    uit::get_flush_policy_t<NoPolicy>,
+    uit::ManualFlushPolicy
+  > );
+
+}
+
+TEST_CASE("Test FlushTrigger thresholds", "[nproc:1]") {
+
+  const auto nop = [](){ return true; };
+
+  SECTION("Manual") {
+    uit::internal::FlushTrigger<uit::ManualFlushPolicy, int> trigger;
+    for (size_t i{}; i < 100; ++i) REQUIRE( !trigger.RecordPut(nop) );
+  }
+
+  SECTION("Items") {
+    uit::internal::FlushTrigger<uit::ItemFlushPolicy<3>, int> trigger;
+    REQUIRE( !trigger.RecordPut(nop) );
+    REQUIRE( !trigger.RecordPut(nop) );
+    REQUIRE( trigger.RecordPut(nop) );
+    trigger.Reset();
+    REQUIRE( !trigger.RecordPut(nop) );
+  }
+
+  SECTION("Bytes") {
+    uit::internal::FlushTrigger<
+      uit::ByteFlushPolicy<2 * sizeof(double)>, double
+    > trigger;
+    REQUIRE( !trigger.RecordPut(nop) );
+    REQUIRE( trigger.RecordPut(nop) );
+  }
+
+  SECTION("Deadline") {
+    uit::internal::FlushTrigger<uit::DeadlineFlushPolicy<1>, int> trigger;
+    REQUIRE( !trigger.RecordPut(nop) );
+    // coarse clock resolution is a few milliseconds
+    std::this_thread::sleep_for( std::chrono::milliseconds{50} );
+    REQUIRE( trigger.RecordPut(nop) );
+  }
+
+}
+
+TEST_CASE("Test StepEndHooks", "[nproc:1]") {
+
+  size_t num_flushes{};
+  const auto flush = [&num_flushes](){ ++num_flushes; return true; };
+
+  {
+    uit::internal::FlushTrigger<uit::StepEndFlushPolicy, int> trigger;
+
+    REQUIRE( uit::try_end_step() );
+    REQUIRE( num_flushes == 0 );
+
+    // registers on first put, only once
+    REQUIRE( !trigger.RecordPut(flush) );
+    REQUIRE( !trigger.RecordPut(flush) );
+
+    REQUIRE( uit::try_end_step() );
+    REQUIRE( num_flushes == 1 );
+
+    // copies start out unregistered
+    auto copy{ trigger };
+    uit::end_step();
+    REQUIRE( num_flushes == 2 );
+
+    // hooks are per thread
+    std::thread{ [](){ REQUIRE( uit::try_end_step() ); } }.join();
+    REQUIRE( num_flushes == 2 );
+  }
+
+  // deregisters on destruction
+  REQUIRE( uit::try_end_step() );
+  REQUIRE( num_flushes == 2 );
+
+  {
+    uit::StepEndHook hook;
+    hook.Arm( [](){ return false; } );
+    REQUIRE( !uit::try_end_step() );
+  }
+  REQUIRE( uit::try_end_step() );
+
+}
+
+TEST_CASE("Test ItemFlushPolicy delivery", "[nproc:2]") {
+
+  // the fourth put flushes the buffer
+  check_delivers_without_try_flush<
+    flush_spec_t<uit::t::BufferedIriOiDuct, uit::ItemFlushPolicy<4>>
+  >( 4 );
+
+  check_delivers_without_try_flush<
+    flush_spec_t<uit::c::AggregatedIriOiDuct, uit::ItemFlushPolicy<4>>
+  >( 4 );
+
+}
+
+TEST_CASE("Test StepEndFlushPolicy delivery", "[nproc:2]") {
+
+  check_delivers_without_try_flush<
+    flush_spec_t<uit::t::BufferedIriOiDuct, uit::StepEndFlushPolicy>
+  >( 3 );
+
+  check_delivers_without_try_flush<
+    flush_spec_t<uit::c::AggregatedIriOiDuct, uit::StepEndFlushPolicy>
+  >( 3 );
+
+}
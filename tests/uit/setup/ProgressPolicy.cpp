@@ -0,0 +1,41 @@
+#include <limits>
+#include <type_traits>
+
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uit/setup/ImplSpec.hpp"
+#include "uit/setup/ProgressPolicy.hpp"
+
+TEST_CASE("Test ProgressPolicy", "[nproc:1]") {
+
+  REQUIRE( !uit::InlineProgressPolicy::UseProgressThread );
+  REQUIRE( uit::ThreadProgressPolicy::UseProgressThread );
+
+  REQUIRE( std::is_same_v<
+    uit::get_progress_policy_t<uit::ImplSpec<int>>,
+    uit::InlineProgressPolicy
+  > );
+
+  using Spec = uit::ImplSpec<
+    int,
+    uit::ImplSelect<>,
+    uit::DefaultSpoutWrapper,
+    uit::DEFAULT_BUFFER,
+    std::numeric_limits<size_t>::max(),
+    2,
+    uit::ManualFlushPolicy,
+    uit::ThreadProgressPolicy
+  >;
+  REQUIRE( std::is_same_v<
+    uit::get_progress_policy_t<Spec>,
+    uit::ThreadProgressPolicy
+  > );
+
+  struct NoPolicy {};
+  REQUIRE( std::is_same_v<
+    uit::get_progress_policy_t<NoPolicy>,
+    uit::InlineProgressPolicy
+  > );
+
+}
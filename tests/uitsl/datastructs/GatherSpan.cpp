@@ -0,0 +1,50 @@
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "uitsl/datastructs/GatherSpan.hpp"
+
+TEST_CASE("Test GatherSpan owned storage", "[nproc:1]") {
+
+  uitsl::GatherSpan<int> span( 3 );
+  REQUIRE( span.IsContiguous() );
+  REQUIRE( span.GetNumSegments() == 1 );
+  REQUIRE( span.size() == 3 );
+  REQUIRE( span.GetNumBytes() == 3 * sizeof(int) );
+
+  span.data()[2] = 42;
+  REQUIRE( span == uitsl::GatherSpan<int>{0, 0, 42} );
+
+  span.resize( 1 );
+  REQUIRE( span == uitsl::GatherSpan<int>{0} );
+
+}
+
+TEST_CASE("Test GatherSpan segments", "[nproc:1]") {
+
+  const int header{ 7 };
+  const emp::vector<int> payload{ 1, 2, 3 };
+
+  uitsl::GatherSpan<int> span{ 100, 200 };
+  span.AddSegment( &header, 1 );
+  span.AddSegment( payload.data(), payload.size() );
+
+  // owned storage is released once segments are added
+  REQUIRE( !span.IsContiguous() );
+  REQUIRE( span.GetNumSegments() == 2 );
+  REQUIRE( span.size() == 4 );
+  REQUIRE( span.GetSegment(1).second == 3 * sizeof(int) );
+  REQUIRE( span == uitsl::GatherSpan<int>{7, 1, 2, 3} );
+
+  // copies gather segments into owned storage
+  const auto copy = span;
+  REQUIRE( copy.IsContiguous() );
+  REQUIRE( copy == span );
+  REQUIRE( copy.data()[0] == 7 );
+  REQUIRE( copy.data()[3] == 3 );
+
+  span.resize( 2 );
+  REQUIRE( span.IsContiguous() );
+  REQUIRE( span == uitsl::GatherSpan<int>{0, 0} );
+
+}
@@ -0,0 +1,58 @@
+#include <ratio>
+#include <thread>
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uitsl/datastructs/SpscRingBuffer.hpp"
+
+TEST_CASE("Test SpscRingBuffer", "[nproc:1]") {
+
+  constexpr size_t buff_size{ 10 };
+  uitsl::SpscRingBuffer<size_t, buff_size> buff;
+
+  for (size_t rep = 0; rep < std::kilo::num; ++rep) {
+
+    REQUIRE( buff.IsEmpty() );
+
+    for (size_t i = 0; i < buff_size; ++i) {
+      REQUIRE( buff.GetSize() == i );
+      REQUIRE( buff.TryPush(rep + i) );
+    }
+    REQUIRE( buff.GetSize() == buff_size );
+    REQUIRE( !buff.TryPush(0) );
+
+    for (size_t i = 0; i < buff_size; ++i) REQUIRE( buff.Get(i) == rep + i );
+
+    for (size_t i = 0; i < buff_size; ++i) {
+      REQUIRE( buff.GetFront() == rep + i );
+      buff.Pop();
+    }
+
+  }
+
+}
+
+TEST_CASE("Test SpscRingBuffer across threads", "[nproc:1]") {
+
+  uitsl::SpscRingBuffer<size_t, 16> buff;
+  constexpr size_t num_items{ 100 * std::kilo::num };
+
+  std::thread producer( [&buff](){
+    for (size_t i{}; i < num_items; ) {
+      if ( buff.TryPush( i ) ) ++i;
+      else std::this_thread::yield();
+    }
+  } );
+
+  // items arrive in order, with none lost or duplicated
+  for (size_t expected{}; expected < num_items; ) {
+    if ( buff.IsEmpty() ) { std::this_thread::yield(); continue; }
+    REQUIRE( buff.GetFront() == expected );
+    buff.Pop();
+    ++expected;
+  }
+
+  producer.join();
+  REQUIRE( buff.IsEmpty() );
+
+}
@@ -0,0 +1,39 @@
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uitsl/distributed/MsgChunkLayout.hpp"
+
+TEST_CASE("MsgChunkLayout rounds chunks to whole items") {
+
+  // 10 ints and an 8-byte epoch in chunks of at least 10 bytes
+  const uitsl::MsgChunkLayout<int> layout( 48, 10 );
+
+  REQUIRE( layout.GetChunkBytes() == 12 );
+  REQUIRE( layout.GetChunkItems() == 3 );
+  REQUIRE( layout.GetNumChunks() == 4 );
+
+  REQUIRE( layout.GetByteBegin(3) == 36 );
+  REQUIRE( layout.GetByteSize(3) == 12 );
+
+  REQUIRE( layout.GetItemBegin(3, 10) == 9 );
+  REQUIRE( layout.GetItemEnd(3, 10) == 10 );
+
+}
+
+TEST_CASE("MsgChunkLayout short final chunk") {
+
+  const uitsl::MsgChunkLayout<char> layout( 10, 4 );
+
+  REQUIRE( layout.GetNumChunks() == 3 );
+  REQUIRE( layout.GetByteSize(0) == 4 );
+  REQUIRE( layout.GetByteSize(2) == 2 );
+
+}
+
+TEST_CASE("MsgChunkLayout empty message") {
+
+  const uitsl::MsgChunkLayout<char> layout( 0, 4 );
+
+  REQUIRE( layout.GetNumChunks() == 1 );
+  REQUIRE( layout.GetByteSize(0) == 0 );
+
+}
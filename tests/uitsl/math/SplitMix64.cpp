@@ -0,0 +1,41 @@
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uitsl/math/SplitMix64.hpp"
+
+TEST_CASE("Test SplitMix64", "[nproc:1]") {
+
+  // same keys, same stream
+  uitsl::SplitMix64 a( 1, 2, 3 ), b( 1, 2, 3 );
+  for (size_t i{}; i < 100; ++i) REQUIRE( a() == b() );
+
+  // different keys, different streams
+  REQUIRE( uitsl::SplitMix64( 1, 2, 3 )() != uitsl::SplitMix64( 1, 3, 2 )() );
+  REQUIRE( uitsl::SplitMix64( 1, 2 )() != uitsl::SplitMix64( 2, 2 )() );
+  REQUIRE( uitsl::SplitMix64( 1 )() != uitsl::SplitMix64( 1, 0 )() );
+
+}
+
+TEST_CASE("Test SplitMix64 GetDouble", "[nproc:1]") {
+
+  uitsl::SplitMix64 rng( 1 );
+  double sum{};
+  for (size_t i{}; i < 10000; ++i) {
+    const double draw = rng.GetDouble();
+    REQUIRE( draw >= 0.0 );
+    REQUIRE( draw < 1.0 );
+    sum += draw;
+  }
+  REQUIRE( sum / 10000 == Approx( 0.5 ).epsilon( 0.05 ) );
+
+}
+
+TEST_CASE("Test SplitMix64 GetUInt", "[nproc:1]") {
+
+  uitsl::SplitMix64 rng( 1 );
+  size_t counts[3]{};
+  for (size_t i{}; i < 3000; ++i) ++counts[ rng.GetUInt( 3 ) ];
+  for (const size_t count : counts) REQUIRE( count > 900 );
+
+  for (size_t i{}; i < 100; ++i) REQUIRE( rng.GetUInt( 1 ) == 0 );
+
+}
@@ -12,3 +12,49 @@ TEST_CASE("Test linear encoder/decoder", "[nproc:1]") {
         REQUIRE(uitsl::linear_encode(uitsl::linear_decode(i, dims), dims) == i);
     }
 }
+
+TEST_CASE("Test Morton encoder", "[nproc:1]") {
+    REQUIRE(uitsl::morton_encode({0, 0}, 2) == 0);
+    REQUIRE(uitsl::morton_encode({1, 0}, 2) == 1);
+    REQUIRE(uitsl::morton_encode({0, 1}, 2) == 2);
+    REQUIRE(uitsl::morton_encode({1, 1}, 2) == 3);
+    REQUIRE(uitsl::morton_encode({2, 0}, 2) == 4);
+    REQUIRE(uitsl::morton_encode({3, 3}, 2) == 15);
+    REQUIRE(uitsl::morton_encode({1, 1, 1}, 1) == 7);
+}
+
+TEST_CASE("Test Hilbert encoder", "[nproc:1]") {
+
+    for (const size_t n_dims : {1, 2, 3}) {
+        for (const size_t bits : {1, 2, 3}) {
+
+            const size_t side = size_t{1} << bits;
+            const uitsl::Dims dims(n_dims, side);
+            size_t cardinality = 1;
+            for (const size_t dim : dims) cardinality *= dim;
+
+            // position along curve -> point
+            emp::vector<uitsl::Point> curve(cardinality);
+            for (size_t i = 0; i < cardinality; ++i) {
+                const auto p = uitsl::linear_decode(i, dims);
+                const size_t pos = uitsl::hilbert_encode(p, bits);
+                REQUIRE(pos < cardinality);
+                REQUIRE(curve[pos].empty());
+                curve[pos] = p;
+            }
+
+            // each step moves to a neighbor
+            for (size_t pos = 1; pos < cardinality; ++pos) {
+                size_t distance = 0;
+                for (size_t d = 0; d < n_dims; ++d) {
+                    distance += curve[pos][d] > curve[pos - 1][d]
+                        ? curve[pos][d] - curve[pos - 1][d]
+                        : curve[pos - 1][d] - curve[pos][d];
+                }
+                REQUIRE(distance == 1);
+            }
+
+        }
+    }
+
+}
@@ -0,0 +1,36 @@
+#include <mpi.h>
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uitsl/mpi/audited_routines.hpp"
+#include "uitsl/mpi/HindexedTypeCache.hpp"
+
+TEST_CASE("HindexedTypeCache reuses datatypes") {
+
+  uitsl::HindexedTypeCache cache;
+
+  const uitsl::HindexedTypeCache::shape_t shape{ {0, 4}, {16, 8} };
+  const MPI_Datatype datatype = cache.Lookup( shape );
+  REQUIRE( cache.GetSize() == 1 );
+  REQUIRE( cache.Lookup( shape ) == datatype );
+  REQUIRE( cache.GetSize() == 1 );
+
+  int size;
+  UITSL_Type_size( datatype, &size );
+  REQUIRE( size == 12 );
+
+  cache.Lookup( { {0, 4}, {32, 8} } );
+  REQUIRE( cache.GetSize() == 2 );
+
+}
+
+TEST_CASE("HindexedTypeCache eviction") {
+
+  uitsl::HindexedTypeCache cache( 2 );
+
+  for (int i{1}; i < 10; ++i) {
+    cache.Lookup( { {0, i} } );
+    REQUIRE( cache.GetSize() <= 2 );
+  }
+
+}
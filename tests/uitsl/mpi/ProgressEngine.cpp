@@ -0,0 +1,117 @@
+#include <mpi.h>
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "uitsl/mpi/audited_routines.hpp"
+#include "uitsl/mpi/ProgressEngine.hpp"
+#include "uitsl/mpi/request_utils.hpp"
+
+TEST_CASE("ProgressEngine dispatches completions") {
+
+  uitsl::ProgressEngine engine;
+
+  REQUIRE( engine.Poll() == 0 );
+
+  emp::vector<int> sent{ 1, 2, 3 };
+  emp::vector<int> received( sent.size() );
+  emp::vector<int> flags( sent.size() );
+
+  for (size_t i{}; i < sent.size(); ++i) {
+    MPI_Request request;
+    UITSL_Irecv(
+      &received[i], 1, MPI_INT, 0, 0, MPI_COMM_SELF, &request
+    );
+    engine.Track( request, &received, [&flags, i](){ ++flags[i]; } );
+    REQUIRE( uitsl::test_null( request ) );
+  }
+  REQUIRE( engine.GetSize() == sent.size() );
+
+  for (const int& val : sent) {
+    UITSL_Send( &val, 1, MPI_INT, 0, 0, MPI_COMM_SELF );
+  }
+
+  while ( engine.GetSize() ) engine.Poll();
+
+  REQUIRE( received == sent );
+  REQUIRE( flags == emp::vector<int>( sent.size(), 1 ) );
+
+}
+
+TEST_CASE("ProgressEngine PollIfStale") {
+
+  uitsl::ProgressEngine engine;
+
+  size_t first{};
+  size_t second{};
+
+  // one poll serves every caller until the polling caller returns
+  engine.PollIfStale( first );
+  engine.PollIfStale( second );
+  REQUIRE( engine.GetPollCount() == 1 );
+
+  engine.PollIfStale( first );
+  engine.PollIfStale( second );
+  REQUIRE( engine.GetPollCount() == 2 );
+
+  engine.PollIfStale( first );
+  engine.PollIfStale( first );
+  REQUIRE( engine.GetPollCount() == 4 );
+
+}
+
+TEST_CASE("ProgressEngine Cancel") {
+
+  uitsl::ProgressEngine engine;
+
+  int kept_buffer;
+  int cancelled_buffer;
+  bool kept_called{};
+  bool cancelled_called{};
+
+  MPI_Request request;
+  UITSL_Irecv(
+    &cancelled_buffer, 1, MPI_INT, 0, 1, MPI_COMM_SELF, &request
+  );
+  engine.Track(
+    request, &cancelled_buffer, [&](){ cancelled_called = true; }
+  );
+  UITSL_Irecv( &kept_buffer, 1, MPI_INT, 0, 2, MPI_COMM_SELF, &request );
+  engine.Track( request, &kept_buffer, [&](){ kept_called = true; } );
+
+  engine.Cancel( &cancelled_buffer );
+  REQUIRE( engine.GetSize() == 1 );
+
+  const int val{ 42 };
+  UITSL_Send( &val, 1, MPI_INT, 0, 2, MPI_COMM_SELF );
+  while ( engine.GetSize() ) engine.Poll();
+
+  REQUIRE( kept_called );
+  REQUIRE( kept_buffer == 42 );
+  REQUIRE( !cancelled_called );
+
+}
+
+TEST_CASE("ProgressEngine PollOne") {
+
+  uitsl::ProgressEngine engine;
+
+  REQUIRE( engine.PollOne() == 0 );
+
+  int buffer;
+  bool called{};
+
+  MPI_Request request;
+  UITSL_Irecv( &buffer, 1, MPI_INT, 0, 0, MPI_COMM_SELF, &request );
+  engine.Track( request, &buffer, [&](){ called = true; } );
+
+  const int val{ 7 };
+  UITSL_Send( &val, 1, MPI_INT, 0, 0, MPI_COMM_SELF );
+  while ( engine.GetSize() ) engine.PollOne();
+
+  REQUIRE( called );
+  REQUIRE( buffer == 7 );
+  REQUIRE( engine.GetPollCount() == 0 );
+
+}
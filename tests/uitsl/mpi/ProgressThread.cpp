@@ -0,0 +1,73 @@
+#include <atomic>
+#include <thread>
+
+#include <mpi.h>
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uitsl/mpi/audited_routines.hpp"
+#include "uitsl/mpi/MpiMultithreadGuard.hpp"
+#include "uitsl/mpi/ProgressEngine.hpp"
+#include "uitsl/mpi/ProgressThread.hpp"
+
+const uitsl::MpiMultithreadGuard guard;
+
+TEST_CASE("ProgressThread completes tracked requests") {
+
+  const auto progress_thread = uitsl::ProgressThread::Acquire();
+  REQUIRE( progress_thread == uitsl::ProgressThread::Acquire() );
+
+  int buffer{};
+  bool posted{};
+  std::atomic<bool> received{};
+
+  // post a receive from the progress thread, as an offloading duct would
+  progress_thread->Register(
+    &buffer,
+    [&](uitsl::ProgressEngine& engine){
+      if ( posted ) return false;
+      MPI_Request request;
+      UITSL_Irecv( &buffer, 1, MPI_INT, 0, 0, MPI_COMM_SELF, &request );
+      engine.Track( request, &buffer, [&received](){ received = true; } );
+      return posted = true;
+    }
+  );
+  REQUIRE( progress_thread->GetNumClients() == 1 );
+
+  const int val{ 42 };
+  UITSL_Send( &val, 1, MPI_INT, 0, 0, MPI_COMM_SELF );
+
+  // the test thread makes no further MPI calls
+  while ( !received ) std::this_thread::yield();
+  REQUIRE( buffer == 42 );
+
+  progress_thread->Unregister( &buffer );
+  REQUIRE( progress_thread->GetNumClients() == 0 );
+
+}
+
+TEST_CASE("ProgressThread Unregister cancels requests") {
+
+  const auto progress_thread = uitsl::ProgressThread::Acquire();
+
+  int buffer{};
+  bool posted{};
+  bool received{};
+
+  progress_thread->Register(
+    &buffer,
+    [&](uitsl::ProgressEngine& engine){
+      if ( posted ) return false;
+      MPI_Request request;
+      UITSL_Irecv( &buffer, 1, MPI_INT, 0, 1, MPI_COMM_SELF, &request );
+      engine.Track( request, &buffer, [&received](){ received = true; } );
+      return posted = true;
+    }
+  );
+
+  // unmatched receive is cancelled rather than left dangling
+  progress_thread->Unregister( &buffer );
+  REQUIRE( posted );
+  REQUIRE( !received );
+
+}
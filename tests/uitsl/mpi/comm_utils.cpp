@@ -78,6 +78,24 @@ TEST_CASE("Test Comm utils") {
 
   }
 
+  SECTION("get_host_ids") {
+
+    const size_t num_ranks = uitsl::get_nprocs();
+
+    // tests run on one machine
+    REQUIRE( uitsl::get_host_ids() == emp::vector<size_t>( num_ranks ) );
+
+    // simulated hosts are numbered in order of their lowest rank
+    const auto pairs = uitsl::get_host_ids(
+      [=](const uitsl::proc_id_t rank){ return num_ranks - 1 - rank / 2; }
+    );
+    REQUIRE( pairs.size() == num_ranks );
+    for (size_t rank = 0; rank < num_ranks; ++rank) {
+      REQUIRE( pairs[rank] == rank / 2 );
+    }
+
+  }
+
   SECTION("comm_to_string") {
 
     REQUIRE(!uitsl::comm_to_string(MPI_COMM_WORLD).empty());
@@ -0,0 +1,42 @@
+#include <algorithm>
+#include <atomic>
+
+#include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "uitsl/parallel/for_each_chunk.hpp"
+
+TEST_CASE("Test for_each_chunk", "[nproc:1]") {
+
+  for (const size_t num_items : { 0, 1, 7, 100 }) {
+    for (const size_t num_chunks : { 1, 3, 8 }) {
+
+      emp::vector<size_t> visits( num_items );
+      emp::vector<size_t> begins( num_chunks ), ends( num_chunks );
+
+      uitsl::for_each_chunk(
+        num_items, num_chunks,
+        [&](const size_t begin, const size_t end, const size_t chunk){
+          begins[chunk] = begin;
+          ends[chunk] = end;
+          for (size_t i = begin; i < end; ++i) ++visits[i];
+        }
+      );
+
+      // every item visited exactly once
+      REQUIRE( std::all_of(
+        std::begin(visits), std::end(visits),
+        [](const size_t count){ return count == 1; }
+      ) );
+
+      // chunks are contiguous and in order
+      REQUIRE( begins.front() == 0 );
+      REQUIRE( ends.back() == num_items );
+      for (size_t chunk = 1; chunk < num_chunks; ++chunk) {
+        REQUIRE( begins[chunk] == ends[chunk - 1] );
+      }
+
+    }
+  }
+
+}